@@ -19,6 +19,16 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(flashdisk, CONFIG_FLASHDISK_LOG_LEVEL);
 
+struct flashdisk_cache_page {
+	off_t addr;
+	/* Number of bytes from the start of the page holding valid data */
+	size_t fill;
+	/* Least recently used page has the oldest use stamp */
+	uint32_t used;
+	bool valid;
+	bool dirty;
+};
+
 struct flashdisk_data {
 	struct disk_info info;
 	struct k_mutex lock;
@@ -29,9 +39,9 @@ struct flashdisk_data {
 	const size_t size;
 	const size_t sector_size;
 	size_t page_size;
-	off_t cached_addr;
-	bool cache_valid;
-	bool cache_dirty;
+	struct flashdisk_cache_page pages[CONFIG_FLASHDISK_CACHE_PAGES];
+	size_t num_pages;
+	uint32_t use_stamp;
 };
 
 #define GET_SIZE_TO_BOUNDARY(start, block_size) \
@@ -105,6 +115,10 @@ static int flashdisk_init_runtime(struct flashdisk_data *ctx,
 		return -ENOMEM;
 	}
 
+	ctx->num_pages = MIN(ctx->cache_size / ctx->page_size,
+			     ARRAY_SIZE(ctx->pages));
+	LOG_INF("%zu cached pages", ctx->num_pages);
+
 	return 0;
 }
 
@@ -152,10 +166,59 @@ static bool sectors_in_range(struct flashdisk_data *ctx,
 	return false;
 }
 
+static uint8_t *flashdisk_cache_data(struct flashdisk_data *ctx,
+				     struct flashdisk_cache_page *page)
+{
+	return &ctx->cache[(page - ctx->pages) * ctx->page_size];
+}
+
+static struct flashdisk_cache_page *flashdisk_cache_find(struct flashdisk_data *ctx,
+							 off_t fl_addr)
+{
+	for (size_t i = 0; i < ctx->num_pages; i++) {
+		struct flashdisk_cache_page *page = &ctx->pages[i];
+
+		if (page->valid && page->addr == fl_addr) {
+			page->used = ++ctx->use_stamp;
+			return page;
+		}
+	}
+
+	return NULL;
+}
+
+/* Read the part of a cached page up to end which has not been loaded nor
+ * written
+ */
+static int flashdisk_cache_fill_to(struct flashdisk_data *ctx,
+				   struct flashdisk_cache_page *page, size_t end)
+{
+	uint8_t *data = flashdisk_cache_data(ctx, page);
+
+	if (page->fill >= end) {
+		return 0;
+	}
+
+	if (flash_read(ctx->info.dev, page->addr + page->fill, &data[page->fill],
+		       end - page->fill) < 0) {
+		return -EIO;
+	}
+
+	page->fill = end;
+	return 0;
+}
+
+static int flashdisk_cache_fill(struct flashdisk_data *ctx,
+				struct flashdisk_cache_page *page)
+{
+	return flashdisk_cache_fill_to(ctx, page, ctx->page_size);
+}
+
 static int disk_flash_access_read(struct disk_info *disk, uint8_t *buff,
 				uint32_t start_sector, uint32_t sector_count)
 {
 	struct flashdisk_data *ctx;
+	struct flashdisk_cache_page *page;
 	off_t fl_addr;
 	uint32_t remaining;
 	uint32_t offset;
@@ -184,8 +247,14 @@ static int disk_flash_access_read(struct disk_info *disk, uint8_t *buff,
 			len = remaining;
 		}
 
-		if (ctx->cache_valid && ctx->cached_addr == fl_addr) {
-			memcpy(buff, &ctx->cache[offset], len);
+		page = flashdisk_cache_find(ctx, fl_addr);
+		if (page) {
+			if ((offset + len > page->fill) &&
+			    (flashdisk_cache_fill(ctx, page) < 0)) {
+				rc = -EIO;
+				goto end;
+			}
+			memcpy(buff, &flashdisk_cache_data(ctx, page)[offset], len);
 		} else if (flash_read(disk->dev, fl_addr + offset, buff, len) < 0) {
 			rc = -EIO;
 			goto end;
@@ -206,57 +275,95 @@ end:
 	return rc;
 }
 
-static int flashdisk_cache_commit(struct flashdisk_data *ctx)
+static int flashdisk_cache_commit_page(struct flashdisk_data *ctx,
+				       struct flashdisk_cache_page *page)
 {
-	if (!ctx->cache_valid || !ctx->cache_dirty) {
+	int rc;
+
+	if (!page->valid || !page->dirty) {
 		/* Either no cached data or cache matches flash data */
 		return 0;
 	}
 
-	if (flash_erase(ctx->info.dev, ctx->cached_addr, ctx->page_size) < 0) {
+	/* Data not overwritten has to be kept */
+	rc = flashdisk_cache_fill(ctx, page);
+	if (rc < 0) {
+		return rc;
+	}
+
+	if (flash_erase(ctx->info.dev, page->addr, ctx->page_size) < 0) {
 		return -EIO;
 	}
 
 	/* write data to flash */
-	if (flash_write(ctx->info.dev, ctx->cached_addr, ctx->cache, ctx->page_size) < 0) {
+	if (flash_write(ctx->info.dev, page->addr, flashdisk_cache_data(ctx, page),
+			ctx->page_size) < 0) {
 		return -EIO;
 	}
 
-	ctx->cache_dirty = false;
+	page->dirty = false;
 	return 0;
 }
 
-static int flashdisk_cache_load(struct flashdisk_data *ctx, off_t fl_addr)
+static int flashdisk_cache_commit(struct flashdisk_data *ctx)
 {
+	int rc = 0;
+
+	for (size_t i = 0; i < ctx->num_pages; i++) {
+		int err = flashdisk_cache_commit_page(ctx, &ctx->pages[i]);
+
+		if (err < 0 && rc == 0) {
+			rc = err;
+		}
+	}
+
+	return rc;
+}
+
+/* Get the cache page of fl_addr, evicting the least recently used page if it
+ * is not cached. The page contents are not read from flash.
+ */
+static int flashdisk_cache_load(struct flashdisk_data *ctx, off_t fl_addr,
+				struct flashdisk_cache_page **pagep)
+{
+	struct flashdisk_cache_page *page;
 	int rc;
 
 	__ASSERT_NO_MSG((fl_addr & (ctx->page_size - 1)) == 0);
 
-	if (ctx->cache_valid) {
-		if (ctx->cached_addr == fl_addr) {
-			/* Page is already cached */
-			return 0;
+	page = flashdisk_cache_find(ctx, fl_addr);
+	if (page) {
+		/* Page is already cached */
+		*pagep = page;
+		return 0;
+	}
+
+	page = &ctx->pages[0];
+	for (size_t i = 0; i < ctx->num_pages; i++) {
+		if (!ctx->pages[i].valid) {
+			page = &ctx->pages[i];
+			break;
 		}
-		/* Different page is in cache, commit it first */
-		rc = flashdisk_cache_commit(ctx);
-		if (rc < 0) {
-			/* Failed to commit dirty page, abort */
-			return rc;
+		if ((int32_t)(ctx->pages[i].used - page->used) < 0) {
+			page = &ctx->pages[i];
 		}
 	}
 
-	/* Load page into cache */
-	ctx->cache_valid = false;
-	ctx->cache_dirty = false;
-	ctx->cached_addr = fl_addr;
-	rc = flash_read(ctx->info.dev, fl_addr, ctx->cache, ctx->page_size);
-	if (rc == 0) {
-		/* Successfully loaded into cache, mark as valid */
-		ctx->cache_valid = true;
-		return 0;
+	/* Commit the evicted page first */
+	rc = flashdisk_cache_commit_page(ctx, page);
+	if (rc < 0) {
+		/* Failed to commit dirty page, abort */
+		return rc;
 	}
 
-	return -EIO;
+	page->addr = fl_addr;
+	page->fill = 0;
+	page->used = ++ctx->use_stamp;
+	page->valid = true;
+	page->dirty = false;
+
+	*pagep = page;
+	return 0;
 }
 
 /* input size is either less or equal to a block size (ctx->page_size)
@@ -265,6 +372,8 @@ static int flashdisk_cache_load(struct flashdisk_data *ctx, off_t fl_addr)
 static int flashdisk_cache_write(struct flashdisk_data *ctx, off_t start_addr,
 				uint32_t size, const void *buff)
 {
+	struct flashdisk_cache_page *page;
+	uint8_t *data;
 	int rc;
 	off_t fl_addr;
 	uint32_t offset;
@@ -280,18 +389,34 @@ static int flashdisk_cache_write(struct flashdisk_data *ctx, off_t start_addr,
 	 */
 	__ASSERT_NO_MSG(fl_addr + ctx->page_size >= start_addr + size);
 
-	rc = flashdisk_cache_load(ctx, fl_addr);
+	rc = flashdisk_cache_load(ctx, fl_addr, &page);
+	if (rc < 0) {
+		return rc;
+	}
+
+	/* A dirty page is only read from flash up to the start of the write,
+	 * so overwriting it from its start, sequentially or at once, does not
+	 * read it. A clean page is read up to the end of the write, to only
+	 * mark it dirty if the data differs from flash.
+	 */
+	rc = flashdisk_cache_fill_to(ctx, page,
+				     page->dirty ? offset : offset + size);
 	if (rc < 0) {
+		if (!page->dirty) {
+			page->valid = false;
+		}
 		return rc;
 	}
 
 	/* Do not mark cache as dirty if data to be written matches cache.
 	 * If cache is already dirty, copy data to cache without compare.
 	 */
-	if (ctx->cache_dirty || memcmp(&ctx->cache[offset], buff, size)) {
+	data = flashdisk_cache_data(ctx, page);
+	if (page->dirty || memcmp(&data[offset], buff, size)) {
 		/* Update cache and mark it as dirty */
-		memcpy(&ctx->cache[offset], buff, size);
-		ctx->cache_dirty = true;
+		memcpy(&data[offset], buff, size);
+		page->fill = MAX(page->fill, offset + size);
+		page->dirty = true;
 	}
 
 	return 0;
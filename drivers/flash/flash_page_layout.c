@@ -7,20 +7,199 @@
 #include <errno.h>
 
 #include <zephyr/drivers/flash.h>
+#include <zephyr/spinlock.h>
 
-static int flash_get_page_info(const struct device *dev, off_t offs,
-			       uint32_t index, struct flash_pages_info *info)
-{
-	const struct flash_driver_api *api = dev->api;
+#if defined(CONFIG_FLASH_PAGE_LAYOUT_INDEX)
+/* Offset and index of the first page of a layout run */
+struct flash_layout_run_start {
+	off_t offset;
+	uint32_t index;
+};
+
+/* Start of every run of a page layout, then end of the layout */
+struct flash_layout_index {
+	const struct device *dev;
 	const struct flash_pages_layout *layout;
 	size_t layout_size;
+	/* Entries of layout_run_starts owned by the index */
+	struct flash_layout_run_start *starts;
+	size_t starts_size;
+	/* Layout does not fit the entries owned, and is walked */
+	bool walk;
+};
+
+static struct flash_layout_index
+	layout_indexes[CONFIG_FLASH_PAGE_LAYOUT_INDEX_DEVICES];
+static struct flash_layout_run_start
+	layout_run_starts[CONFIG_FLASH_PAGE_LAYOUT_INDEX_RUNS];
+static size_t layout_run_starts_used;
+static struct k_spinlock layout_index_lock;
+
+static void flash_layout_index_build(struct flash_layout_index *idx,
+				     const struct flash_pages_layout *layout,
+				     size_t layout_size)
+{
+	struct flash_layout_run_start *starts = idx->starts;
+
+	starts[0].offset = 0;
+	starts[0].index = 0U;
+	for (size_t run = 0; run < layout_size; run++) {
+		starts[run + 1].offset = starts[run].offset +
+			layout[run].pages_count * layout[run].pages_size;
+		starts[run + 1].index = starts[run].index +
+			layout[run].pages_count;
+	}
+
+	idx->layout = layout;
+	idx->layout_size = layout_size;
+	idx->walk = false;
+}
+
+static const struct flash_layout_index *
+flash_layout_index_get(const struct device *dev,
+		       const struct flash_pages_layout *layout,
+		       size_t layout_size)
+{
+	const struct flash_layout_index *ret = NULL;
+	struct flash_layout_index *idx = NULL;
+	k_spinlock_key_t key = k_spin_lock(&layout_index_lock);
+
+	/* Slots are taken in order and never given back, so the slot of the
+	 * device, if any, comes before the first free one.
+	 */
+	for (size_t i = 0; i < ARRAY_SIZE(layout_indexes); i++) {
+		if (layout_indexes[i].dev == dev ||
+		    layout_indexes[i].dev == NULL) {
+			idx = &layout_indexes[i];
+			break;
+		}
+	}
+
+	if (idx == NULL) {
+		goto out;
+	}
+
+	if (idx->dev == dev) {
+		if (idx->layout == layout && idx->layout_size == layout_size) {
+			ret = idx->walk ? NULL : idx;
+			goto out;
+		}
+
+		/* The driver reports a different layout: rebuild the index in
+		 * its slot. Entries at the end of the pool go back to it first,
+		 * so that the index may grow.
+		 */
+		if (idx->starts + idx->starts_size ==
+		    &layout_run_starts[layout_run_starts_used]) {
+			layout_run_starts_used -= idx->starts_size;
+			idx->starts_size = 0;
+		}
+
+		if (layout_size < idx->starts_size) {
+			flash_layout_index_build(idx, layout, layout_size);
+			ret = idx;
+			goto out;
+		}
+	}
+
+	/* Index the layout if there are entries left. An index owning too
+	 * few entries inside the pool cannot grow, and keeps them for a later
+	 * layout which fits.
+	 */
+	if (idx->starts_size != 0 ||
+	    layout_size >= ARRAY_SIZE(layout_run_starts) -
+			   layout_run_starts_used) {
+		if (idx->dev == dev) {
+			idx->layout = layout;
+			idx->layout_size = layout_size;
+			idx->walk = true;
+		}
+		goto out;
+	}
+
+	idx->dev = dev;
+	idx->starts = &layout_run_starts[layout_run_starts_used];
+	idx->starts_size = layout_size + 1;
+	layout_run_starts_used += idx->starts_size;
+	flash_layout_index_build(idx, layout, layout_size);
+	ret = idx;
+
+out:
+	k_spin_unlock(&layout_index_lock, key);
+
+	return ret;
+}
+
+static int flash_layout_index_find(const struct flash_layout_index *idx,
+				   off_t offs, uint32_t index,
+				   struct flash_pages_info *info,
+				   uint32_t *left)
+{
+	const struct flash_layout_run_start *starts = idx->starts;
+	size_t lo = 0;
+	size_t hi = idx->layout_size;
 	uint32_t index_jmp;
 
+	if (offs != 0) {
+		if (offs < 0 || offs >= starts[hi].offset) {
+			return -EINVAL;
+		}
+	} else if (index >= starts[hi].index) {
+		return -EINVAL;
+	}
+
+	/* Find the last run starting at or before the page */
+	while (hi - lo > 1) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if ((offs != 0) ? (offs >= starts[mid].offset) :
+				  (index >= starts[mid].index)) {
+			lo = mid;
+		} else {
+			hi = mid;
+		}
+	}
+
+	info->size = idx->layout[lo].pages_size;
+	if (offs != 0) {
+		index_jmp = (offs - starts[lo].offset) / info->size;
+	} else {
+		index_jmp = index - starts[lo].index;
+	}
+
+	info->start_offset = starts[lo].offset + (index_jmp * info->size);
+	info->index = starts[lo].index + index_jmp;
+	*left = idx->layout[lo].pages_count - index_jmp;
+
+	return lo;
+}
+#endif /* CONFIG_FLASH_PAGE_LAYOUT_INDEX */
+
+/*
+ * Get the page at offs, or of index if offs is 0. Returns the number of the
+ * layout run of the page, and the number of pages left in the run from the
+ * page on in left.
+ */
+static int flash_page_find(const struct device *dev,
+			   const struct flash_pages_layout *layout,
+			   size_t layout_size, off_t offs, uint32_t index,
+			   struct flash_pages_info *info, uint32_t *left)
+{
+	uint32_t index_jmp;
+	int run = 0;
+
+#if defined(CONFIG_FLASH_PAGE_LAYOUT_INDEX)
+	const struct flash_layout_index *idx;
+
+	idx = flash_layout_index_get(dev, layout, layout_size);
+	if (idx) {
+		return flash_layout_index_find(idx, offs, index, info, left);
+	}
+#endif /* CONFIG_FLASH_PAGE_LAYOUT_INDEX */
+
 	info->start_offset = 0;
 	info->index = 0U;
 
-	api->page_layout(dev, &layout, &layout_size);
-
 	while (layout_size--) {
 		info->size = layout->pages_size;
 		if (offs == 0) {
@@ -33,15 +212,34 @@ static int flash_get_page_info(const struct device *dev, off_t offs,
 		info->start_offset += (index_jmp * info->size);
 		info->index += index_jmp;
 		if (index_jmp < layout->pages_count) {
-			return 0;
+			*left = layout->pages_count - index_jmp;
+			return run;
 		}
 
 		layout++;
+		run++;
 	}
 
 	return -EINVAL; /* page at offs or idx doesn't exist */
 }
 
+static int flash_get_page_info(const struct device *dev, off_t offs,
+			       uint32_t index, struct flash_pages_info *info)
+{
+	const struct flash_driver_api *api = dev->api;
+	const struct flash_pages_layout *layout;
+	size_t layout_size;
+	uint32_t left;
+	int rc;
+
+	api->page_layout(dev, &layout, &layout_size);
+
+	rc = flash_page_find(dev, layout, layout_size, offs, index, info,
+			     &left);
+
+	return (rc < 0) ? rc : 0;
+}
+
 int z_impl_flash_get_page_info_by_offs(const struct device *dev, off_t offs,
 				       struct flash_pages_info *info)
 {
@@ -64,6 +262,15 @@ size_t z_impl_flash_get_page_count(const struct device *dev)
 
 	api->page_layout(dev, &layout, &layout_size);
 
+#if defined(CONFIG_FLASH_PAGE_LAYOUT_INDEX)
+	const struct flash_layout_index *idx;
+
+	idx = flash_layout_index_get(dev, layout, layout_size);
+	if (idx) {
+		return idx->starts[layout_size].index;
+	}
+#endif /* CONFIG_FLASH_PAGE_LAYOUT_INDEX */
+
 	while (layout_size--) {
 		count += layout->pages_count;
 		layout++;
@@ -100,3 +307,51 @@ void flash_page_foreach(const struct device *dev, flash_page_cb cb,
 		}
 	}
 }
+
+void flash_page_foreach_range(const struct device *dev, off_t offset,
+			      size_t size, flash_page_cb cb, void *data)
+{
+	const struct flash_driver_api *api = dev->api;
+	const struct flash_pages_layout *layout;
+	struct flash_pages_info page_info;
+	size_t layout_size;
+	uint32_t left;
+	off_t end = offset + size;
+	size_t run;
+	int rc;
+
+	if (size == 0) {
+		return;
+	}
+
+	api->page_layout(dev, &layout, &layout_size);
+
+	/* Start with the page holding the first byte of the range */
+	rc = flash_page_find(dev, layout, layout_size, MAX(offset, 0), 0U,
+			     &page_info, &left);
+	if (rc < 0) {
+		return;
+	}
+	run = rc;
+
+	while (page_info.start_offset < end) {
+		if (!cb(&page_info, data)) {
+			return;
+		}
+
+		page_info.start_offset += page_info.size;
+		page_info.index++;
+
+		if (--left == 0) {
+			/* Move on to the next run holding pages */
+			do {
+				if (++run == layout_size) {
+					return;
+				}
+			} while (layout[run].pages_count == 0);
+
+			page_info.size = layout[run].pages_size;
+			left = layout[run].pages_count;
+		}
+	}
+}
@@ -660,8 +660,8 @@ static int i2s_mcux_config(const struct device *dev, enum i2s_dir dir,
 
 	if (dir == I2S_DIR_TX) {
 		memcpy(&dev_data->tx.cfg, i2s_cfg, sizeof(struct i2s_config));
-		LOG_DBG("tx slab free_list = 0x%x",
-			(uint32_t)i2s_cfg->mem_slab->free_list);
+		LOG_DBG("tx slab num_free = %d",
+			k_mem_slab_num_free_get(i2s_cfg->mem_slab));
 		LOG_DBG("tx slab num_blocks = %d",
 			(uint32_t)i2s_cfg->mem_slab->num_blocks);
 		LOG_DBG("tx slab block_size = %d",
@@ -693,8 +693,8 @@ static int i2s_mcux_config(const struct device *dev, enum i2s_dir dir,
 		config.fifo.fifoWatermark = 0;
 
 		memcpy(&dev_data->rx.cfg, i2s_cfg, sizeof(struct i2s_config));
-		LOG_DBG("rx slab free_list = 0x%x",
-			(uint32_t)i2s_cfg->mem_slab->free_list);
+		LOG_DBG("rx slab num_free = %d",
+			k_mem_slab_num_free_get(i2s_cfg->mem_slab));
 		LOG_DBG("rx slab num_blocks = %d",
 			(uint32_t)i2s_cfg->mem_slab->num_blocks);
 		LOG_DBG("rx slab block_size = %d",
@@ -623,6 +623,87 @@ int json_obj_parse(char *json, size_t len,
 int json_arr_parse(char *json, size_t len,
 	const struct json_obj_descr *descr, void *val);
 
+/**
+ * @brief Perfect hash table of the field names of an object descriptor
+ *
+ * Define it with @ref JSON_OBJ_KEY_TABLE_DEFINE and build it once with
+ * json_obj_key_table_init(). json_obj_parse_table() then finds the field
+ * of each key with a hash and a single comparison, instead of comparing
+ * the key with the name of every field.
+ *
+ * @note Fields are private to the JSON library.
+ */
+struct json_obj_key_table {
+	const struct json_obj_descr *descr;
+	size_t descr_len;
+	uint16_t *slots;
+	uint8_t *seeds;
+	size_t size;
+};
+
+/**
+ * @brief Number of 32-bit words of the bitmap of decoded fields
+ *
+ * @param descr_len Number of elements in the descriptor array.
+ */
+#define JSON_OBJ_DECODED_LEN(descr_len) ceiling_fraction(descr_len, 32)
+
+/**
+ * @brief Define a perfect hash table of the field names of a descriptor
+ *
+ * The table takes 3 bytes per slot.
+ *
+ * @param name Name of the table.
+ * @param descr_ Descriptor array, whose field names must be distinct.
+ * @param size_ Number of slots, a power of 2 no less than the number of
+ *        elements in the descriptor array. Twice that number lets the
+ *        table be built quickly.
+ */
+#define JSON_OBJ_KEY_TABLE_DEFINE(name, descr_, size_)			\
+	static uint16_t _json_key_slots_##name[size_];			\
+	static uint8_t _json_key_seeds_##name[size_];			\
+	static struct json_obj_key_table name = {			\
+		.descr = (descr_),					\
+		.descr_len = ARRAY_SIZE(descr_),			\
+		.slots = _json_key_slots_##name,			\
+		.seeds = _json_key_seeds_##name,			\
+		.size = (size_),					\
+	}
+
+/**
+ * @brief Build a perfect hash table of field names
+ *
+ * @param table Table defined by @ref JSON_OBJ_KEY_TABLE_DEFINE
+ *
+ * @return 0 on success, -EINVAL if the size of the table is not valid,
+ * -ENOSPC if no perfect hash was found, e.g. for two fields of the same
+ * name.
+ */
+int json_obj_key_table_init(struct json_obj_key_table *table);
+
+/**
+ * @brief Parses the JSON-encoded object pointed to by @a json, with
+ * size @a len, according to the descriptor of a perfect hash table of
+ * its field names. Values are stored in a struct pointed to by @a val.
+ *
+ * Parsing is done as by json_obj_parse(), for descriptors of any number
+ * of fields. The fields of nested objects are matched by name as by
+ * json_obj_parse().
+ *
+ * @param json Pointer to JSON-encoded value to be parsed
+ * @param len Length of JSON-encoded value
+ * @param table Table built by json_obj_key_table_init()
+ * @param val Pointer to the struct to hold the decoded values
+ * @param decoded Bitmap of decoded fields, of
+ * JSON_OBJ_DECODED_LEN(descr_len) words (bit 0 of the first word is set
+ * if first field in the descriptor has been properly decoded, etc).
+ *
+ * @return < 0 if error, number of decoded fields on success.
+ */
+int json_obj_parse_table(char *json, size_t len,
+			 const struct json_obj_key_table *table, void *val,
+			 uint32_t *decoded);
+
 /**
  * @brief Initialize single-object array parsing
  *
@@ -312,6 +312,22 @@ typedef bool (*flash_page_cb)(const struct flash_pages_info *info, void *data);
  */
 void flash_page_foreach(const struct device *dev, flash_page_cb cb,
 			void *data);
+
+/**
+ * @brief Iterate over the flash pages of a range of a device
+ *
+ * This routine behaves like flash_page_foreach(), but only iterates over
+ * the pages overlapping the range, without going through the pages before
+ * it.
+ *
+ * @param dev Device whose pages to iterate over
+ * @param offset Offset of the range
+ * @param size Size of the range
+ * @param cb Callback to invoke for each flash page
+ * @param data Private data for callback function
+ */
+void flash_page_foreach_range(const struct device *dev, off_t offset,
+			      size_t size, flash_page_cb cb, void *data);
 #endif /* CONFIG_FLASH_PAGE_LAYOUT */
 
 #if defined(CONFIG_FLASH_JESD216_API)
@@ -76,6 +76,18 @@ struct fcb_entry_ctx {
 	/**< Flash area where the entry is placed */
 };
 
+/**
+ * @brief FCB element index entry, locating an element in its sector.
+ */
+struct fcb_index_entry {
+	uint32_t ie_elem_off;
+	/**< Offset from the start of the sector to beginning of element,
+	 * 0 for an unused entry.
+	 */
+
+	uint16_t ie_data_len; /**< Size of data area in fcb entry */
+};
+
 /**
  * @brief FCB instance structure
  *
@@ -104,6 +116,19 @@ struct fcb {
 	struct flash_sector *f_sectors;
 	/**< Array of sectors, must be contiguous */
 
+#ifdef CONFIG_FCB_INDEX
+	struct fcb_index_entry *f_index;
+	/**< Optional array of f_sector_cnt * f_index_size entries, indexing
+	 * the elements of each sector in RAM, so that iterating over them
+	 * does not read and check each element from flash. NULL for no index.
+	 */
+
+	uint16_t f_index_size;
+	/**< Number of elements indexed per sector. The elements of a sector
+	 * past the first f_index_size ones are found by reading the flash.
+	 */
+#endif
+
 	/* Flash circular buffer internal state */
 	struct k_mutex f_mtx;
 	/**< Locking for accessing the FCB data, internal state */
@@ -232,6 +257,26 @@ int fcb_walk(struct fcb *fcb, struct flash_sector *sector, fcb_walk_cb cb,
  */
 int fcb_getnext(struct fcb *fcb, struct fcb_entry *loc);
 
+/**
+ * Get previous fcb entry location.
+ *
+ * Function to obtain fcb entry location in relation to entry pointed by
+ * <p> loc, iterating from the newest entry to the oldest.
+ * If loc->fe_sector is set function fetches the entry location preceding
+ * the entry at loc->fe_elem_off.
+ * If loc->fe_sector is NULL function fetches the newest entry location within
+ * FCB storage.
+ *
+ * Without an index (see @ref fcb.f_index), each call reads the entries of
+ * the sector preceding the entry from flash.
+ *
+ * @param[in] fcb FCB instance structure.
+ * @param[in,out] loc entry location information
+ *
+ * @return 0 on success, -ENOTSUP when there is no older entry.
+ */
+int fcb_getprev(struct fcb *fcb, struct fcb_entry *loc);
+
 /**
  * Rotate fcb sectors
  *
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_FS_FS_RTIO_H_
+#define ZEPHYR_INCLUDE_FS_FS_RTIO_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/rtio/rtio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Asynchronous file I/O through RTIO
+ * @defgroup file_system_rtio File System RTIO
+ * @ingroup file_system_api
+ * @{
+ */
+
+/**
+ * @brief Operation that writes the batched data and syncs the file
+ *
+ * Only valid for file I/O devices defined by @ref FS_RTIO_FILE_DEFINE.
+ */
+#define FS_RTIO_OP_SYNC 0x80
+
+/**
+ * @brief State of a file I/O device
+ *
+ * @note Fields are private to the file system RTIO implementation.
+ */
+struct fs_rtio_file {
+	const struct rtio_iodev *iodev;
+	struct fs_file_t file;
+	struct k_work work;
+	struct k_spinlock lock;
+	uint8_t *batch;
+	size_t batch_size;
+	size_t batch_len;
+};
+
+/** @cond INTERNAL_HIDDEN */
+extern const struct rtio_iodev_api fs_rtio_api;
+/** @endcond */
+
+/**
+ * @brief Define a file I/O device
+ *
+ * Reads (@ref RTIO_OP_RX), writes (@ref RTIO_OP_TX) and syncs
+ * (@ref FS_RTIO_OP_SYNC) submitted to the device are done in order, at the
+ * current position of the file, by the file system work queue. A read
+ * completes with the number of bytes read, a write with the number of
+ * bytes written.
+ *
+ * Writes smaller than @p batch_size are copied to a batch buffer, and
+ * complete then. The batch is written to the file once full, before a read
+ * or a sync, and when the file is closed. An error writing it fails the
+ * request that caused the write.
+ *
+ * @param name Name of the I/O device.
+ * @param qsize Number of requests the device queues, must be a power of 2
+ *        and at least the number of requests in flight.
+ * @param batch_size Size of the batch buffer, 0 for no batching.
+ *
+ * @note Requests to the device must be submitted with fs_rtio_submit().
+ */
+#define FS_RTIO_FILE_DEFINE(name, qsize, batch_size)				\
+	static uint8_t _fs_rtio_batch_##name[MAX(batch_size, 1)];		\
+	static struct fs_rtio_file _fs_rtio_file_##name = {			\
+		.batch = _fs_rtio_batch_##name,					\
+		.batch_size = (batch_size),					\
+	};									\
+	RTIO_IODEV_DEFINE(name, &fs_rtio_api, qsize, &_fs_rtio_file_##name)
+
+/**
+ * @brief Prepare a sync submission
+ *
+ * @param sqe Submission to prepare.
+ * @param iodev File I/O device.
+ * @param userdata Pointer returned by the completion.
+ */
+static inline void fs_rtio_sqe_prep_sync(struct rtio_sqe *sqe,
+					 const struct rtio_iodev *iodev,
+					 void *userdata)
+{
+	sqe->op = FS_RTIO_OP_SYNC;
+	sqe->prio = RTIO_PRIO_NORM;
+	sqe->iodev = iodev;
+	sqe->buf_len = 0;
+	sqe->buf = NULL;
+	sqe->userdata = userdata;
+}
+
+/**
+ * @brief Submit requests to file I/O devices
+ *
+ * Same as rtio_submit(), for an RTIO context with requests to file I/O
+ * devices. The file system work queue completes these requests through
+ * the executor of the context, which is not thread safe, so both are
+ * serialized.
+ *
+ * @param r RTIO context.
+ * @param wait_count Number of completions to wait for.
+ *
+ * @retval 0 on success;
+ * @retval <0 negative errno code, as returned by rtio_submit().
+ */
+int fs_rtio_submit(struct rtio *r, uint32_t wait_count);
+
+/**
+ * @brief Open the file of a file I/O device
+ *
+ * @param iodev File I/O device.
+ * @param path Absolute path of the file.
+ * @param flags Mode flags, as for fs_open().
+ *
+ * @retval 0 on success;
+ * @retval -EBUSY when the device has a file open;
+ * @retval <0 other negative errno code, as returned by fs_open().
+ */
+int fs_rtio_open(const struct rtio_iodev *iodev, const char *path,
+		 fs_mode_t flags);
+
+/**
+ * @brief Close the file of a file I/O device
+ *
+ * Writes the batched data and closes the file. Must be called once all the
+ * requests submitted to the device have completed.
+ *
+ * @param iodev File I/O device.
+ *
+ * @retval 0 on success;
+ * @retval <0 negative errno code, of writing the batched data or of
+ *         fs_close().
+ */
+int fs_rtio_close(const struct rtio_iodev *iodev);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_FS_FS_RTIO_H_ */
@@ -60,6 +60,33 @@ struct nvs_fs {
 #endif
 };
 
+/**
+ * @brief Non-volatile Storage entry, as visited by nvs_walk()
+ *
+ * @param id Id of the entry
+ * @param len Length of the entry data, 0 for a deleted entry
+ * @param data_addr Address of the entry data, only valid until the next
+ * write to the file system
+ */
+struct nvs_entry {
+	uint16_t id;
+	uint16_t len;
+	uint32_t data_addr;
+};
+
+/**
+ * @brief Callback invoked by nvs_walk() for each entry
+ *
+ * @param fs Pointer to file system
+ * @param entry Entry visited
+ * @param param Parameter given to nvs_walk()
+ *
+ * @return 0 to continue the walk, any other value stops it and is returned
+ * by nvs_walk(). The callback must not write to the file system.
+ */
+typedef int (*nvs_walk_cb_t)(struct nvs_fs *fs, const struct nvs_entry *entry,
+			     void *param);
+
 /**
  * @}
  */
@@ -168,6 +195,41 @@ ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len, ui
  */
 ssize_t nvs_calc_free_space(struct nvs_fs *fs);
 
+/**
+ * @brief nvs_walk
+ *
+ * Visit every entry of the file system once, from the newest to the oldest
+ * one. The first entry visited for an id is its current version, older
+ * ones are history, and deleted entries are visited with a zero length.
+ * This reads the allocation table once, where reading each id with
+ * nvs_read() walks it once per id.
+ *
+ * @param fs Pointer to file system
+ * @param cb Callback invoked for each entry
+ * @param param Parameter passed to the callback
+ *
+ * @return 0 once all entries were visited, the value returned by the
+ * callback if it stopped the walk, or negative value of errno.h defined
+ * error codes.
+ */
+int nvs_walk(struct nvs_fs *fs, nvs_walk_cb_t cb, void *param);
+
+/**
+ * @brief nvs_entry_read
+ *
+ * Read the data of an entry visited by nvs_walk().
+ *
+ * @param fs Pointer to file system
+ * @param entry Entry to be read
+ * @param data Pointer to data buffer
+ * @param len Number of bytes to be read
+ *
+ * @return Length of the entry data, larger than the number of bytes requested when not all
+ * bytes were read. On error, returns negative value of errno.h defined error codes.
+ */
+ssize_t nvs_entry_read(struct nvs_fs *fs, const struct nvs_entry *entry,
+		       void *data, size_t len);
+
 /**
  * @}
  */
@@ -2062,6 +2062,31 @@ __syscall int k_futex_wait(struct k_futex *futex, int expected,
  */
 __syscall int k_futex_wake(struct k_futex *futex, bool wake_all);
 
+/**
+ * @brief Wake threads pending on a futex and move others to another futex
+ *
+ * Tests that the supplied futex contains the expected value, and if so,
+ * wakes up to @a num_wake of the highest priority threads pending on it,
+ * then moves up to @a num_requeue of the remaining threads to @a target,
+ * where they keep waiting with their original timeout. This lets a
+ * condition variable broadcast wake a single thread and queue the others
+ * on the associated lock, instead of having all of them contend for it.
+ *
+ * @param futex Futex to wake up pending threads.
+ * @param expected Expected value of the futex, if it is different no
+ *		   thread is woken up or moved.
+ * @param num_wake Maximum number of threads to wake up.
+ * @param target Futex to move the remaining pending threads to.
+ * @param num_requeue Maximum number of threads to move.
+ * @retval -EACCES Caller does not have access to one of the futex addresses.
+ * @retval -EAGAIN If the futex value did not match the expected parameter.
+ * @retval -EINVAL Futex parameter address not recognized by the kernel.
+ * @retval Number of threads that were woken up or moved.
+ */
+__syscall int k_futex_requeue(struct k_futex *futex, int expected,
+			      unsigned int num_wake, struct k_futex *target,
+			      unsigned int num_requeue);
+
 /** @} */
 #endif
 
@@ -2080,13 +2105,31 @@ struct k_event {
 	_wait_q_t         wait_q;
 	uint32_t          events;
 	struct k_spinlock lock;
+#ifdef CONFIG_EVENTS_WAITER_INDEX
+	/* Threads waiting for a single event, by event bit */
+	_wait_q_t         bit_wait_q[CONFIG_EVENTS_WAITER_INDEX_BUCKETS];
+#endif
 };
 
+#ifdef CONFIG_EVENTS_WAITER_INDEX
+#define Z_EVENT_BIT_WAIT_Q_INIT(i, obj) Z_WAIT_Q_INIT(&obj.bit_wait_q[i])
+
+#define Z_EVENT_INITIALIZER(obj) \
+	{ \
+	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
+	.events = 0, \
+	.bit_wait_q = { \
+		LISTIFY(CONFIG_EVENTS_WAITER_INDEX_BUCKETS, \
+			Z_EVENT_BIT_WAIT_Q_INIT, (,), obj) \
+	} \
+	}
+#else
 #define Z_EVENT_INITIALIZER(obj) \
 	{ \
 	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
 	.events = 0 \
 	}
+#endif
 
 /**
  * @brief Initialize an event object
@@ -2729,6 +2772,11 @@ struct k_mutex {
 	/** Original thread priority */
 	int owner_orig_prio;
 
+#ifdef CONFIG_MUTEX_FAST_PATH
+	/** Owner and contention flag, for lock-free uncontended access */
+	atomic_t state;
+#endif
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mutex)
 };
 
@@ -4391,6 +4439,59 @@ __syscall int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t time
  */
 __syscall int k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout);
 
+/**
+ * @brief Send several messages to a message queue.
+ *
+ * This routine sends up to @a num_msgs messages, stored back to back at
+ * @a data, to message queue @a msgq with a single lock acquisition. Waiting
+ * receivers are handed messages first, and the remaining messages are
+ * queued while there is space. If no message can be sent, the routine
+ * waits until the first one is received, then sends as many more as it
+ * can without waiting.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Pointer to the messages.
+ * @param num_msgs Number of messages to send.
+ * @param timeout Non-negative waiting period to send the first message,
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @return Number of messages sent, greater than 0, on success.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EINVAL @a num_msgs is 0.
+ */
+__syscall int k_msgq_put_batch(struct k_msgq *msgq, const void *data,
+			       uint32_t num_msgs, k_timeout_t timeout);
+
+/**
+ * @brief Receive several messages from a message queue.
+ *
+ * This routine receives up to @a num_msgs messages from message queue
+ * @a msgq in a "first in, first out" manner with a single lock
+ * acquisition, storing them back to back at @a data. The queue is then
+ * refilled from waiting senders. If the queue is empty, the routine waits
+ * for a single message.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Address of area to hold the received messages.
+ * @param num_msgs Maximum number of messages to receive.
+ * @param timeout Waiting period to receive the first message,
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @return Number of messages received, greater than 0, on success.
+ * @retval -ENOMSG Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EINVAL @a num_msgs is 0.
+ */
+__syscall int k_msgq_get_batch(struct k_msgq *msgq, void *data,
+			       uint32_t num_msgs, k_timeout_t timeout);
+
 /**
  * @brief Peek/read a message from a message queue.
  *
@@ -4636,6 +4737,10 @@ struct k_pipe {
 	size_t         bytes_used;      /**< # bytes used in buffer */
 	size_t         read_index;      /**< Where in buffer to read from */
 	size_t         write_index;     /**< Where in buffer to write */
+#ifdef CONFIG_PIPES_ZERO_COPY
+	size_t         put_claimed;     /**< # bytes claimed for writing */
+	size_t         get_claimed;     /**< # bytes claimed for reading */
+#endif
 	struct k_spinlock lock;		/**< Synchronization lock */
 
 	struct {
@@ -4827,6 +4932,141 @@ __syscall void k_pipe_flush(struct k_pipe *pipe);
  */
 __syscall void k_pipe_buffer_flush(struct k_pipe *pipe);
 
+#if defined(CONFIG_PIPES_ZERO_COPY) || defined(__DOXYGEN__)
+/**
+ * @brief Pipe transfer segment
+ *
+ * Describes one of the buffers of a vectored pipe transfer.
+ */
+struct k_pipe_vec {
+	/** Address of the segment */
+	void *data;
+	/** Size of the segment (in bytes) */
+	size_t len;
+};
+
+/**
+ * @brief Claim space in the pipe buffer for writing in place
+ *
+ * This routine provides the address of, and reserves, up to @a size bytes
+ * of contiguous free space in the pipe buffer. The writer fills the space
+ * and then passes the number of bytes written to k_pipe_put_finish().
+ * Fewer bytes than requested are claimed when the free space is smaller or
+ * wraps around the end of the pipe buffer.
+ *
+ * Only one put claim may be in progress, and the pipe must not be written
+ * to by other means until it is finished.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Address of area to hold the address of the claimed space.
+ * @param size Maximum number of bytes to claim.
+ *
+ * @return Number of bytes claimed, zero if the pipe buffer is full.
+ */
+size_t k_pipe_put_claim(struct k_pipe *pipe, uint8_t **data, size_t size);
+
+/**
+ * @brief Commit data written in place to the pipe
+ *
+ * This routine finishes the put claim in progress, making @a size bytes of
+ * the claimed space available to readers. Waiting readers are handed the
+ * data right away.
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes written to the claimed space.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL @a size exceeds the number of bytes claimed.
+ */
+int k_pipe_put_finish(struct k_pipe *pipe, size_t size);
+
+/**
+ * @brief Claim data in the pipe buffer for reading in place
+ *
+ * This routine provides the address of up to @a size bytes of contiguous
+ * data in the pipe buffer. The reader consumes the data and then passes
+ * the number of bytes consumed to k_pipe_get_finish(). Fewer bytes than
+ * requested are claimed when less data is buffered or it wraps around the
+ * end of the pipe buffer. Data held by waiting writers is not claimed.
+ *
+ * Only one get claim may be in progress, and the pipe must not be read
+ * from or flushed by other means until it is finished.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Address of area to hold the address of the claimed data.
+ * @param size Maximum number of bytes to claim.
+ *
+ * @return Number of bytes claimed, zero if the pipe buffer is empty.
+ */
+size_t k_pipe_get_claim(struct k_pipe *pipe, uint8_t **data, size_t size);
+
+/**
+ * @brief Release data read in place from the pipe
+ *
+ * This routine finishes the get claim in progress, freeing the first
+ * @a size bytes of the claimed data. The pipe buffer is then refilled from
+ * waiting writers.
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes consumed from the claimed data.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL @a size exceeds the number of bytes claimed.
+ */
+int k_pipe_get_finish(struct k_pipe *pipe, size_t size);
+
+/**
+ * @brief Write several segments of data to a pipe.
+ *
+ * This routine behaves like k_pipe_put() called with the concatenation of
+ * the @a count segments of @a vec, without copying them together first.
+ * The pipe is locked once for all the segments that can be written
+ * without waiting.
+ *
+ * @param pipe Address of the pipe.
+ * @param vec Segments to write.
+ * @param count Number of segments.
+ * @param bytes_written Address of area to hold the number of bytes written.
+ * @param min_xfer Minimum number of bytes to write.
+ * @param timeout Waiting period to wait for the data to be written,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 At least @a min_xfer bytes of data were written.
+ * @retval -EINVAL invalid parameters supplied
+ * @retval -EIO Returned without waiting; zero data bytes were written.
+ * @retval -EAGAIN Waiting period timed out; between zero and @a min_xfer
+ *                 minus one data bytes were written.
+ */
+int k_pipe_put_vec(struct k_pipe *pipe, const struct k_pipe_vec *vec,
+		   size_t count, size_t *bytes_written, size_t min_xfer,
+		   k_timeout_t timeout);
+
+/**
+ * @brief Read data from a pipe into several segments.
+ *
+ * This routine behaves like k_pipe_get() called with a buffer made of the
+ * @a count segments of @a vec, filled in order. The pipe is locked once
+ * for all the segments that can be read without waiting.
+ *
+ * @param pipe Address of the pipe.
+ * @param vec Segments to fill.
+ * @param count Number of segments.
+ * @param bytes_read Address of area to hold the number of bytes read.
+ * @param min_xfer Minimum number of data bytes to read.
+ * @param timeout Waiting period to wait for the data to be read,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 At least @a min_xfer bytes of data were read.
+ * @retval -EINVAL invalid parameters supplied
+ * @retval -EIO Returned without waiting; zero data bytes were read.
+ * @retval -EAGAIN Waiting period timed out; between zero and @a min_xfer
+ *                 minus one data bytes were read.
+ */
+int k_pipe_get_vec(struct k_pipe *pipe, const struct k_pipe_vec *vec,
+		   size_t count, size_t *bytes_read, size_t min_xfer,
+		   k_timeout_t timeout);
+#endif /* CONFIG_PIPES_ZERO_COPY */
+
 /** @} */
 
 /**
@@ -4840,9 +5080,20 @@ struct k_mem_slab {
 	size_t block_size;
 	char *buffer;
 	char *free_list;
+#ifdef CONFIG_MEM_SLAB_LOCKLESS
+	/* Lock-free stack of free blocks, used instead of free_list */
+	uint64_t free_head __aligned(8);
+	/* Number of threads looking for a block under the lock */
+	atomic_t waiters;
+	atomic_t num_used;
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	atomic_t max_used;
+#endif
+#else
 	uint32_t num_used;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	uint32_t max_used;
+#endif
 #endif
 
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mem_slab)
@@ -4996,7 +5247,11 @@ extern void k_mem_slab_free(struct k_mem_slab *slab, void **mem);
  */
 static inline uint32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
 {
+#ifdef CONFIG_MEM_SLAB_LOCKLESS
+	return (uint32_t)atomic_get(&slab->num_used);
+#else
 	return slab->num_used;
+#endif
 }
 
 /**
@@ -5011,7 +5266,9 @@ static inline uint32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
  */
 static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
 {
-#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+#if defined(CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION) && defined(CONFIG_MEM_SLAB_LOCKLESS)
+	return (uint32_t)atomic_get(&slab->max_used);
+#elif defined(CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION)
 	return slab->max_used;
 #else
 	ARG_UNUSED(slab);
@@ -5031,7 +5288,7 @@ static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
  */
 static inline uint32_t k_mem_slab_num_free_get(struct k_mem_slab *slab)
 {
-	return slab->num_blocks - slab->num_used;
+	return slab->num_blocks - k_mem_slab_num_used_get(slab);
 }
 
 /**
@@ -78,11 +78,28 @@ extern "C" {
  */
 typedef int (*log_output_func_t)(uint8_t *buf, size_t size, void *ctx);
 
+#ifdef CONFIG_LOG_DICTIONARY_COMPACT
+/* @brief State of the compact dictionary-based log stream of an instance. */
+struct log_output_dict_state {
+	log_timestamp_t timestamp;
+	uint32_t source;
+	bool source_valid;
+#ifdef CONFIG_LOG_DICTIONARY_COMPACT_COMPRESS
+	uint16_t hist_len;
+	uint16_t hash[256];
+	uint8_t hist[2 * CONFIG_LOG_DICTIONARY_COMPACT_WINDOW];
+#endif
+};
+#endif
+
 /* @brief Control block structure for log_output instance.  */
 struct log_output_control_block {
 	atomic_t offset;
 	void *ctx;
 	const char *hostname;
+#ifdef CONFIG_LOG_DICTIONARY_COMPACT
+	struct log_output_dict_state dict;
+#endif
 };
 
 /** @brief Log_output instance structure. */
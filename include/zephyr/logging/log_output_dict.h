@@ -23,6 +23,8 @@ extern "C" {
 enum log_dict_output_msg_type {
 	MSG_NORMAL = 0,
 	MSG_DROPPED_MSG = 1,
+	MSG_NORMAL_COMPACT = 2,
+	MSG_COMPRESSED = 3,
 };
 
 /**
@@ -38,6 +40,51 @@ struct log_dict_output_normal_msg_hdr_t {
 	log_timestamp_t timestamp;
 } __packed;
 
+/**
+ * Flags of the descriptor byte of a compact dictionary based log message.
+ *
+ * A compact message (@ref MSG_NORMAL_COMPACT) is made of:
+ *
+ * - the message type byte;
+ * - a descriptor byte, with the domain in bits 0-2, the level in bits 3-5
+ *   and the flags below;
+ * - the difference with the timestamp of the previous compact message,
+ *   modulo the width of the timestamp;
+ * - the source ID, unless @ref LOG_DICT_COMPACT_SAME_SOURCE is set;
+ * - the length of the package;
+ * - the length of the data, if @ref LOG_DICT_COMPACT_HAS_DATA is set;
+ * - the words of the package holding its header and arguments, in the CPU
+ *   byte order;
+ * - the rest of the package and the data, unchanged.
+ *
+ * All the values but the descriptor and the rest of the package and data
+ * are encoded as variable length integers, 7 bits per byte from the least
+ * significant ones, with bit 7 set on all bytes but the last one.
+ */
+#define LOG_DICT_COMPACT_SAME_SOURCE BIT(6)
+#define LOG_DICT_COMPACT_HAS_DATA BIT(7)
+
+/**
+ * A compressed message (@ref MSG_COMPRESSED) is made of the message type
+ * byte, the length of the compact message it holds as a variable length
+ * integer, and sequences of:
+ *
+ * - a token byte, with the number of literals in bits 4-7 and the length of
+ *   the match minus @ref LOG_DICT_COMPRESS_MIN_MATCH in bits 0-3;
+ * - when the number of literals is 15, bytes added to it until one is
+ *   below 255;
+ * - the literals;
+ * - the distance of the match back in the stream, as 16 bits in little
+ *   endian order;
+ * - when the length of the match is 15, bytes added to it until one is
+ *   below 255.
+ *
+ * The last sequence ends after its literals if they complete the message.
+ * The stream matches are found in is made of the compact messages, either
+ * sent as such or compressed.
+ */
+#define LOG_DICT_COMPRESS_MIN_MATCH 4
+
 /**
  * Output for one dictionary based log message about
  * dropped messages.
@@ -324,6 +324,45 @@ int settings_save_one(const char *name, const void *value, size_t val_len);
  */
 int settings_delete(const char *name);
 
+/**
+ * Write the values held in the write-back cache to persisted storage.
+ *
+ * With CONFIG_SETTINGS_WRITE_BACK, @ref settings_save_one and
+ * @ref settings_delete keep the value in RAM, and it only survives a power
+ * loss once it has been written to persisted storage. Values are written in
+ * the order their key was first saved since the previous flush, and each
+ * of them is written like with @ref settings_save_one without the cache.
+ * Call this function before a reset or a power down.
+ *
+ * Does nothing without CONFIG_SETTINGS_WRITE_BACK.
+ *
+ * @return 0 on success, non-zero on failure. Values which could not be
+ * written stay in the cache.
+ */
+int settings_save_flush(void);
+
+#if defined(CONFIG_SETTINGS_WRITE_BACK) || defined(__DOXYGEN__)
+/**
+ * Write-back cache statistics.
+ *
+ * The coalescing ratio of the cache is saves / writes.
+ */
+struct settings_save_stats {
+	/** Number of values saved and deleted. */
+	uint32_t saves;
+	/** Number of values written to and deleted from persisted storage. */
+	uint32_t writes;
+};
+
+/**
+ * Get the write-back cache statistics.
+ *
+ * @param[out] stats Statistics since the settings subsystem was
+ * initialized.
+ */
+void settings_save_stats_get(struct settings_save_stats *stats);
+#endif /* CONFIG_SETTINGS_WRITE_BACK */
+
 /**
  * Call commit for all settings handler. This should apply all
  * settings which has been set, but not applied yet.
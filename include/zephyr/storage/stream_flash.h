@@ -23,6 +23,9 @@
 
 #include <stdbool.h>
 #include <zephyr/drivers/flash.h>
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+#include <zephyr/kernel.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -45,6 +48,22 @@ extern "C" {
  */
 typedef int (*stream_flash_callback_t)(uint8_t *buf, size_t len, size_t offset);
 
+/**
+ * @brief Statistics of a double-buffered stream flash context
+ */
+struct stream_flash_stats {
+	/** Number of buffers programmed */
+	uint32_t buffers;
+	/** Number of bytes programmed */
+	size_t bytes;
+	/** Number of pages erased */
+	uint32_t erases;
+	/** Time spent erasing, programming and reading back, in microseconds */
+	uint32_t flash_us;
+	/** Time writes waited for the previous buffer, in microseconds */
+	uint32_t wait_us;
+};
+
 /**
  * @brief Structure for stream flash context
  *
@@ -63,6 +82,19 @@ struct stream_flash_ctx {
 #ifdef CONFIG_STREAM_FLASH_ERASE
 	off_t last_erased_page_start_offset; /* Last erased offset */
 #endif
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+	uint8_t *pipe_buf; /* Buffer being programmed, NULL if not pipelined */
+	size_t pipe_bytes; /* Number of bytes in pipe_buf */
+	size_t pipe_addr; /* Address pipe_buf is programmed to */
+	size_t pipe_submitted; /* Bytes written and being written */
+	int pipe_error; /* First error of the work queue */
+	struct k_work pipe_work;
+	struct k_sem pipe_idle; /* Available while pipe_buf is not in use */
+	struct stream_flash_stats stats;
+#ifdef CONFIG_STREAM_FLASH_PIPELINE_CRC
+	uint32_t crc; /* CRC-32 of the data read back */
+#endif
+#endif
 };
 
 /**
@@ -87,6 +119,9 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 /**
  * @brief Read number of bytes written to the flash.
  *
+ * For a double-buffered context, a buffer is counted once a later write,
+ * flush or @ref stream_flash_crc32 has waited for it to be programmed.
+ *
  * @note api-tags: pre-kernel-ok isr-ok
  *
  * @param ctx context
@@ -115,12 +150,68 @@ size_t stream_flash_bytes_written(struct stream_flash_ctx *ctx);
 int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *data,
 				size_t len, bool flush);
 
+/**
+ * @brief Enable double-buffered writes on a context.
+ *
+ * Once enabled, a buffer filled by @ref stream_flash_buffered_write is
+ * handed over to a work queue thread, which erases the page it goes to if
+ * needed, programs it, reads it back for the callback and then erases the
+ * page the next buffer goes to, while writes fill @p buf2. Writes only wait
+ * when both buffers are full. A flushing write waits for all data to be
+ * programmed.
+ *
+ * The callback is invoked from the work queue thread. An error of the work
+ * queue thread is returned by the next write, after which the context must
+ * be initialized again.
+ *
+ * Must be called after @ref stream_flash_init and
+ * @ref stream_flash_progress_load, before writing any data.
+ *
+ * @param ctx context
+ * @param buf2 Second write buffer, of the length of the buffer given to
+ *             @ref stream_flash_init.
+ *
+ * @return non-negative on success, negative errno code on fail
+ */
+int stream_flash_pipeline_init(struct stream_flash_ctx *ctx, uint8_t *buf2);
+
+/**
+ * @brief Get the statistics of a double-buffered context.
+ *
+ * The write throughput is the number of bytes programmed over the time
+ * spent writing them, and the time writes waited for the previous buffer
+ * is the part of flash operations which is not overlapped with the writer.
+ * Waits for the buffer being programmed, if any.
+ *
+ * @param ctx context
+ * @param stats statistics since @ref stream_flash_pipeline_init, or since
+ *              @ref stream_flash_init for a context which is not
+ *              double-buffered, where only erases are counted
+ */
+void stream_flash_stats_get(struct stream_flash_ctx *ctx,
+			    struct stream_flash_stats *stats);
+
+/**
+ * @brief Get the CRC-32 of the data written.
+ *
+ * Waits for the data submitted to be programmed, and returns the IEEE
+ * CRC-32 of the data read back from flash since
+ * @ref stream_flash_pipeline_init.
+ *
+ * @param ctx context
+ * @param crc CRC-32 of the data written
+ *
+ * @return non-negative on success, negative errno code on fail
+ */
+int stream_flash_crc32(struct stream_flash_ctx *ctx, uint32_t *crc);
+
 /**
  * @brief Erase the flash page to which a given offset belongs.
  *
  * This function erases a flash page to which an offset belongs if this page
  * is not the page previously erased by the provided ctx
- * (ctx->last_erased_page_start_offset).
+ * (ctx->last_erased_page_start_offset). For a double-buffered context, it
+ * waits for the buffer being programmed first.
  *
  * @param ctx context
  * @param off offset from the base address of the flash device
@@ -307,6 +307,21 @@ typedef int (*cbprintf_cb)(/* int c, void *ctx */);
  */
 typedef int (*cbprintf_convert_cb)(const void *buf, size_t len, void *ctx);
 
+/** @brief Signature for a cbprintf span callback function.
+ *
+ * Emits a run of generated characters at once, as if each was passed to
+ * the cbprintf callback function in turn.
+ *
+ * @param buf characters to output, not NUL-terminated.
+ * @param len number of characters.
+ * @param ctx a pointer to an object that provides context for the
+ * output operation.
+ *
+ * @return a non-negative value, or a negative error code that will be
+ * returned from cbvprintf_span().
+ */
+typedef int (*cbprintf_span_cb)(const char *buf, size_t len, void *ctx);
+
 /** @brief Signature for a external formatter function identical to cbvprintf.
  *
  * This function expects the following parameters:
@@ -707,6 +722,31 @@ int cbprintf(cbprintf_cb out, void *ctx, const char *format, ...);
 int z_cbvprintf_impl(cbprintf_cb out, void *ctx, const char *format,
 		     va_list ap, uint32_t flags);
 
+/** @brief Internal implementation of cbvprintf_span().
+ *
+ * As z_cbvprintf_impl(), with runs of characters emitted through @p span.
+ *
+ * @param out the function used to emit each generated character.
+ *
+ * @param span the function used to emit runs of generated characters, or
+ * NULL to emit each character through @p out.
+ *
+ * @param ctx context provided when invoking out or span
+ *
+ * @param format a standard ISO C format string with characters and conversion
+ * specifications.
+ *
+ * @param ap a reference to the values to be converted.
+ *
+ * @param flags flags on how to process the inputs.
+ *              @see Z_CBVPRINTF_PROCESS_FLAGS.
+ *
+ * @return the number of characters generated, or a negative error value
+ * returned from invoking @p out or @p span.
+ */
+int z_cbvprintf_span_impl(cbprintf_cb out, cbprintf_span_cb span, void *ctx,
+			  const char *format, va_list ap, uint32_t flags);
+
 /** @brief varargs-aware *printf-like output through a callback.
  *
  * This is essentially vsprintf() except the output is generated
@@ -777,6 +817,64 @@ int cbvprintf_tagged_args(cbprintf_cb out, void *ctx,
 				Z_CBVPRINTF_PROCESS_FLAG_TAGGED_ARGS);
 }
 
+/** @brief varargs-aware *printf-like output through span and character
+ * callbacks.
+ *
+ * This is cbvprintf() except that runs of literal characters and of
+ * converted values are emitted at once using the provided @p span
+ * function, which saves a call per character. Padding and other single
+ * characters are emitted using @p out.
+ *
+ * @note Each character is emitted using @p out when
+ * @kconfig{CONFIG_CBPRINTF_NANO} is selected.
+ *
+ * @param out the function used to emit each generated character.
+ *
+ * @param span the function used to emit runs of generated characters.
+ *
+ * @param ctx context provided when invoking out or span
+ *
+ * @param format a standard ISO C format string with characters and conversion
+ * specifications.
+ *
+ * @param ap a reference to the values to be converted.
+ *
+ * @return the number of characters generated, or a negative error value
+ * returned from invoking @p out or @p span.
+ */
+static inline
+int cbvprintf_span(cbprintf_cb out, cbprintf_span_cb span, void *ctx,
+		   const char *format, va_list ap)
+{
+	return z_cbvprintf_span_impl(out, span, ctx, format, ap, 0);
+}
+
+/** @brief cbvprintf_span() with tagged arguments.
+ *
+ * @see cbvprintf_span() and cbvprintf_tagged_args().
+ *
+ * @param out the function used to emit each generated character.
+ *
+ * @param span the function used to emit runs of generated characters.
+ *
+ * @param ctx context provided when invoking out or span
+ *
+ * @param format a standard ISO C format string with characters and conversion
+ * specifications.
+ *
+ * @param ap a reference to the tagged values to be converted.
+ *
+ * @return the number of characters generated, or a negative error value
+ * returned from invoking @p out or @p span.
+ */
+static inline
+int cbvprintf_span_tagged_args(cbprintf_cb out, cbprintf_span_cb span,
+			       void *ctx, const char *format, va_list ap)
+{
+	return z_cbvprintf_span_impl(out, span, ctx, format, ap,
+				     Z_CBVPRINTF_PROCESS_FLAG_TAGGED_ARGS);
+}
+
 /** @brief Generate the output for a previously captured format
  * operation.
  *
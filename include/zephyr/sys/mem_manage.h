@@ -119,7 +119,26 @@ struct k_mem_paging_stats_t {
 
 		/** Number of dirty pages selected for eviction */
 		unsigned long			dirty;
+
+		/** Number of page frames examined to select pages for eviction */
+		unsigned long			scanned;
+
+		/** Most page frames examined to select a single page */
+		unsigned long			scanned_max;
 	} eviction;
+
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+	struct {
+		/** Number of data pages brought in ahead of page faults */
+		unsigned long			pages;
+
+		/**
+		 * Number of data pages read ahead that were accessed before
+		 * the next page fault
+		 */
+		unsigned long			hits;
+	} read_ahead;
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 };
 
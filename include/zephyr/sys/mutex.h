@@ -11,8 +11,8 @@
  * sys_mutex behaves almost exactly like k_mutex, with the added advantage
  * that a sys_mutex instance can reside in user memory.
  *
- * Further enhancements will support locking/unlocking uncontended sys_mutexes
- * with simple atomic ops instead of syscalls, similar to Linux's
+ * With CONFIG_SYS_MUTEX_FAST_PATH, uncontended sys_mutexes are locked and
+ * unlocked with simple atomic ops instead of syscalls, similar to Linux's
  * FUTEX_LOCK_PI and FUTEX_UNLOCK_PI
  */
 
@@ -24,11 +24,13 @@ extern "C" {
 #include <zephyr/sys/atomic.h>
 #include <zephyr/types.h>
 #include <zephyr/sys_clock.h>
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+#include <zephyr/kernel.h>
+#endif
 
 struct sys_mutex {
-	/* Currently unused, but will be used to store state for fast mutexes
-	 * that can be locked/unlocked with atomic ops if there is no
-	 * contention
+	/* With CONFIG_SYS_MUTEX_FAST_PATH, the owner thread while locked
+	 * without contention, see lib/os/mutex.c
 	 */
 	atomic_t val;
 };
@@ -101,7 +103,13 @@ __syscall int z_sys_mutex_kernel_unlock(struct sys_mutex *mutex);
  */
 static inline int sys_mutex_lock(struct sys_mutex *mutex, k_timeout_t timeout)
 {
-	/* For now, make the syscall unconditionally */
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+	if (likely(atomic_cas(&mutex->val, 0,
+			      (atomic_val_t)k_current_get()))) {
+		return 0;
+	}
+#endif
+
 	return z_sys_mutex_kernel_lock(mutex, timeout);
 }
 
@@ -124,7 +132,13 @@ static inline int sys_mutex_lock(struct sys_mutex *mutex, k_timeout_t timeout)
  */
 static inline int sys_mutex_unlock(struct sys_mutex *mutex)
 {
-	/* For now, make the syscall unconditionally */
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+	if (likely(atomic_cas(&mutex->val, (atomic_val_t)k_current_get(),
+			      0))) {
+		return 0;
+	}
+#endif
+
 	return z_sys_mutex_kernel_unlock(mutex);
 }
 
@@ -34,6 +34,8 @@ struct sys_sem {
 #ifdef CONFIG_USERSPACE
 	struct k_futex futex;
 	int limit;
+	/* Threads in sys_sem_take() that found no count */
+	atomic_t waiters;
 #else
 	struct k_sem kernel_sem;
 #endif
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef ZEPHYR_INCLUDE_SYS_WSQ_H_
+#define ZEPHYR_INCLUDE_SYS_WSQ_H_
+
+#include <zephyr/kernel.h>
+
+/* Zephyr Work-Stealing Work Queues */
+
+struct k_wsq;
+struct k_wsq_work;
+struct k_wsq_worker;
+
+/**
+ * Work-stealing queue handler callback
+ */
+typedef void (*k_wsq_handler_t)(struct k_wsq_work *work);
+
+/**
+ * @brief Work-stealing queue work item
+ *
+ * Must be initialized with k_wsq_work_init() before first use.
+ */
+struct k_wsq_work {
+	/* Filled out by k_wsq_work_init() */
+	k_wsq_handler_t handler;
+
+	/* reserved for implementation */
+	sys_dnode_t node;
+	struct k_spinlock lock;
+	struct k_wsq_worker *worker;
+	sys_slist_t waiters;
+	atomic_t flags;
+};
+
+/**
+ * @brief Work-stealing queue work item synchronization object
+ *
+ * Provided by the caller of k_wsq_flush() and k_wsq_cancel_sync(), which
+ * wait on it. It must stay valid until these return.
+ */
+struct k_wsq_work_sync {
+	/* reserved for implementation */
+	sys_snode_t node;
+	struct k_sem sem;
+};
+
+/* Worker thread and the deque of work items it owns */
+struct k_wsq_worker {
+	struct k_spinlock lock;
+	sys_dlist_t deque;
+	struct k_wsq *queue;
+	struct k_thread thread;
+};
+
+/**
+ * @brief Work-stealing queue
+ *
+ * Work queue serviced by one worker thread per CPU. Each worker owns a
+ * deque of work items, and workers with an empty deque steal work items
+ * from the others.
+ */
+struct k_wsq {
+	struct k_wsq_worker workers[CONFIG_MP_MAX_NUM_CPUS];
+	unsigned int num_workers;
+
+	/* Idle workers sleep on the semaphore */
+	atomic_t idle;
+	struct k_sem wake;
+
+	/* Worker thread stacks */
+	struct z_thread_stack_element *stacks;
+	size_t stack_size;
+};
+
+/**
+ * @brief Statically define a work-stealing queue
+ *
+ * Defines a struct k_wsq object along with stacks for one worker thread
+ * per CPU. The worker threads are created by k_wsq_start().
+ *
+ * @param name Symbol name of the struct k_wsq that will be defined
+ * @param stack_sz Requested stack size of each worker thread, in bytes
+ */
+#define K_WSQ_DEFINE(name, stack_sz)					\
+	static K_THREAD_STACK_ARRAY_DEFINE(_wsqstacks_##name,		\
+					   CONFIG_MP_MAX_NUM_CPUS,	\
+					   stack_sz);			\
+	static struct k_wsq name = {					\
+		.stacks = &(_wsqstacks_##name[0][0]),			\
+		.stack_size = stack_sz,					\
+	}
+
+/**
+ * @brief Start a work-stealing queue
+ *
+ * Creates and starts one worker thread per CPU. With
+ * CONFIG_SCHED_CPU_MASK enabled, each worker thread is pinned to its CPU.
+ *
+ * @param queue Work-stealing queue defined with K_WSQ_DEFINE()
+ * @param prio Priority of the worker threads
+ */
+void k_wsq_start(struct k_wsq *queue, int prio);
+
+/**
+ * @brief Initialize a work-stealing queue work item
+ *
+ * @param work Work item to initialize
+ * @param handler Handler to invoke when the work item is processed
+ */
+void k_wsq_work_init(struct k_wsq_work *work, k_wsq_handler_t handler);
+
+/**
+ * @brief Submit a work item to a work-stealing queue
+ *
+ * Behaves like k_work_submit_to_queue(). The work item is queued on the
+ * deque of the worker of the calling CPU, and may be processed by any
+ * worker. There is no ordering guarantee between work items. A work item
+ * submitted while its handler is running is queued again once the handler
+ * returns, so a handler never runs on two workers at once.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param queue Work-stealing queue to which to submit
+ * @param work Work item to submit
+ *
+ * @retval 0 if work was already queued.
+ * @retval 1 if work was not queued and has been queued.
+ * @retval 2 if work was running and has been queued again.
+ * @retval -EBUSY if work is being canceled.
+ */
+int k_wsq_submit(struct k_wsq *queue, struct k_wsq_work *work);
+
+/**
+ * @brief Cancel a work item
+ *
+ * Behaves like k_work_cancel(). Removes the work item from the queue if it
+ * is queued. A running handler is not interrupted.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param work Work item to cancel
+ *
+ * @return Combination of K_WORK_RUNNING and K_WORK_CANCELING bits for the
+ * state of the work item after cancellation, 0 if it is idle.
+ */
+int k_wsq_cancel(struct k_wsq_work *work);
+
+/**
+ * @brief Cancel a work item and wait for it to be idle
+ *
+ * Behaves like k_work_cancel_sync(). Must not be called from the handler
+ * of the work item.
+ *
+ * @param work Work item to cancel
+ * @param sync Synchronization object used while waiting
+ *
+ * @return true if the work item was queued or running
+ */
+bool k_wsq_cancel_sync(struct k_wsq_work *work, struct k_wsq_work_sync *sync);
+
+/**
+ * @brief Wait for a work item to be processed
+ *
+ * Behaves like k_work_flush(): waits until the work item is neither queued
+ * nor running. Must not be called from the handler of the work item.
+ *
+ * @param work Work item to flush
+ * @param sync Synchronization object used while waiting
+ *
+ * @return true if the call had to wait
+ */
+bool k_wsq_flush(struct k_wsq_work *work, struct k_wsq_work_sync *sync);
+
+#endif /* ZEPHYR_INCLUDE_SYS_WSQ_H_ */
@@ -15,6 +15,11 @@
  * conditions match the current set of events now belonging to the event object
  * are awakened.
  *
+ * If CONFIG_EVENTS_WAITER_INDEX is enabled, threads waiting for a single event
+ * are pended on a wait queue selected by the event bit instead, and only the
+ * wait queues of the posted events are processed along with the wait queue of
+ * threads waiting for several events.
+ *
  * Threads waiting on an event object have the option of either waking once
  * any or all of the events it desires have been posted to the event object.
  *
@@ -48,6 +53,12 @@ void z_impl_k_event_init(struct k_event *event)
 
 	z_waitq_init(&event->wait_q);
 
+#ifdef CONFIG_EVENTS_WAITER_INDEX
+	for (int i = 0; i < CONFIG_EVENTS_WAITER_INDEX_BUCKETS; i++) {
+		z_waitq_init(&event->bit_wait_q[i]);
+	}
+#endif
+
 	z_object_init(event);
 }
 
@@ -84,12 +95,79 @@ static bool are_wait_conditions_met(uint32_t desired, uint32_t current,
 	return match != 0;
 }
 
+/**
+ * @brief add the threads whose wait conditions are met to a list
+ *
+ * This routine adds the threads pended on @a wait_q whose wait conditions are
+ * satisfied by the @a current set of events to the list of threads to unpend
+ * starting at @a head, and returns the new head of the list.
+ */
+static struct k_thread *event_waiters_collect(_wait_q_t *wait_q,
+					      uint32_t current,
+					      struct k_thread *head)
+{
+	struct k_thread  *thread;
+	unsigned int      wait_condition;
+
+	_WAIT_Q_FOR_EACH(wait_q, thread) {
+		wait_condition = thread->event_options & K_EVENT_WAIT_MASK;
+
+		if (are_wait_conditions_met(thread->events, current,
+					    wait_condition)) {
+			/*
+			 * The wait conditions have been satisfied. Add this
+			 * thread to the list of threads to unpend.
+			 */
+
+			thread->next_event_link = head;
+			head = thread;
+		}
+	}
+
+	return head;
+}
+
+#ifdef CONFIG_EVENTS_WAITER_INDEX
+static _wait_q_t *event_bit_wait_q(struct k_event *event, unsigned int bit)
+{
+	return &event->bit_wait_q[bit % CONFIG_EVENTS_WAITER_INDEX_BUCKETS];
+}
+
+/**
+ * @brief add the single event waiters woken by a post to a list
+ *
+ * Threads waiting for a single event can only be woken by posting that
+ * event, so only the wait queues of the events set by the post are examined.
+ */
+static struct k_thread *event_bit_waiters_collect(struct k_event *event,
+						  uint32_t posted,
+						  uint32_t current,
+						  struct k_thread *head)
+{
+	uint32_t  buckets = 0;
+
+	while (posted != 0) {
+		buckets |= BIT((find_lsb_set(posted) - 1) %
+			       CONFIG_EVENTS_WAITER_INDEX_BUCKETS);
+		posted &= posted - 1;
+	}
+
+	while (buckets != 0) {
+		head = event_waiters_collect(
+			&event->bit_wait_q[find_lsb_set(buckets) - 1],
+			current, head);
+		buckets &= buckets - 1;
+	}
+
+	return head;
+}
+#endif
+
 static void k_event_post_internal(struct k_event *event, uint32_t events,
 				  uint32_t events_mask)
 {
 	k_spinlock_key_t  key;
 	struct k_thread  *thread;
-	unsigned int      wait_condition;
 	struct k_thread  *head = NULL;
 
 	key = k_spin_lock(&event->lock);
@@ -112,22 +190,12 @@ static void k_event_post_internal(struct k_event *event, uint32_t events,
 	 * 3. Ready each of the threads in the linked list
 	 */
 
-	_WAIT_Q_FOR_EACH(&event->wait_q, thread) {
-		wait_condition = thread->event_options & K_EVENT_WAIT_MASK;
+	head = event_waiters_collect(&event->wait_q, events, head);
 
-		if (are_wait_conditions_met(thread->events, events,
-					    wait_condition)) {
-			/*
-			 * The wait conditions have been satisfied. Add this
-			 * thread to the list of threads to unpend.
-			 */
-
-			thread->next_event_link = head;
-			head = thread;
-		}
-
-
-	}
+#ifdef CONFIG_EVENTS_WAITER_INDEX
+	head = event_bit_waiters_collect(event, events & events_mask, events,
+					 head);
+#endif
 
 	if (head != NULL) {
 		thread = head;
@@ -196,6 +264,7 @@ static uint32_t k_event_wait_internal(struct k_event *event, uint32_t events,
 	uint32_t  rv = 0;
 	unsigned int  wait_condition;
 	struct k_thread  *thread;
+	_wait_q_t  *wait_q = &event->wait_q;
 
 	__ASSERT(((arch_is_in_isr() == false) ||
 		  K_TIMEOUT_EQ(timeout, K_NO_WAIT)), "");
@@ -241,10 +310,17 @@ static uint32_t k_event_wait_internal(struct k_event *event, uint32_t events,
 	thread->events = events;
 	thread->event_options = options;
 
+#ifdef CONFIG_EVENTS_WAITER_INDEX
+	/* Waiting for any or all of a single event is the same */
+	if ((events & (events - 1)) == 0) {
+		wait_q = event_bit_wait_q(event, find_lsb_set(events) - 1);
+	}
+#endif
+
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_event, wait, event, events,
 					   options, timeout);
 
-	if (z_pend_curr(&event->lock, key, &event->wait_q, timeout) == 0) {
+	if (z_pend_curr(&event->lock, key, wait_q, timeout) == 0) {
 		/* Retrieve the set of events that woke the thread */
 		rv = thread->events;
 	}
@@ -74,12 +74,16 @@ int z_impl_k_futex_wait(struct k_futex *futex, int expected,
 		return -EINVAL;
 	}
 
+	key = k_spin_lock(&futex_data->lock);
+
+	/* Checked under the lock, so that a waker changing the value before
+	 * calling k_futex_wake() either is seen here or finds us pended.
+	 */
 	if (atomic_get(&futex->val) != (atomic_val_t)expected) {
+		k_spin_unlock(&futex_data->lock, key);
 		return -EAGAIN;
 	}
 
-	key = k_spin_lock(&futex_data->lock);
-
 	ret = z_pend_curr(&futex_data->lock,
 			key, &futex_data->wait_q, timeout);
 	if (ret == -EAGAIN) {
@@ -99,3 +103,86 @@ static inline int z_vrfy_k_futex_wait(struct k_futex *futex, int expected,
 	return z_impl_k_futex_wait(futex, expected, timeout);
 }
 #include <syscalls/k_futex_wait_mrsh.c>
+
+int z_impl_k_futex_requeue(struct k_futex *futex, int expected,
+			   unsigned int num_wake, struct k_futex *target,
+			   unsigned int num_requeue)
+{
+	k_spinlock_key_t key, target_key;
+	struct z_futex_data *futex_data, *target_data;
+	struct k_spinlock *first, *second;
+	struct k_thread *thread;
+	unsigned int woken = 0U;
+	unsigned int moved = 0U;
+
+	futex_data = k_futex_find_data(futex);
+	target_data = k_futex_find_data(target);
+	if (futex_data == NULL || target_data == NULL) {
+		return -EINVAL;
+	}
+
+	if (futex_data == target_data) {
+		num_requeue = 0U;
+	}
+
+	/* Lock both futexes in address order */
+	if (futex_data <= target_data) {
+		first = &futex_data->lock;
+		second = &target_data->lock;
+	} else {
+		first = &target_data->lock;
+		second = &futex_data->lock;
+	}
+
+	key = k_spin_lock(first);
+	target_key = (first != second) ? k_spin_lock(second) : key;
+
+	if (atomic_get(&futex->val) != (atomic_val_t)expected) {
+		if (first != second) {
+			k_spin_unlock(second, target_key);
+		}
+		k_spin_unlock(first, key);
+		return -EAGAIN;
+	}
+
+	while (woken < num_wake) {
+		thread = z_unpend_first_thread(&futex_data->wait_q);
+		if (thread == NULL) {
+			break;
+		}
+		woken++;
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+	}
+
+	while (moved < num_requeue) {
+		thread = z_requeue_first_thread(&futex_data->wait_q,
+						&target_data->wait_q);
+		if (thread == NULL) {
+			break;
+		}
+		moved++;
+	}
+
+	if (first != second) {
+		k_spin_unlock(second, target_key);
+	}
+	z_reschedule(first, key);
+
+	return woken + moved;
+}
+
+static inline int z_vrfy_k_futex_requeue(struct k_futex *futex, int expected,
+					 unsigned int num_wake,
+					 struct k_futex *target,
+					 unsigned int num_requeue)
+{
+	if (Z_SYSCALL_MEMORY_WRITE(futex, sizeof(struct k_futex)) != 0 ||
+	    Z_SYSCALL_MEMORY_WRITE(target, sizeof(struct k_futex)) != 0) {
+		return -EACCES;
+	}
+
+	return z_impl_k_futex_requeue(futex, expected, num_wake, target,
+				      num_requeue);
+}
+#include <syscalls/k_futex_requeue_mrsh.c>
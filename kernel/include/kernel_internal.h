@@ -119,6 +119,13 @@ extern void z_thread_monitor_exit(struct k_thread *thread);
 	} while (false)
 #endif /* CONFIG_THREAD_MONITOR */
 
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+/* Lock an unlocked mutex on behalf of another thread, used to hand over
+ * a sys_mutex locked from user space to its kernel mutex.
+ */
+int z_mutex_lock_for(struct k_mutex *mutex, struct k_thread *owner);
+#endif
+
 #ifdef CONFIG_USE_SWITCH
 /* This is a arch function traditionally, but when the switch-based
  * z_swap() is in use it's a simple inline provided by the kernel.
@@ -49,6 +49,7 @@ void z_pend_thread(struct k_thread *thread, _wait_q_t *wait_q,
 void z_reschedule(struct k_spinlock *lock, k_spinlock_key_t key);
 void z_reschedule_irqlock(uint32_t key);
 struct k_thread *z_unpend_first_thread(_wait_q_t *wait_q);
+struct k_thread *z_requeue_first_thread(_wait_q_t *wait_q, _wait_q_t *target);
 void z_unpend_thread(struct k_thread *thread);
 int z_unpend_all(_wait_q_t *wait_q);
 void z_thread_priority_set(struct k_thread *thread, int prio);
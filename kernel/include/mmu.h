@@ -90,6 +90,12 @@
  */
 #define Z_PAGE_FRAME_BACKED		BIT(4)
 
+/**
+ * This page frame holds a data page read ahead by the last page fault, kept
+ * from eviction until the next one
+ */
+#define Z_PAGE_FRAME_READ_AHEAD		BIT(5)
+
 /**
  * Data structure for physical page frames
  *
@@ -141,10 +147,16 @@ static inline bool z_page_frame_is_backed(struct z_page_frame *pf)
 	return (pf->flags & Z_PAGE_FRAME_BACKED) != 0U;
 }
 
+static inline bool z_page_frame_is_read_ahead(struct z_page_frame *pf)
+{
+	return (pf->flags & Z_PAGE_FRAME_READ_AHEAD) != 0U;
+}
+
 static inline bool z_page_frame_is_evictable(struct z_page_frame *pf)
 {
 	return (!z_page_frame_is_reserved(pf) && z_page_frame_is_mapped(pf) &&
-		!z_page_frame_is_pinned(pf) && !z_page_frame_is_busy(pf));
+		!z_page_frame_is_pinned(pf) && !z_page_frame_is_busy(pf) &&
+		!z_page_frame_is_read_ahead(pf));
 }
 
 /* If true, page is not being used for anything, is not reserved, is a member
@@ -244,6 +256,23 @@ extern size_t z_free_page_count;
  */
 unsigned long z_num_pagefaults_get(void);
 
+#ifdef CONFIG_DEMAND_PAGING_STATS
+/**
+ * Account page frames examined by the eviction algorithm
+ *
+ * Called by k_mem_paging_eviction_select() implementations with the number
+ * of page frames they examined to select the page frame to evict.
+ *
+ * @param frames Number of page frames examined
+ */
+void z_paging_stats_eviction_scanned(unsigned long frames);
+#else
+static inline void z_paging_stats_eviction_scanned(unsigned long frames)
+{
+	ARG_UNUSED(frames);
+}
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+
 /**
  * Free a page frame physical address by evicting its contents
  *
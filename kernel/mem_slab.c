@@ -15,6 +15,111 @@
 #include <zephyr/init.h>
 #include <zephyr/sys/check.h>
 
+#ifdef CONFIG_MEM_SLAB_LOCKLESS
+/* The lower 32 bits of free_head hold one plus the index of the first free
+ * block, or zero if there is none, and the upper 32 bits a tag. Each free
+ * block starts with one plus the index of the next free block. Taking a
+ * block increments the tag, so that a compare-and-swap based on a stale
+ * head fails even if the same block is back on top of the stack, and a
+ * next index read from a block taken in the meantime is never used.
+ *
+ * Freeing a block hands it to a waiting thread under the lock if there is
+ * one. Otherwise it is pushed before checking for waiters again, while
+ * allocating registers a waiter before looking at the stack one last time
+ * under the lock. Either the allocating thread finds the block, or the
+ * freeing thread sees the waiter and hands a block over under the lock.
+ */
+#define SLAB_INDEX_MASK 0xFFFFFFFFULL
+#define SLAB_TAG_ONE    BIT64(32)
+
+static inline uint64_t free_head_get(struct k_mem_slab *slab)
+{
+	return __atomic_load_n(&slab->free_head, __ATOMIC_SEQ_CST);
+}
+
+static inline bool free_head_cas(struct k_mem_slab *slab, uint64_t old_head,
+				 uint64_t new_head)
+{
+	return __atomic_compare_exchange_n(&slab->free_head, &old_head,
+					   new_head, false, __ATOMIC_SEQ_CST,
+					   __ATOMIC_SEQ_CST);
+}
+
+static char *free_list_take(struct k_mem_slab *slab)
+{
+	uint64_t head, next;
+	atomic_val_t used;
+	char *block;
+
+	do {
+		head = free_head_get(slab);
+		if ((head & SLAB_INDEX_MASK) == 0U) {
+			return NULL;
+		}
+
+		block = slab->buffer +
+			(((head & SLAB_INDEX_MASK) - 1U) * slab->block_size);
+		next = (head & ~SLAB_INDEX_MASK) + SLAB_TAG_ONE;
+		next |= *(volatile uint32_t *)block;
+	} while (!free_head_cas(slab, head, next));
+
+	used = atomic_inc(&slab->num_used) + 1;
+
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	atomic_val_t max_used;
+
+	do {
+		max_used = atomic_get(&slab->max_used);
+		if (used <= max_used) {
+			break;
+		}
+	} while (!atomic_cas(&slab->max_used, max_used, used));
+#else
+	ARG_UNUSED(used);
+#endif
+
+	return block;
+}
+
+static void free_list_put(struct k_mem_slab *slab, char *block)
+{
+	uint64_t index = ((block - slab->buffer) / slab->block_size) + 1U;
+	uint64_t head;
+
+	atomic_dec(&slab->num_used);
+
+	do {
+		head = free_head_get(slab);
+		*(uint32_t *)block = (uint32_t)(head & SLAB_INDEX_MASK);
+	} while (!free_head_cas(slab, head, (head & ~SLAB_INDEX_MASK) | index));
+}
+#else
+/* Called with the slab locked */
+static char *free_list_take(struct k_mem_slab *slab)
+{
+	char *block = slab->free_list;
+
+	if (block != NULL) {
+		slab->free_list = *(char **)block;
+		slab->num_used++;
+
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+		slab->max_used = MAX(slab->num_used, slab->max_used);
+#endif
+	}
+
+	return block;
+}
+
+/* Called with the slab locked */
+static void free_list_put(struct k_mem_slab *slab, char *block)
+{
+	*(char **)block = slab->free_list;
+	slab->free_list = block;
+	slab->num_used--;
+}
+#endif /* CONFIG_MEM_SLAB_LOCKLESS */
+
 /**
  * @brief Initialize kernel memory slab subsystem.
  *
@@ -38,11 +143,21 @@ static int create_free_list(struct k_mem_slab *slab)
 	slab->free_list = NULL;
 	p = slab->buffer;
 
+#ifdef CONFIG_MEM_SLAB_LOCKLESS
+	/* Block j links to block j - 1, the last block is on top */
+	for (j = 0U; j < slab->num_blocks; j++) {
+		*(uint32_t *)p = j;
+		p += slab->block_size;
+	}
+	__atomic_store_n(&slab->free_head, (uint64_t)slab->num_blocks,
+			 __ATOMIC_SEQ_CST);
+#else
 	for (j = 0U; j < slab->num_blocks; j++) {
 		*(char **)p = slab->free_list;
 		slab->free_list = p;
 		p += slab->block_size;
 	}
+#endif
 	return 0;
 }
 
@@ -81,11 +196,19 @@ int k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 	slab->num_blocks = num_blocks;
 	slab->block_size = block_size;
 	slab->buffer = buffer;
-	slab->num_used = 0U;
 	slab->lock = (struct k_spinlock) {};
 
+#ifdef CONFIG_MEM_SLAB_LOCKLESS
+	atomic_set(&slab->waiters, 0);
+	atomic_set(&slab->num_used, 0);
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+	atomic_set(&slab->max_used, 0);
+#endif
+#else
+	slab->num_used = 0U;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	slab->max_used = 0U;
+#endif
 #endif
 
 	rc = create_free_list(slab);
@@ -103,26 +226,34 @@ out:
 
 int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 {
-	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	k_spinlock_key_t key;
 	int result;
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
 
-	if (slab->free_list != NULL) {
-		/* take a free block */
-		*mem = slab->free_list;
-		slab->free_list = *(char **)(slab->free_list);
-		slab->num_used++;
+#ifdef CONFIG_MEM_SLAB_LOCKLESS
+	*mem = free_list_take(slab);
+	if (*mem != NULL) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, 0);
 
-#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
-		slab->max_used = MAX(slab->num_used, slab->max_used);
+		return 0;
+	}
 #endif
 
+	key = k_spin_lock(&slab->lock);
+
+#ifdef CONFIG_MEM_SLAB_LOCKLESS
+	/* Register before looking again, see k_mem_slab_free() */
+	atomic_inc(&slab->waiters);
+#endif
+
+	/* take a free block */
+	*mem = free_list_take(slab);
+	if (*mem != NULL) {
 		result = 0;
 	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT) ||
 		   !IS_ENABLED(CONFIG_MULTITHREADING)) {
 		/* don't wait for a free block to become available */
-		*mem = NULL;
 		result = -ENOMEM;
 	} else {
 		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_mem_slab, alloc, slab, timeout);
@@ -133,11 +264,19 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 			*mem = _current->base.swap_data;
 		}
 
+#ifdef CONFIG_MEM_SLAB_LOCKLESS
+		atomic_dec(&slab->waiters);
+#endif
+
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
 
 		return result;
 	}
 
+#ifdef CONFIG_MEM_SLAB_LOCKLESS
+	atomic_dec(&slab->waiters);
+#endif
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
 
 	k_spin_unlock(&slab->lock, key);
@@ -145,6 +284,58 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 	return result;
 }
 
+#ifdef CONFIG_MEM_SLAB_LOCKLESS
+void k_mem_slab_free(struct k_mem_slab *slab, void **mem)
+{
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+	char *block = *mem;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
+
+	if (atomic_get(&slab->waiters) == 0) {
+		free_list_put(slab, block);
+
+		if (atomic_get(&slab->waiters) == 0) {
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+
+			return;
+		}
+
+		/* A thread started waiting and may have missed the block.
+		 * It may also have been taken without the lock since, so
+		 * only wake up a thread once we have one.
+		 */
+		block = NULL;
+	}
+
+	key = k_spin_lock(&slab->lock);
+
+	if ((block == NULL) && (z_waitq_head(&slab->wait_q) != NULL)) {
+		block = free_list_take(slab);
+	}
+
+	if (block != NULL) {
+		/* Waiting threads get the block before anyone else */
+		pending_thread = z_unpend_first_thread(&slab->wait_q);
+		if (pending_thread != NULL) {
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+
+			z_thread_return_value_set_with_data(pending_thread,
+							    0, block);
+			z_ready_thread(pending_thread);
+			z_reschedule(&slab->lock, key);
+			return;
+		}
+
+		free_list_put(slab, block);
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+
+	k_spin_unlock(&slab->lock, key);
+}
+#else
 void k_mem_slab_free(struct k_mem_slab *slab, void **mem)
 {
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
@@ -162,14 +353,13 @@ void k_mem_slab_free(struct k_mem_slab *slab, void **mem)
 			return;
 		}
 	}
-	**(char ***) mem = slab->free_list;
-	slab->free_list = *(char **) mem;
-	slab->num_used--;
+	free_list_put(slab, *mem);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
 
 	k_spin_unlock(&slab->lock, key);
 }
+#endif /* CONFIG_MEM_SLAB_LOCKLESS */
 
 int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stats *stats)
 {
@@ -179,13 +369,9 @@ int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stat
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
-	stats->allocated_bytes = slab->num_used * slab->block_size;
-	stats->free_bytes = (slab->num_blocks - slab->num_used) * slab->block_size;
-#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
-	stats->max_allocated_bytes = slab->max_used * slab->block_size;
-#else
-	stats->max_allocated_bytes = 0;
-#endif
+	stats->allocated_bytes = k_mem_slab_num_used_get(slab) * slab->block_size;
+	stats->free_bytes = k_mem_slab_num_free_get(slab) * slab->block_size;
+	stats->max_allocated_bytes = k_mem_slab_max_used_get(slab) * slab->block_size;
 
 	k_spin_unlock(&slab->lock, key);
 
@@ -201,7 +387,11 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab)
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
+#ifdef CONFIG_MEM_SLAB_LOCKLESS
+	atomic_set(&slab->max_used, atomic_get(&slab->num_used));
+#else
 	slab->max_used = slab->num_used;
+#endif
 
 	k_spin_unlock(&slab->lock, key);
 
@@ -392,6 +392,74 @@ static void free_page_frame_list_init(void)
 	sys_slist_init(&free_page_frame_list);
 }
 
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+/*
+ * Read ahead state, protected by interrupt locking like the rest of the
+ * paging state.
+ *
+ * The window is the number of data pages a page fault brings in, including
+ * the faulting one. A page fault on the data page right past those brought
+ * in by the previous page fault is taken as sequential access: the window
+ * doubles, up to CONFIG_DEMAND_PAGING_READ_AHEAD_MAX. Any other page fault
+ * shrinks the window back to a single page.
+ *
+ * The page frames of the data pages read ahead are kept from eviction until
+ * the next page fault, as they have not been accessed yet, unless no other
+ * page frame can be evicted. They are then released, and the data pages
+ * accessed in the meantime count as page faults avoided.
+ */
+static uint8_t *read_ahead_next;
+static size_t read_ahead_window = 1;
+static struct z_page_frame *read_ahead_pfs[CONFIG_DEMAND_PAGING_READ_AHEAD_MAX - 1];
+static size_t read_ahead_count;
+static size_t read_ahead_hits;
+
+static void read_ahead_release(void)
+{
+	uintptr_t flags;
+
+	for (size_t i = 0; i < read_ahead_count; i++) {
+		struct z_page_frame *pf = read_ahead_pfs[i];
+
+		/* Unless paged out since then */
+		if (!z_page_frame_is_read_ahead(pf)) {
+			continue;
+		}
+
+		pf->flags &= ~Z_PAGE_FRAME_READ_AHEAD;
+		flags = arch_page_info_get(pf->addr, NULL, false);
+		if ((flags & ARCH_DATA_PAGE_ACCESSED) != 0U) {
+			read_ahead_hits++;
+		}
+	}
+	read_ahead_count = 0;
+}
+
+static bool page_frame_evictable_exists(void)
+{
+	uintptr_t phys;
+	struct z_page_frame *pf;
+
+	Z_PAGE_FRAME_FOREACH(phys, pf) {
+		if (z_page_frame_is_evictable(pf)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Called before evicting a page frame, the eviction algorithms expect to
+ * find one
+ */
+static void read_ahead_reclaim(void)
+{
+	if (!page_frame_evictable_exists()) {
+		read_ahead_release();
+	}
+}
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
+
 static void page_frame_free_locked(struct z_page_frame *pf)
 {
 	pf->flags = 0;
@@ -486,6 +554,9 @@ static int map_anon_page(void *addr, uint32_t flags)
 		bool dirty;
 		int ret;
 
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+		read_ahead_reclaim();
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
 		pf = k_mem_paging_eviction_select(&dirty);
 		__ASSERT(pf != NULL, "failed to get a page frame");
 		LOG_DBG("evicting %p at 0x%lx", pf->addr,
@@ -1278,6 +1349,23 @@ static inline void paging_stats_eviction_inc(struct k_thread *faulting_thread,
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 }
 
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+static inline void paging_stats_read_ahead_inc(struct k_thread *faulting_thread,
+					       size_t pages, size_t hits)
+{
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	paging_stats.read_ahead.pages += pages;
+	paging_stats.read_ahead.hits += hits;
+#ifdef CONFIG_DEMAND_PAGING_THREAD_STATS
+	faulting_thread->paging_stats.read_ahead.pages += pages;
+	faulting_thread->paging_stats.read_ahead.hits += hits;
+#else
+	ARG_UNUSED(faulting_thread);
+#endif /* CONFIG_DEMAND_PAGING_THREAD_STATS */
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+}
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
+
 static inline struct z_page_frame *do_eviction_select(bool *dirty)
 {
 	struct z_page_frame *pf;
@@ -1296,6 +1384,10 @@ static inline struct z_page_frame *do_eviction_select(bool *dirty)
 #endif /* CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS */
 #endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
 
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+	read_ahead_reclaim();
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
+
 	pf = k_mem_paging_eviction_select(dirty);
 
 #ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
@@ -1312,14 +1404,127 @@ static inline struct z_page_frame *do_eviction_select(bool *dirty)
 	return pf;
 }
 
-static bool do_page_fault(void *addr, bool pin)
+/*
+ * Bring the paged out data page at addr into a page frame, evicting another
+ * data page if no page frame is free, and map it.
+ *
+ * Called with interrupts locked. If CONFIG_DEMAND_PAGING_ALLOW_IRQ is
+ * enabled, they are unlocked while the backing store is accessed, and
+ * locked again with a new key before returning.
+ */
+static struct z_page_frame *page_in_locked(void *addr,
+					   uintptr_t page_in_location,
+					   struct k_thread *faulting_thread,
+					   int *key)
 {
 	struct z_page_frame *pf;
-	int key, ret;
-	uintptr_t page_in_location, page_out_location;
+	uintptr_t page_out_location;
+	bool dirty = false;
+	int ret;
+
+	pf = free_page_frame_list_get();
+	if (pf == NULL) {
+		/* Need to evict a page frame */
+		pf = do_eviction_select(&dirty);
+		__ASSERT(pf != NULL, "failed to get a page frame");
+		LOG_DBG("evicting %p at 0x%lx", pf->addr,
+			z_page_frame_to_phys(pf));
+
+		paging_stats_eviction_inc(faulting_thread, dirty);
+	}
+	ret = page_frame_prepare_locked(pf, &dirty, true, &page_out_location);
+	__ASSERT(ret == 0, "failed to prepare page frame");
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	irq_unlock(*key);
+	/* Interrupts are now unlocked if they were not locked when we entered
+	 * this function, and we may service ISRs. The scheduler is still
+	 * locked.
+	 */
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	if (dirty) {
+		do_backing_store_page_out(page_out_location);
+	}
+	do_backing_store_page_in(page_in_location);
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	*key = irq_lock();
+	pf->flags &= ~Z_PAGE_FRAME_BUSY;
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	pf->flags |= Z_PAGE_FRAME_MAPPED;
+	pf->addr = UINT_TO_POINTER(POINTER_TO_UINT(addr)
+				   & ~(CONFIG_MMU_PAGE_SIZE - 1));
+
+	arch_mem_page_in(addr, z_page_frame_to_phys(pf));
+	k_mem_paging_backing_store_page_finalize(pf, page_in_location);
+
+	return pf;
+}
+
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+static void do_read_ahead(void *addr, struct z_page_frame *fault_pf,
+			  struct k_thread *faulting_thread, int *key)
+{
+	uint8_t *page = UINT_TO_POINTER(POINTER_TO_UINT(addr)
+					& ~(CONFIG_MMU_PAGE_SIZE - 1));
+	bool fault_pinned = z_page_frame_is_pinned(fault_pf);
+	struct z_page_frame *pf;
+	size_t count;
+
+	if (page == read_ahead_next) {
+		read_ahead_window = MIN(read_ahead_window * 2U,
+					CONFIG_DEMAND_PAGING_READ_AHEAD_MAX);
+	} else {
+		read_ahead_window = 1;
+	}
+
+	/* The faulting data page has not been accessed yet. Keep it from
+	 * being evicted to make room for the data pages read ahead.
+	 */
+	fault_pf->flags |= Z_PAGE_FRAME_PINNED;
+
+	for (count = 0; count < (read_ahead_window - 1U); count++) {
+		uint8_t *next = page + ((count + 1U) * CONFIG_MMU_PAGE_SIZE);
+		uintptr_t location;
+
+		/* Stop at the first data page that is not paged out */
+		if ((next >= Z_VIRT_REGION_END_ADDR) ||
+		    (arch_page_location_get(next, &location) !=
+		     ARCH_PAGE_LOCATION_PAGED_OUT)) {
+			break;
+		}
+
+		/* Only read ahead into free page frames or ones that can be
+		 * evicted, never the data pages read ahead so far
+		 */
+		if ((z_free_page_count == 0U) &&
+		    !page_frame_evictable_exists()) {
+			break;
+		}
+
+		pf = page_in_locked(next, location, faulting_thread, key);
+		pf->flags |= Z_PAGE_FRAME_READ_AHEAD;
+		read_ahead_pfs[count] = pf;
+	}
+
+	if (!fault_pinned) {
+		fault_pf->flags &= ~Z_PAGE_FRAME_PINNED;
+	}
+
+	read_ahead_next = page + ((count + 1U) * CONFIG_MMU_PAGE_SIZE);
+	read_ahead_count = count;
+
+	paging_stats_read_ahead_inc(faulting_thread, count, 0);
+}
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
+
+static bool do_page_fault(void *addr, bool pin, bool read_ahead)
+{
+	struct z_page_frame *pf;
+	int key;
+	uintptr_t page_in_location;
 	enum arch_page_location status;
 	bool result;
-	bool dirty = false;
 	struct k_thread *faulting_thread = _current_cpu->current;
 
 	__ASSERT(page_frames_initialized, "page fault at %p happened too early",
@@ -1393,44 +1598,24 @@ static bool do_page_fault(void *addr, bool pin)
 
 	paging_stats_faults_inc(faulting_thread, key);
 
-	pf = free_page_frame_list_get();
-	if (pf == NULL) {
-		/* Need to evict a page frame */
-		pf = do_eviction_select(&dirty);
-		__ASSERT(pf != NULL, "failed to get a page frame");
-		LOG_DBG("evicting %p at 0x%lx", pf->addr,
-			z_page_frame_to_phys(pf));
-
-		paging_stats_eviction_inc(faulting_thread, dirty);
-	}
-	ret = page_frame_prepare_locked(pf, &dirty, true, &page_out_location);
-	__ASSERT(ret == 0, "failed to prepare page frame");
-
-#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
-	irq_unlock(key);
-	/* Interrupts are now unlocked if they were not locked when we entered
-	 * this function, and we may service ISRs. The scheduler is still
-	 * locked.
-	 */
-#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
-	if (dirty) {
-		do_backing_store_page_out(page_out_location);
-	}
-	do_backing_store_page_in(page_in_location);
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+	read_ahead_release();
+	paging_stats_read_ahead_inc(faulting_thread, 0, read_ahead_hits);
+	read_ahead_hits = 0;
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
 
-#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
-	key = irq_lock();
-	pf->flags &= ~Z_PAGE_FRAME_BUSY;
-#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	pf = page_in_locked(addr, page_in_location, faulting_thread, &key);
 	if (pin) {
 		pf->flags |= Z_PAGE_FRAME_PINNED;
 	}
-	pf->flags |= Z_PAGE_FRAME_MAPPED;
-	pf->addr = UINT_TO_POINTER(POINTER_TO_UINT(addr)
-				   & ~(CONFIG_MMU_PAGE_SIZE - 1));
 
-	arch_mem_page_in(addr, z_page_frame_to_phys(pf));
-	k_mem_paging_backing_store_page_finalize(pf, page_in_location);
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+	if (read_ahead) {
+		do_read_ahead(addr, pf, faulting_thread, &key);
+	}
+#else
+	ARG_UNUSED(read_ahead);
+#endif /* CONFIG_DEMAND_PAGING_READ_AHEAD */
 out:
 	irq_unlock(key);
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
@@ -1444,7 +1629,7 @@ static void do_page_in(void *addr)
 {
 	bool ret;
 
-	ret = do_page_fault(addr, false);
+	ret = do_page_fault(addr, false, false);
 	__ASSERT(ret, "unmapped memory address %p", addr);
 	(void)ret;
 }
@@ -1461,7 +1646,7 @@ static void do_mem_pin(void *addr)
 {
 	bool ret;
 
-	ret = do_page_fault(addr, true);
+	ret = do_page_fault(addr, true, false);
 	__ASSERT(ret, "unmapped memory address %p", addr);
 	(void)ret;
 }
@@ -1476,7 +1661,7 @@ void k_mem_pin(void *addr, size_t size)
 
 bool z_page_fault(void *addr)
 {
-	return do_page_fault(addr, false);
+	return do_page_fault(addr, false, true);
 }
 
 static void do_mem_unpin(void *addr)
@@ -281,6 +281,226 @@ static inline int z_vrfy_k_msgq_get(struct k_msgq *msgq, void *data,
 #include <syscalls/k_msgq_get_mrsh.c>
 #endif
 
+/* Copy messages into the ring buffer, which must have room for them */
+static void msgq_ring_put(struct k_msgq *msgq, const char *data,
+			  uint32_t num_msgs)
+{
+	size_t len = num_msgs * msgq->msg_size;
+	size_t first = MIN(len, (size_t)(msgq->buffer_end - msgq->write_ptr));
+
+	(void)memcpy(msgq->write_ptr, data, first);
+	(void)memcpy(msgq->buffer_start, data + first, len - first);
+
+	msgq->write_ptr += len;
+	if (msgq->write_ptr >= msgq->buffer_end) {
+		msgq->write_ptr -= msgq->buffer_end - msgq->buffer_start;
+	}
+	msgq->used_msgs += num_msgs;
+}
+
+/* Copy messages out of the ring buffer, which must hold them */
+static void msgq_ring_get(struct k_msgq *msgq, char *data, uint32_t num_msgs)
+{
+	size_t len = num_msgs * msgq->msg_size;
+	size_t first = MIN(len, (size_t)(msgq->buffer_end - msgq->read_ptr));
+
+	(void)memcpy(data, msgq->read_ptr, first);
+	(void)memcpy(data + first, msgq->buffer_start, len - first);
+
+	msgq->read_ptr += len;
+	if (msgq->read_ptr >= msgq->buffer_end) {
+		msgq->read_ptr -= msgq->buffer_end - msgq->buffer_start;
+	}
+	msgq->used_msgs -= num_msgs;
+}
+
+/* Send as many messages as possible without waiting, called with the
+ * message queue locked
+ */
+static uint32_t msgq_put_batch_locked(struct k_msgq *msgq, const char *data,
+				      uint32_t num_msgs, bool *reschedule)
+{
+	struct k_thread *pending_thread;
+	uint32_t sent = 0U;
+	uint32_t count;
+
+	/* Threads only wait to receive while the queue is empty */
+	while ((sent < num_msgs) && (msgq->used_msgs == 0U) &&
+	       ((pending_thread = z_unpend_first_thread(&msgq->wait_q)) != NULL)) {
+		/* give message to waiting thread */
+		(void)memcpy(pending_thread->base.swap_data,
+			     data + (sent * msgq->msg_size), msgq->msg_size);
+		/* wake up waiting thread */
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		*reschedule = true;
+		sent++;
+	}
+
+	/* put the other messages in queue */
+	count = MIN(num_msgs - sent, msgq->max_msgs - msgq->used_msgs);
+	if (count != 0U) {
+		msgq_ring_put(msgq, data + (sent * msgq->msg_size), count);
+		sent += count;
+#ifdef CONFIG_POLL
+		handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+#endif /* CONFIG_POLL */
+	}
+
+	return sent;
+}
+
+int z_impl_k_msgq_put_batch(struct k_msgq *msgq, const void *data,
+			    uint32_t num_msgs, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	bool reschedule = false;
+	k_spinlock_key_t key;
+	uint32_t sent;
+	int result;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put_batch, msgq, timeout);
+
+	CHECKIF(num_msgs == 0U) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put_batch, msgq, timeout,
+					       -EINVAL);
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&msgq->lock);
+
+	sent = msgq_put_batch_locked(msgq, data, num_msgs, &reschedule);
+	if (sent != 0U) {
+		result = (int)sent;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		/* don't wait for message space to become available */
+		result = -ENOMSG;
+	} else {
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, put_batch, msgq, timeout);
+
+		/* wait for the first message to be received */
+		_current->base.swap_data = (void *)data;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		if ((result != 0) || (num_msgs == 1U)) {
+			result = (result == 0) ? 1 : result;
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put_batch, msgq,
+						       timeout, result);
+			return result;
+		}
+
+		/* send the others without waiting */
+		key = k_spin_lock(&msgq->lock);
+		result = 1 + (int)msgq_put_batch_locked(msgq,
+				(const char *)data + msgq->msg_size,
+				num_msgs - 1U, &reschedule);
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put_batch, msgq, timeout, result);
+
+	if (reschedule) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_put_batch(struct k_msgq *msgq,
+					  const void *data, uint32_t num_msgs,
+					  k_timeout_t timeout)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	Z_OOPS(Z_SYSCALL_MEMORY_ARRAY_READ(data, num_msgs, msgq->msg_size));
+
+	return z_impl_k_msgq_put_batch(msgq, data, num_msgs, timeout);
+}
+#include <syscalls/k_msgq_put_batch_mrsh.c>
+#endif
+
+int z_impl_k_msgq_get_batch(struct k_msgq *msgq, void *data,
+			    uint32_t num_msgs, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	struct k_thread *pending_thread;
+	bool reschedule = false;
+	k_spinlock_key_t key;
+	uint32_t count;
+	int result;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get_batch, msgq, timeout);
+
+	CHECKIF(num_msgs == 0U) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get_batch, msgq, timeout,
+					       -EINVAL);
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&msgq->lock);
+
+	count = MIN(num_msgs, msgq->used_msgs);
+	if (count != 0U) {
+		/* take the first available messages from queue */
+		msgq_ring_get(msgq, data, count);
+
+		/* Threads only wait to send while the queue is full, so the
+		 * queue can now take the messages of as many of them
+		 */
+		while ((msgq->used_msgs < msgq->max_msgs) &&
+		       ((pending_thread = z_unpend_first_thread(&msgq->wait_q)) != NULL)) {
+			/* add thread's message to queue */
+			msgq_ring_put(msgq, pending_thread->base.swap_data, 1U);
+
+			/* wake up waiting thread */
+			arch_thread_return_value_set(pending_thread, 0);
+			z_ready_thread(pending_thread);
+			reschedule = true;
+		}
+		result = (int)count;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		/* don't wait for a message to become available */
+		result = -ENOMSG;
+	} else {
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get_batch, msgq, timeout);
+
+		/* wait for a message or timeout */
+		_current->base.swap_data = data;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		result = (result == 0) ? 1 : result;
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get_batch, msgq, timeout,
+					       result);
+		return result;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get_batch, msgq, timeout, result);
+
+	if (reschedule) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_get_batch(struct k_msgq *msgq, void *data,
+					  uint32_t num_msgs,
+					  k_timeout_t timeout)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	Z_OOPS(Z_SYSCALL_MEMORY_ARRAY_WRITE(data, num_msgs, msgq->msg_size));
+
+	return z_impl_k_msgq_get_batch(msgq, data, num_msgs, timeout);
+}
+#include <syscalls/k_msgq_get_batch_mrsh.c>
+#endif
+
 int z_impl_k_msgq_peek(struct k_msgq *msgq, void *data)
 {
 	k_spinlock_key_t key;
@@ -30,6 +30,7 @@
 #include <zephyr/kernel_structs.h>
 #include <zephyr/toolchain.h>
 #include <ksched.h>
+#include <kernel_internal.h>
 #include <zephyr/wait_q.h>
 #include <errno.h>
 #include <zephyr/init.h>
@@ -46,10 +47,65 @@ LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
  */
 static struct k_spinlock lock;
 
+#ifdef CONFIG_MUTEX_FAST_PATH
+/* The state word holds the owner thread, or zero when unlocked. The low
+ * bit is set while threads may be pending on the mutex, forcing the owner
+ * through the slow path on unlock. Owner and lock_count remain valid for
+ * the owner itself; other threads derive the owner from the state word.
+ *
+ * Taking the mutex this way leaves owner_orig_prio alone: the thread that
+ * sets the contended bit records it under the lock before boosting the
+ * owner, so all priority inheritance state is only touched under the lock.
+ */
+#define MUTEX_CONTENDED BIT(0)
+
+static inline struct k_thread *mutex_owner_get(struct k_mutex *mutex)
+{
+	return (struct k_thread *)(atomic_get(&mutex->state) &
+				   ~(atomic_val_t)MUTEX_CONTENDED);
+}
+
+static inline bool mutex_fast_lock(struct k_mutex *mutex)
+{
+	if (!atomic_cas(&mutex->state, 0, (atomic_val_t)_current)) {
+		return false;
+	}
+
+	mutex->lock_count = 1U;
+	mutex->owner = _current;
+
+	return true;
+}
+
+static inline bool mutex_fast_unlock(struct k_mutex *mutex)
+{
+	/* Clear before releasing: once released, a new owner writes these */
+	mutex->owner = NULL;
+	mutex->lock_count = 0U;
+
+	if (atomic_cas(&mutex->state, (atomic_val_t)_current, 0)) {
+		return true;
+	}
+
+	mutex->owner = _current;
+	mutex->lock_count = 1U;
+
+	return false;
+}
+#else
+static inline struct k_thread *mutex_owner_get(struct k_mutex *mutex)
+{
+	return mutex->owner;
+}
+#endif /* CONFIG_MUTEX_FAST_PATH */
+
 int z_impl_k_mutex_init(struct k_mutex *mutex)
 {
 	mutex->owner = NULL;
 	mutex->lock_count = 0U;
+#ifdef CONFIG_MUTEX_FAST_PATH
+	atomic_set(&mutex->state, 0);
+#endif
 
 	z_waitq_init(&mutex->wait_q);
 
@@ -80,20 +136,23 @@ static int32_t new_prio_for_inheritance(int32_t target, int32_t limit)
 
 static bool adjust_owner_prio(struct k_mutex *mutex, int32_t new_prio)
 {
-	if (mutex->owner->base.prio != new_prio) {
+	struct k_thread *owner = mutex_owner_get(mutex);
+
+	if (owner->base.prio != new_prio) {
 
 		LOG_DBG("%p (ready (y/n): %c) prio changed to %d (was %d)",
-			mutex->owner, z_is_thread_ready(mutex->owner) ?
+			owner, z_is_thread_ready(owner) ?
 			'y' : 'n',
-			new_prio, mutex->owner->base.prio);
+			new_prio, owner->base.prio);
 
-		return z_set_prio(mutex->owner, new_prio);
+		return z_set_prio(owner, new_prio);
 	}
 	return false;
 }
 
 int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 {
+	struct k_thread *owner;
 	int new_prio;
 	k_spinlock_key_t key;
 	bool resched = false;
@@ -102,6 +161,49 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mutex, lock, mutex, timeout);
 
+#ifdef CONFIG_MUTEX_FAST_PATH
+	if (likely(mutex_fast_lock(mutex))) {
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, 0);
+
+		return 0;
+	}
+
+	if (mutex_owner_get(mutex) == _current) {
+		/* Only the owner touches the count */
+		mutex->lock_count++;
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex, timeout, 0);
+
+		return 0;
+	}
+
+	key = k_spin_lock(&lock);
+
+	/* Retry under the lock, and flag the owner that it must wake us up */
+	while (true) {
+		atomic_val_t state = atomic_get(&mutex->state);
+
+		if (state == 0) {
+			if (mutex_fast_lock(mutex)) {
+				k_spin_unlock(&lock, key);
+
+				SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, lock, mutex,
+							       timeout, 0);
+
+				return 0;
+			}
+		} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT) ||
+			   ((state & MUTEX_CONTENDED) != 0)) {
+			break;
+		} else if (atomic_cas(&mutex->state, state,
+				      state | MUTEX_CONTENDED)) {
+			/* First waiter, the owner cannot unlock without us now */
+			mutex->owner_orig_prio =
+				((struct k_thread *)state)->base.prio;
+			break;
+		}
+	}
+#else
 	key = k_spin_lock(&lock);
 
 	if (likely((mutex->lock_count == 0U) || (mutex->owner == _current))) {
@@ -123,6 +225,7 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 		return 0;
 	}
+#endif /* CONFIG_MUTEX_FAST_PATH */
 
 	if (unlikely(K_TIMEOUT_EQ(timeout, K_NO_WAIT))) {
 		k_spin_unlock(&lock, key);
@@ -134,12 +237,13 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_mutex, lock, mutex, timeout);
 
+	owner = mutex_owner_get(mutex);
 	new_prio = new_prio_for_inheritance(_current->base.prio,
-					    mutex->owner->base.prio);
+					    owner->base.prio);
 
 	LOG_DBG("adjusting prio up on mutex %p", mutex);
 
-	if (z_is_prio_higher(new_prio, mutex->owner->base.prio)) {
+	if (z_is_prio_higher(new_prio, owner->base.prio)) {
 		resched = adjust_owner_prio(mutex, new_prio);
 	}
 
@@ -165,7 +269,12 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 	 * Check if mutex was unlocked after this thread was unpended.
 	 * If so, skip adjusting owner's priority down.
 	 */
+#ifdef CONFIG_MUTEX_FAST_PATH
+	/* An owner nobody waits on was not boosted by this thread */
+	if (likely((atomic_get(&mutex->state) & MUTEX_CONTENDED) != 0)) {
+#else
 	if (likely(mutex->owner != NULL)) {
+#endif
 		struct k_thread *waiter = z_waitq_head(&mutex->wait_q);
 
 		new_prio = (waiter != NULL) ?
@@ -175,6 +284,13 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 		LOG_DBG("adjusting prio down on mutex %p", mutex);
 
 		resched = adjust_owner_prio(mutex, new_prio) || resched;
+
+#ifdef CONFIG_MUTEX_FAST_PATH
+		/* Last waiter gone, let the owner unlock without the lock */
+		if (waiter == NULL) {
+			atomic_and(&mutex->state, ~(atomic_val_t)MUTEX_CONTENDED);
+		}
+#endif
 	}
 
 	if (resched) {
@@ -201,12 +317,16 @@ static inline int z_vrfy_k_mutex_lock(struct k_mutex *mutex,
 int z_impl_k_mutex_unlock(struct k_mutex *mutex)
 {
 	struct k_thread *new_owner;
+	struct k_thread *owner;
 
 	__ASSERT(!arch_is_in_isr(), "mutexes cannot be used inside ISRs");
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mutex, unlock, mutex);
 
-	CHECKIF(mutex->owner == NULL) {
+	/* The owner field is only stable for the owner itself */
+	owner = mutex_owner_get(mutex);
+
+	CHECKIF(owner == NULL) {
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, unlock, mutex, -EINVAL);
 
 		return -EINVAL;
@@ -214,7 +334,7 @@ int z_impl_k_mutex_unlock(struct k_mutex *mutex)
 	/*
 	 * The current thread does not own the mutex.
 	 */
-	CHECKIF(mutex->owner != _current) {
+	CHECKIF(owner != _current) {
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mutex, unlock, mutex, -EPERM);
 
 		return -EPERM;
@@ -239,6 +359,12 @@ int z_impl_k_mutex_unlock(struct k_mutex *mutex)
 		goto k_mutex_unlock_return;
 	}
 
+#ifdef CONFIG_MUTEX_FAST_PATH
+	if (likely(mutex_fast_unlock(mutex))) {
+		goto k_mutex_unlock_return;
+	}
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
 	adjust_owner_prio(mutex, mutex->owner_orig_prio);
@@ -258,11 +384,19 @@ int z_impl_k_mutex_unlock(struct k_mutex *mutex)
 		 * adjust its priority
 		 */
 		mutex->owner_orig_prio = new_owner->base.prio;
+#ifdef CONFIG_MUTEX_FAST_PATH
+		atomic_set(&mutex->state, (atomic_val_t)new_owner |
+			   ((z_waitq_head(&mutex->wait_q) != NULL) ?
+			    MUTEX_CONTENDED : 0));
+#endif
 		arch_thread_return_value_set(new_owner, 0);
 		z_ready_thread(new_owner);
 		z_reschedule(&lock, key);
 	} else {
 		mutex->lock_count = 0U;
+#ifdef CONFIG_MUTEX_FAST_PATH
+		atomic_set(&mutex->state, 0);
+#endif
 		k_spin_unlock(&lock, key);
 	}
 
@@ -273,6 +407,34 @@ k_mutex_unlock_return:
 	return 0;
 }
 
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+int z_mutex_lock_for(struct k_mutex *mutex, struct k_thread *owner)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	int ret = 0;
+
+#ifdef CONFIG_MUTEX_FAST_PATH
+	if (!atomic_cas(&mutex->state, 0, (atomic_val_t)owner)) {
+		ret = -EBUSY;
+	}
+#else
+	if (mutex->lock_count != 0U) {
+		ret = -EBUSY;
+	}
+#endif
+
+	if (ret == 0) {
+		mutex->owner_orig_prio = owner->base.prio;
+		mutex->lock_count = 1U;
+		mutex->owner = owner;
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+#endif /* CONFIG_SYS_MUTEX_FAST_PATH */
+
 #ifdef CONFIG_USERSPACE
 static inline int z_vrfy_k_mutex_unlock(struct k_mutex *mutex)
 {
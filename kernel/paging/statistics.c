@@ -9,6 +9,7 @@
 #include <zephyr/syscall_handler.h>
 #include <zephyr/toolchain.h>
 #include <zephyr/sys/mem_manage.h>
+#include <mmu.h>
 
 extern struct k_mem_paging_stats_t paging_stats;
 
@@ -88,6 +89,25 @@ unsigned long z_num_pagefaults_get(void)
 	return ret;
 }
 
+void z_paging_stats_eviction_scanned(unsigned long frames)
+{
+#ifdef CONFIG_DEMAND_PAGING_THREAD_STATS
+	struct k_mem_paging_stats_t *thread_stats =
+		&_current_cpu->current->paging_stats;
+#endif /* CONFIG_DEMAND_PAGING_THREAD_STATS */
+
+	/* Called with interrupts locked from the page fault handler */
+	paging_stats.eviction.scanned += frames;
+	paging_stats.eviction.scanned_max =
+		MAX(paging_stats.eviction.scanned_max, frames);
+
+#ifdef CONFIG_DEMAND_PAGING_THREAD_STATS
+	thread_stats->eviction.scanned += frames;
+	thread_stats->eviction.scanned_max =
+		MAX(thread_stats->eviction.scanned_max, frames);
+#endif /* CONFIG_DEMAND_PAGING_THREAD_STATS */
+}
+
 void z_impl_k_mem_paging_stats_get(struct k_mem_paging_stats_t *stats)
 {
 	if (stats == NULL) {
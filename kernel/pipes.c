@@ -33,6 +33,10 @@ void k_pipe_init(struct k_pipe *pipe, unsigned char *buffer, size_t size)
 	pipe->bytes_used = 0U;
 	pipe->read_index = 0U;
 	pipe->write_index = 0U;
+#ifdef CONFIG_PIPES_ZERO_COPY
+	pipe->put_claimed = 0U;
+	pipe->get_claimed = 0U;
+#endif
 	pipe->lock = (struct k_spinlock){};
 	z_waitq_init(&pipe->wait_q.writers);
 	z_waitq_init(&pipe->wait_q.readers);
@@ -231,6 +235,29 @@ static size_t pipe_waiter_list_populate(sys_dlist_t  *list,
 	return num_bytes;
 }
 
+/**
+ * @brief Count the bytes waiting threads can transfer
+ *
+ * @return # of bytes available for direct copying, up to about @a limit
+ */
+static size_t pipe_waiter_bytes(_wait_q_t *wait_q, size_t limit)
+{
+	struct k_thread  *thread;
+	struct _pipe_desc *curr;
+	size_t num_bytes = 0U;
+
+	_WAIT_Q_FOR_EACH(wait_q, thread) {
+		curr = (struct _pipe_desc *)thread->base.swap_data;
+
+		num_bytes += curr->bytes_to_xfer;
+		if (num_bytes >= limit) {
+			break;
+		}
+	}
+
+	return num_bytes;
+}
+
 /**
  * @brief Populate pipe descriptors for copying to/from pipe buffer
  *
@@ -293,6 +320,8 @@ static int pipe_return_code(size_t min_xfer, size_t bytes_remaining,
 
 /**
  * @brief Copy data from source(s) to destination(s)
+ *
+ * Either the sources or the destinations may be the pipe buffer.
  */
 
 static size_t pipe_write(struct k_pipe *pipe, sys_dlist_t *src_list,
@@ -318,6 +347,17 @@ static size_t pipe_write(struct k_pipe *pipe, sys_dlist_t *src_list,
 		src->buffer         += bytes_copied;
 		src->bytes_to_xfer  -= bytes_copied;
 
+		if (src->thread == NULL) {
+
+			/* Reading from the pipe buffer. Update details. */
+
+			pipe->bytes_used -= bytes_copied;
+			pipe->read_index += bytes_copied;
+			if (pipe->read_index >= pipe->size) {
+				pipe->read_index -= pipe->size;
+			}
+		}
+
 		if (dest->thread == NULL) {
 
 			/* Writing to the pipe buffer. Update details. */
@@ -348,14 +388,61 @@ static size_t pipe_write(struct k_pipe *pipe, sys_dlist_t *src_list,
 	return num_bytes_written;
 }
 
+/**
+ * @brief Write as much data as possible without waiting
+ *
+ * Data is written to any waiting readers first, then to the pipe buffer.
+ * Called with the pipe locked.
+ *
+ * @return Number of bytes written
+ */
+static size_t pipe_put_locked(struct k_pipe *pipe, struct _pipe_desc *src_desc,
+			      bool *reschedule)
+{
+	struct _pipe_desc  pipe_desc[2];
+	sys_dlist_t        dest_list;
+	sys_dlist_t        src_list;
+	size_t             bytes_written;
+
+	sys_dlist_init(&src_list);
+	sys_dlist_init(&dest_list);
+
+	/*
+	 * First, write to any waiting readers, if any exist.
+	 * Second, write to the pipe buffer, if it exists.
+	 */
+
+	(void) pipe_waiter_list_populate(&dest_list, &pipe->wait_q.readers,
+					 src_desc->bytes_to_xfer);
+
+	if (pipe->bytes_used != pipe->size) {
+		(void) pipe_buffer_list_populate(&dest_list, pipe_desc,
+						 pipe->buffer, pipe->size,
+						 pipe->write_index,
+						 pipe->read_index);
+	}
+
+	sys_dlist_append(&src_list, &src_desc->node);
+
+	bytes_written = pipe_write(pipe, &src_list, &dest_list, reschedule);
+
+	/*
+	 * Only handle poll events if the pipe has had some bytes written and
+	 * there are bytes remaining after any pending readers have read from it
+	 */
+
+	if ((pipe->bytes_used != 0U) && (bytes_written != 0U)) {
+		handle_poll_events(pipe);
+	}
+
+	return bytes_written;
+}
+
 int z_impl_k_pipe_put(struct k_pipe *pipe, void *data, size_t bytes_to_write,
 		     size_t *bytes_written, size_t min_xfer,
 		      k_timeout_t timeout)
 {
-	struct _pipe_desc  pipe_desc[2];
 	struct _pipe_desc *src_desc;
-	sys_dlist_t        dest_list;
-	sys_dlist_t        src_list;
 	size_t             bytes_can_write;
 	bool               reschedule_needed = false;
 
@@ -371,28 +458,11 @@ int z_impl_k_pipe_put(struct k_pipe *pipe, void *data, size_t bytes_to_write,
 		return -EINVAL;
 	}
 
-	sys_dlist_init(&src_list);
-	sys_dlist_init(&dest_list);
-
 	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
 
-	/*
-	 * First, write to any waiting readers, if any exist.
-	 * Second, write to the pipe buffer, if it exists.
-	 */
-
-	bytes_can_write = pipe_waiter_list_populate(&dest_list,
-						    &pipe->wait_q.readers,
-						    bytes_to_write);
-
-	if (pipe->bytes_used != pipe->size) {
-		bytes_can_write += pipe_buffer_list_populate(&dest_list,
-							     pipe_desc,
-							     pipe->buffer,
-							     pipe->size,
-							     pipe->write_index,
-							     pipe->read_index);
-	}
+	bytes_can_write = pipe_waiter_bytes(&pipe->wait_q.readers,
+					    bytes_to_write) +
+			  (pipe->size - pipe->bytes_used);
 
 	if ((bytes_can_write < min_xfer) &&
 	    (K_TIMEOUT_EQ(timeout, K_NO_WAIT))) {
@@ -413,19 +483,8 @@ int z_impl_k_pipe_put(struct k_pipe *pipe, void *data, size_t bytes_to_write,
 	src_desc->buffer        = data;
 	src_desc->bytes_to_xfer = bytes_to_write;
 	src_desc->thread        = _current;
-	sys_dlist_append(&src_list, &src_desc->node);
 
-	*bytes_written = pipe_write(pipe, &src_list,
-				    &dest_list, &reschedule_needed);
-
-	/*
-	 * Only handle poll events if the pipe has had some bytes written and
-	 * there are bytes remaining after any pending readers have read from it
-	 */
-
-	if ((pipe->bytes_used != 0U) && (*bytes_written != 0U)) {
-		handle_poll_events(pipe);
-	}
+	*bytes_written = pipe_put_locked(pipe, src_desc, &reschedule_needed);
 
 	/*
 	 * The immediate success conditions below are backwards
@@ -483,19 +542,56 @@ int z_vrfy_k_pipe_put(struct k_pipe *pipe, void *data, size_t bytes_to_write,
 #include <syscalls/k_pipe_put_mrsh.c>
 #endif
 
-static int pipe_get_internal(k_spinlock_key_t key, struct k_pipe *pipe,
-			     void *data, size_t bytes_to_read,
-			     size_t *bytes_read, size_t min_xfer,
-			     k_timeout_t timeout)
+/**
+ * @brief Refill the pipe buffer from waiting writers
+ *
+ * Called with the pipe locked.
+ */
+static void pipe_refill_from_writers(struct k_pipe *pipe, bool *reschedule)
+{
+	struct _pipe_desc   pipe_desc[2];
+	sys_dlist_t         src_list;
+	sys_dlist_t         pipe_list;
+
+	if (pipe->bytes_used == pipe->size) {
+		return;
+	}
+
+	/*
+	 * The pipe is not full. If there are any waiting writers,
+	 * refill the pipe.
+	 */
+
+	sys_dlist_init(&src_list);
+	sys_dlist_init(&pipe_list);
+
+	(void) pipe_waiter_list_populate(&src_list,
+					 &pipe->wait_q.writers,
+					 pipe->size - pipe->bytes_used);
+
+	(void) pipe_buffer_list_populate(&pipe_list, pipe_desc,
+					 pipe->buffer, pipe->size,
+					 pipe->write_index,
+					 pipe->read_index);
+
+	(void) pipe_write(pipe, &src_list, &pipe_list, reschedule);
+}
+
+/**
+ * @brief Read as much data as possible without waiting
+ *
+ * Called with the pipe locked.
+ *
+ * @return Number of bytes read
+ */
+static size_t pipe_get_locked(struct k_pipe *pipe, struct _pipe_desc *dest_desc,
+			      bool *reschedule)
 {
 	sys_dlist_t         src_list;
 	struct _pipe_desc   pipe_desc[2];
-	struct _pipe_desc  *dest_desc;
 	struct _pipe_desc  *src_desc;
 	size_t         num_bytes_read = 0U;
 	size_t         bytes_copied;
-	size_t         bytes_can_read = 0U;
-	bool           reschedule_needed = false;
 
 	/*
 	 * Data copying takes place in the following order.
@@ -507,34 +603,14 @@ static int pipe_get_internal(k_spinlock_key_t key, struct k_pipe *pipe,
 	sys_dlist_init(&src_list);
 
 	if (pipe->bytes_used != 0) {
-		bytes_can_read = pipe_buffer_list_populate(&src_list,
-							   pipe_desc,
-							   pipe->buffer,
-							   pipe->size,
-							   pipe->read_index,
-							   pipe->write_index);
-	}
-
-	bytes_can_read += pipe_waiter_list_populate(&src_list,
-						    &pipe->wait_q.writers,
-						    bytes_to_read);
-
-	if ((bytes_can_read < min_xfer) &&
-	    (K_TIMEOUT_EQ(timeout, K_NO_WAIT))) {
-
-		/* The request can not be fulfilled. */
-
-		k_spin_unlock(&pipe->lock, key);
-		*bytes_read = 0;
-
-		return -EIO;
+		(void) pipe_buffer_list_populate(&src_list, pipe_desc,
+						 pipe->buffer, pipe->size,
+						 pipe->read_index,
+						 pipe->write_index);
 	}
 
-	dest_desc = &_current->pipe_desc;
-
-	dest_desc->buffer = data;
-	dest_desc->bytes_to_xfer = bytes_to_read;
-	dest_desc->thread = _current;
+	(void) pipe_waiter_list_populate(&src_list, &pipe->wait_q.writers,
+					 dest_desc->bytes_to_xfer);
 
 	src_desc = (struct _pipe_desc *)sys_dlist_get(&src_list);
 	while (src_desc != NULL) {
@@ -568,35 +644,49 @@ static int pipe_get_internal(k_spinlock_key_t key, struct k_pipe *pipe,
 
 			(void) z_sched_wake(&pipe->wait_q.writers, 0, NULL);
 
-			reschedule_needed = true;
+			*reschedule = true;
 		}
 		src_desc = (struct _pipe_desc *)sys_dlist_get(&src_list);
 	}
 
-	if (pipe->bytes_used != pipe->size) {
-		sys_dlist_t         pipe_list;
+	pipe_refill_from_writers(pipe, reschedule);
 
-		/*
-		 * The pipe is not full. If there are any waiting writers,
-		 * refill the pipe.
-		 */
+	return num_bytes_read;
+}
+
+static int pipe_get_internal(k_spinlock_key_t key, struct k_pipe *pipe,
+			     void *data, size_t bytes_to_read,
+			     size_t *bytes_read, size_t min_xfer,
+			     k_timeout_t timeout)
+{
+	struct _pipe_desc  *dest_desc;
+	size_t         num_bytes_read;
+	size_t         bytes_can_read;
+	bool           reschedule_needed = false;
 
-		sys_dlist_init(&src_list);
-		sys_dlist_init(&pipe_list);
+	bytes_can_read = pipe->bytes_used +
+			 pipe_waiter_bytes(&pipe->wait_q.writers,
+					   bytes_to_read);
 
-		(void) pipe_waiter_list_populate(&src_list,
-						 &pipe->wait_q.writers,
-						 pipe->size - pipe->bytes_used);
+	if ((bytes_can_read < min_xfer) &&
+	    (K_TIMEOUT_EQ(timeout, K_NO_WAIT))) {
 
-		(void) pipe_buffer_list_populate(&pipe_list, pipe_desc,
-						 pipe->buffer, pipe->size,
-						 pipe->write_index,
-						 pipe->read_index);
+		/* The request can not be fulfilled. */
+
+		k_spin_unlock(&pipe->lock, key);
+		*bytes_read = 0;
 
-		(void) pipe_write(pipe, &src_list,
-				  &pipe_list, &reschedule_needed);
+		return -EIO;
 	}
 
+	dest_desc = &_current->pipe_desc;
+
+	dest_desc->buffer = data;
+	dest_desc->bytes_to_xfer = bytes_to_read;
+	dest_desc->thread = _current;
+
+	num_bytes_read = pipe_get_locked(pipe, dest_desc, &reschedule_needed);
+
 	/*
 	 * The immediate success conditions below are backwards
 	 * compatible with an earlier pipe implementation.
@@ -747,3 +837,344 @@ size_t z_vrfy_k_pipe_write_avail(struct k_pipe *pipe)
 }
 #include <syscalls/k_pipe_write_avail_mrsh.c>
 #endif
+
+#ifdef CONFIG_PIPES_ZERO_COPY
+size_t k_pipe_put_claim(struct k_pipe *pipe, uint8_t **data, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	size_t contiguous;
+
+	__ASSERT(pipe->put_claimed == 0U, "put claim already in progress");
+
+	if (pipe->bytes_used == pipe->size) {
+		contiguous = 0U;
+	} else if (pipe->write_index < pipe->read_index) {
+		contiguous = pipe->read_index - pipe->write_index;
+	} else {
+		contiguous = pipe->size - pipe->write_index;
+	}
+
+	contiguous = MIN(size, contiguous);
+	pipe->put_claimed = contiguous;
+	*data = &pipe->buffer[pipe->write_index];
+
+	k_spin_unlock(&pipe->lock, key);
+
+	return contiguous;
+}
+
+/**
+ * @brief Hand data from the pipe buffer to waiting readers
+ *
+ * Called with the pipe locked.
+ */
+static void pipe_buffer_to_readers(struct k_pipe *pipe, bool *reschedule)
+{
+	struct _pipe_desc   pipe_desc[2];
+	sys_dlist_t         src_list;
+	sys_dlist_t         dest_list;
+
+	if (pipe->bytes_used == 0U) {
+		return;
+	}
+
+	sys_dlist_init(&src_list);
+	sys_dlist_init(&dest_list);
+
+	(void) pipe_buffer_list_populate(&src_list, pipe_desc,
+					 pipe->buffer, pipe->size,
+					 pipe->read_index,
+					 pipe->write_index);
+
+	(void) pipe_waiter_list_populate(&dest_list, &pipe->wait_q.readers,
+					 pipe->bytes_used);
+
+	(void) pipe_write(pipe, &src_list, &dest_list, reschedule);
+}
+
+int k_pipe_put_finish(struct k_pipe *pipe, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool reschedule_needed = false;
+
+	if (size > pipe->put_claimed) {
+		k_spin_unlock(&pipe->lock, key);
+
+		return -EINVAL;
+	}
+
+	pipe->put_claimed = 0U;
+	pipe->bytes_used += size;
+	pipe->write_index += size;
+	if (pipe->write_index >= pipe->size) {
+		pipe->write_index -= pipe->size;
+	}
+
+	/* Readers only wait while the pipe buffer is empty, so the data
+	 * committed here is all there is to hand over.
+	 */
+	pipe_buffer_to_readers(pipe, &reschedule_needed);
+
+	if ((pipe->bytes_used != 0U) && (size != 0U)) {
+		handle_poll_events(pipe);
+	}
+
+	if (reschedule_needed) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+
+	return 0;
+}
+
+size_t k_pipe_get_claim(struct k_pipe *pipe, uint8_t **data, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	size_t contiguous;
+
+	__ASSERT(pipe->get_claimed == 0U, "get claim already in progress");
+
+	if (pipe->bytes_used == 0U) {
+		contiguous = 0U;
+	} else if (pipe->read_index < pipe->write_index) {
+		contiguous = pipe->write_index - pipe->read_index;
+	} else {
+		contiguous = pipe->size - pipe->read_index;
+	}
+
+	contiguous = MIN(size, contiguous);
+	pipe->get_claimed = contiguous;
+	*data = &pipe->buffer[pipe->read_index];
+
+	k_spin_unlock(&pipe->lock, key);
+
+	return contiguous;
+}
+
+int k_pipe_get_finish(struct k_pipe *pipe, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool reschedule_needed = false;
+
+	if (size > pipe->get_claimed) {
+		k_spin_unlock(&pipe->lock, key);
+
+		return -EINVAL;
+	}
+
+	pipe->get_claimed = 0U;
+	pipe->bytes_used -= size;
+	pipe->read_index += size;
+	if (pipe->read_index >= pipe->size) {
+		pipe->read_index -= pipe->size;
+	}
+
+	pipe_refill_from_writers(pipe, &reschedule_needed);
+
+	if (reschedule_needed) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+
+	return 0;
+}
+
+static size_t pipe_vec_len(const struct k_pipe_vec *vec, size_t count)
+{
+	size_t len = 0U;
+
+	for (size_t i = 0U; i < count; i++) {
+		len += vec[i].len;
+	}
+
+	return len;
+}
+
+/*
+ * Left of a timeout ending at end, or K_NO_WAIT if it has elapsed.
+ * K_FOREVER is returned as is.
+ */
+static k_timeout_t pipe_timeout_left(k_timeout_t timeout, int64_t end)
+{
+	int64_t left;
+
+	if (K_TIMEOUT_EQ(timeout, K_FOREVER)) {
+		return K_FOREVER;
+	}
+
+	left = end - sys_clock_tick_get();
+
+	return (left > 0) ? K_TICKS(left) : K_NO_WAIT;
+}
+
+/*
+ * Vectored transfers move each segment with the lock held, and only
+ * release it to wait for the rest of a segment once the pipe can take or
+ * give no more without waiting. The wait is bounded by what is left of
+ * the timeout.
+ */
+int k_pipe_put_vec(struct k_pipe *pipe, const struct k_pipe_vec *vec,
+		   size_t count, size_t *bytes_written, size_t min_xfer,
+		   k_timeout_t timeout)
+{
+	struct _pipe_desc *src_desc = &_current->pipe_desc;
+	int64_t end = sys_clock_timeout_end_calc(timeout);
+	size_t bytes_to_write = pipe_vec_len(vec, count);
+	bool reschedule_needed = false;
+	k_spinlock_key_t key;
+	k_timeout_t left;
+
+	__ASSERT(((arch_is_in_isr() == false) ||
+		  K_TIMEOUT_EQ(timeout, K_NO_WAIT)), "");
+
+	CHECKIF((min_xfer > bytes_to_write) || bytes_written == NULL) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&pipe->lock);
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT) &&
+	    ((pipe_waiter_bytes(&pipe->wait_q.readers, bytes_to_write) +
+	      (pipe->size - pipe->bytes_used)) < min_xfer)) {
+
+		/* The request can not be fulfilled. */
+
+		k_spin_unlock(&pipe->lock, key);
+		*bytes_written = 0U;
+
+		return -EIO;
+	}
+
+	*bytes_written = 0U;
+
+	for (size_t i = 0U; i < count; i++) {
+		src_desc->buffer        = vec[i].data;
+		src_desc->bytes_to_xfer = vec[i].len;
+		src_desc->thread        = _current;
+
+		*bytes_written += pipe_put_locked(pipe, src_desc,
+						  &reschedule_needed);
+		if (src_desc->bytes_to_xfer == 0U) {
+			continue;
+		}
+
+		left = pipe_timeout_left(timeout, end);
+		if (K_TIMEOUT_EQ(left, K_NO_WAIT) ||
+		    ((*bytes_written >= min_xfer) && (min_xfer > 0U))) {
+			break;
+		}
+
+		/* Wait for the rest of the segment to be read */
+
+		size_t remaining = src_desc->bytes_to_xfer;
+
+		_current->base.swap_data = src_desc;
+
+		z_sched_wait(&pipe->lock, key, &pipe->wait_q.writers, left,
+			     NULL);
+
+		*bytes_written += remaining - src_desc->bytes_to_xfer;
+
+		key = k_spin_lock(&pipe->lock);
+		reschedule_needed = false;
+
+		if (src_desc->bytes_to_xfer != 0U) {
+			/* Timed out */
+			break;
+		}
+	}
+
+	if (reschedule_needed) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+
+	return (K_TIMEOUT_EQ(timeout, K_NO_WAIT) ||
+		(*bytes_written >= min_xfer)) ? 0 : -EAGAIN;
+}
+
+int k_pipe_get_vec(struct k_pipe *pipe, const struct k_pipe_vec *vec,
+		   size_t count, size_t *bytes_read, size_t min_xfer,
+		   k_timeout_t timeout)
+{
+	struct _pipe_desc *dest_desc = &_current->pipe_desc;
+	int64_t end = sys_clock_timeout_end_calc(timeout);
+	size_t bytes_to_read = pipe_vec_len(vec, count);
+	bool reschedule_needed = false;
+	k_spinlock_key_t key;
+	k_timeout_t left;
+
+	__ASSERT(((arch_is_in_isr() == false) ||
+		  K_TIMEOUT_EQ(timeout, K_NO_WAIT)), "");
+
+	CHECKIF((min_xfer > bytes_to_read) || bytes_read == NULL) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&pipe->lock);
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT) &&
+	    ((pipe->bytes_used +
+	      pipe_waiter_bytes(&pipe->wait_q.writers, bytes_to_read)) <
+	     min_xfer)) {
+
+		/* The request can not be fulfilled. */
+
+		k_spin_unlock(&pipe->lock, key);
+		*bytes_read = 0U;
+
+		return -EIO;
+	}
+
+	*bytes_read = 0U;
+
+	for (size_t i = 0U; i < count; i++) {
+		dest_desc->buffer        = vec[i].data;
+		dest_desc->bytes_to_xfer = vec[i].len;
+		dest_desc->thread        = _current;
+
+		*bytes_read += pipe_get_locked(pipe, dest_desc,
+					       &reschedule_needed);
+		if (dest_desc->bytes_to_xfer == 0U) {
+			continue;
+		}
+
+		left = pipe_timeout_left(timeout, end);
+		if (K_TIMEOUT_EQ(left, K_NO_WAIT) ||
+		    ((*bytes_read >= min_xfer) && (min_xfer > 0U))) {
+			break;
+		}
+
+		/* Wait for the rest of the segment to be written */
+
+		size_t remaining = dest_desc->bytes_to_xfer;
+
+		_current->base.swap_data = dest_desc;
+
+		z_sched_wait(&pipe->lock, key, &pipe->wait_q.readers, left,
+			     NULL);
+
+		*bytes_read += remaining - dest_desc->bytes_to_xfer;
+
+		key = k_spin_lock(&pipe->lock);
+		reschedule_needed = false;
+
+		if (dest_desc->bytes_to_xfer != 0U) {
+			/* Timed out */
+			break;
+		}
+	}
+
+	if (reschedule_needed) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+
+	return (K_TIMEOUT_EQ(timeout, K_NO_WAIT) ||
+		(*bytes_read >= min_xfer)) ? 0 : -EAGAIN;
+}
+#endif /* CONFIG_PIPES_ZERO_COPY */
@@ -890,6 +890,26 @@ struct k_thread *z_unpend_first_thread(_wait_q_t *wait_q)
 	return thread;
 }
 
+/* Move the first pended thread to another wait queue, keeping its timeout,
+ * which unpends it from whatever queue it is on when it expires.
+ */
+struct k_thread *z_requeue_first_thread(_wait_q_t *wait_q, _wait_q_t *target)
+{
+	struct k_thread *thread = NULL;
+
+	LOCKED(&sched_spinlock) {
+		thread = _priq_wait_best(&wait_q->waitq);
+
+		if (thread != NULL) {
+			_priq_wait_remove(&wait_q->waitq, thread);
+			thread->base.pended_on = target;
+			z_priq_wait_add(&target->waitq, thread);
+		}
+	}
+
+	return thread;
+}
+
 void z_unpend_thread(struct k_thread *thread)
 {
 	z_unpend_thread_no_timeout(thread);
@@ -8,7 +8,7 @@
 #include <zephyr/kernel.h>
 #include <string.h>
 #include <zephyr/sys/math_extras.h>
-#include <zephyr/sys/rb.h>
+#include <zephyr/sys/slist.h>
 #include <zephyr/kernel_structs.h>
 #include <zephyr/sys/sys_io.h>
 #include <ksched.h>
@@ -47,7 +47,7 @@ LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
  * not.
  */
 #ifdef CONFIG_DYNAMIC_OBJECTS
-static struct k_spinlock lists_lock;       /* kobj rbtree/dlist */
+static struct k_spinlock lists_lock;       /* kobj hash/dlist */
 static struct k_spinlock objfree_lock;     /* k_object_free */
 #endif
 static struct k_spinlock obj_lock;         /* kobj struct data */
@@ -136,7 +136,7 @@ uint8_t *z_priv_stack_find(k_thread_stack_t *stack)
 struct dyn_obj {
 	struct z_object kobj;
 	sys_dnode_t dobj_list;
-	struct rbnode node; /* must be immediately before data member */
+	sys_snode_t hash_node; /* must be immediately before data member */
 
 	/* The object itself */
 	uint8_t data[] __aligned(DYN_OBJ_DATA_ALIGN_K_THREAD);
@@ -146,27 +146,23 @@ extern struct z_object *z_object_gperf_find(const void *obj);
 extern void z_object_gperf_wordlist_foreach(_wordlist_cb_func_t func,
 					     void *context);
 
-static bool node_lessthan(struct rbnode *a, struct rbnode *b);
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_DYNAMIC_OBJECTS_HASH_BUCKETS),
+	     "CONFIG_DYNAMIC_OBJECTS_HASH_BUCKETS must be a power of two");
 
 /*
- * Red/black tree of allocated kernel objects, for reasonably fast lookups
- * based on object pointer values.
+ * Hash table of allocated kernel objects, for lookups based on object
+ * pointer values. Lookup and removal walk a single bucket, so their cost
+ * grows with the number of live objects per bucket.
  */
-static struct rbtree obj_rb_tree = {
-	.lessthan_fn = node_lessthan
-};
+static sys_slist_t obj_hash[CONFIG_DYNAMIC_OBJECTS_HASH_BUCKETS];
 
 /*
  * Linked list of allocated kernel objects, for iteration over all allocated
- * objects (and potentially deleting them during iteration).
+ * objects (and potentially deleting them during iteration) without walking
+ * empty hash buckets.
  */
 static sys_dlist_t obj_list = SYS_DLIST_STATIC_INIT(&obj_list);
 
-/*
- * TODO: Write some hash table code that will replace both obj_rb_tree
- * and obj_list.
- */
-
 static size_t obj_size_get(enum k_objects otype)
 {
 	size_t ret;
@@ -201,40 +197,59 @@ static size_t obj_align_get(enum k_objects otype)
 	return ret;
 }
 
-static bool node_lessthan(struct rbnode *a, struct rbnode *b)
+static inline sys_slist_t *obj_hash_bucket(const sys_snode_t *node)
 {
-	return a < b;
+	/* Fibonacci hashing of the node address, dropping the bits that
+	 * are always zero due to alignment
+	 */
+	uint32_t hash = (uint32_t)((uintptr_t)node / sizeof(void *)) *
+			0x9E3779B1U;
+
+	return &obj_hash[(hash ^ (hash >> 16)) &
+			 (CONFIG_DYNAMIC_OBJECTS_HASH_BUCKETS - 1)];
 }
 
-static inline struct dyn_obj *node_to_dyn_obj(struct rbnode *node)
+static inline sys_snode_t *dyn_obj_to_node(void *obj)
 {
-	return CONTAINER_OF(node, struct dyn_obj, node);
+	struct dyn_obj *dobj = CONTAINER_OF(obj, struct dyn_obj, data);
+
+	return &dobj->hash_node;
 }
 
-static inline struct rbnode *dyn_obj_to_node(void *obj)
+static void dyn_obj_link(struct dyn_obj *dyn)
 {
-	struct dyn_obj *dobj = CONTAINER_OF(obj, struct dyn_obj, data);
+	sys_slist_append(obj_hash_bucket(&dyn->hash_node), &dyn->hash_node);
+	sys_dlist_append(&obj_list, &dyn->dobj_list);
+}
 
-	return &dobj->node;
+static void dyn_obj_unlink(struct dyn_obj *dyn)
+{
+	(void)sys_slist_find_and_remove(obj_hash_bucket(&dyn->hash_node),
+					&dyn->hash_node);
+	sys_dlist_remove(&dyn->dobj_list);
 }
 
 static struct dyn_obj *dyn_object_find(void *obj)
 {
-	struct rbnode *node;
+	sys_snode_t *node;
+	sys_snode_t *iter;
 	struct dyn_obj *ret;
 
 	/* For any dynamically allocated kernel object, the object
 	 * pointer is just a member of the containing struct dyn_obj,
 	 * so just a little arithmetic is necessary to locate the
-	 * corresponding struct rbnode
+	 * corresponding hash node. It is only compared against the nodes
+	 * in its bucket, never dereferenced, as obj may not be dynamic.
 	 */
 	node = dyn_obj_to_node(obj);
+	ret = NULL;
 
 	k_spinlock_key_t key = k_spin_lock(&lists_lock);
-	if (rb_contains(&obj_rb_tree, node)) {
-		ret = node_to_dyn_obj(node);
-	} else {
-		ret = NULL;
+	SYS_SLIST_FOR_EACH_NODE(obj_hash_bucket(node), iter) {
+		if (iter == node) {
+			ret = CONTAINER_OF(node, struct dyn_obj, hash_node);
+			break;
+		}
 	}
 	k_spin_unlock(&lists_lock, key);
 
@@ -321,8 +336,7 @@ struct z_object *z_dynamic_object_aligned_create(size_t align, size_t size)
 
 	k_spinlock_key_t key = k_spin_lock(&lists_lock);
 
-	rb_insert(&obj_rb_tree, &dyn->node);
-	sys_dlist_append(&obj_list, &dyn->dobj_list);
+	dyn_obj_link(dyn);
 	k_spin_unlock(&lists_lock, key);
 
 	return &dyn->kobj;
@@ -398,8 +412,7 @@ void k_object_free(void *obj)
 
 	dyn = dyn_object_find(obj);
 	if (dyn != NULL) {
-		rb_remove(&obj_rb_tree, &dyn->node);
-		sys_dlist_remove(&dyn->dobj_list);
+		dyn_obj_unlink(dyn);
 
 		if (dyn->kobj.type == K_OBJ_THREAD) {
 			thread_idx_free(dyn->kobj.data.thread_id);
@@ -508,8 +521,7 @@ static void unref_check(struct z_object *ko, uintptr_t index)
 		break;
 	}
 
-	rb_remove(&obj_rb_tree, &dyn->node);
-	sys_dlist_remove(&dyn->dobj_list);
+	dyn_obj_unlink(dyn);
 	k_free(dyn);
 out:
 #endif
@@ -1317,12 +1317,24 @@ static inline void store_count(const struct conversion *conv,
 
 /* Outline function to emit all characters in [sp, ep). */
 static int outs(cbprintf_cb out,
+		cbprintf_span_cb span,
 		void *ctx,
 		const char *sp,
 		const char *ep)
 {
 	size_t count = 0;
 
+	if (span != NULL) {
+		size_t len = (ep == NULL) ? strlen(sp) : (size_t)(ep - sp);
+		int rc = span(sp, len, ctx);
+
+		if (rc < 0) {
+			return rc;
+		}
+
+		return (int)len;
+	}
+
 	while ((sp < ep) || ((ep == NULL) && *sp)) {
 		int rc = out((int)*sp++, ctx);
 
@@ -1335,8 +1347,8 @@ static int outs(cbprintf_cb out,
 	return (int)count;
 }
 
-int z_cbvprintf_impl(cbprintf_cb out, void *ctx, const char *fp,
-		     va_list ap, uint32_t flags)
+int z_cbvprintf_span_impl(cbprintf_cb out, cbprintf_span_cb span, void *ctx,
+			  const char *fp, va_list ap, uint32_t flags)
 {
 	char buf[CONVERTED_BUFLEN];
 	size_t count = 0;
@@ -1364,7 +1376,7 @@ int z_cbvprintf_impl(cbprintf_cb out, void *ctx, const char *fp,
  */
 
 #define OUTS(_sp, _ep) do { \
-	int rc = outs(out, ctx, _sp, _ep); \
+	int rc = outs(out, span, ctx, _sp, _ep); \
 	\
 	if (rc < 0) {	    \
 		return rc; \
@@ -1374,7 +1386,14 @@ int z_cbvprintf_impl(cbprintf_cb out, void *ctx, const char *fp,
 
 	while (*fp != 0) {
 		if (*fp != '%') {
-			OUTC(*fp++);
+			const char *sp = fp;
+
+			/* Emit the literal run up to the next conversion */
+			do {
+				++fp;
+			} while ((*fp != 0) && (*fp != '%'));
+
+			OUTS(sp, fp);
 			continue;
 		}
 
@@ -1842,3 +1861,9 @@ int z_cbvprintf_impl(cbprintf_cb out, void *ctx, const char *fp,
 #undef OUTS
 #undef OUTC
 }
+
+int z_cbvprintf_impl(cbprintf_cb out, void *ctx, const char *fp,
+		     va_list ap, uint32_t flags)
+{
+	return z_cbvprintf_span_impl(out, NULL, ctx, fp, ap, flags);
+}
@@ -353,3 +353,12 @@ start:
 		goto start;
 	}
 }
+
+int z_cbvprintf_span_impl(cbprintf_cb out, cbprintf_span_cb span, void *ctx,
+			  const char *fmt, va_list ap, uint32_t flags)
+{
+	/* Characters are always emitted one at a time */
+	ARG_UNUSED(span);
+
+	return z_cbvprintf_impl(out, ctx, fmt, ap, flags);
+}
@@ -89,12 +89,41 @@ static int peek(struct json_lexer *lex)
 	return chr;
 }
 
+/* Byte-wise tests on a word, see "Bit Twiddling Hacks" */
+#define WORD_ONES (~0UL / 0xffUL)
+#define WORD_HAS_ZERO(w) (((w) - WORD_ONES) & ~(w) & (WORD_ONES << 7))
+#define WORD_HAS_BYTE(w, b) WORD_HAS_ZERO((w) ^ (WORD_ONES * (b)))
+
+/*
+ * Skip the characters of a string up to a quote, a backslash or a NUL
+ * character, a word at a time.
+ */
+static void lexer_string_skip(struct json_lexer *lex)
+{
+	char *pos = lex->pos;
+	unsigned long word;
+
+	while (lex->end - pos >= (ptrdiff_t)sizeof(word)) {
+		memcpy(&word, pos, sizeof(word));
+		if (WORD_HAS_ZERO(word) || WORD_HAS_BYTE(word, '"') ||
+		    WORD_HAS_BYTE(word, '\\')) {
+			break;
+		}
+		pos += sizeof(word);
+	}
+
+	lex->pos = pos;
+}
+
 static void *lexer_string(struct json_lexer *lex)
 {
 	ignore(lex);
 
 	while (true) {
-		int chr = next(lex);
+		int chr;
+
+		lexer_string_skip(lex);
+		chr = next(lex);
 
 		if (chr == '\0') {
 			emit(lex, JSON_TOK_ERROR);
@@ -620,67 +649,282 @@ static int arr_data_parse(struct json_obj *obj, struct json_obj_token *val)
 	return -EINVAL;
 }
 
-static int obj_parse(struct json_obj *obj, const struct json_obj_descr *descr,
-		     size_t descr_len, void *val)
+static bool field_decoded(const uint32_t *decoded, size_t i)
+{
+	return (decoded[i / 32U] & BIT(i % 32U)) != 0U;
+}
+
+/* Find the first field not decoded yet with the name of the key */
+static int descr_find(const struct json_obj_descr *descr, size_t descr_len,
+		      const uint32_t *decoded, const char *key, size_t key_len)
 {
-	struct json_obj_key_value kv;
-	int32_t decoded_fields = 0;
 	size_t i;
+
+	for (i = 0; i < descr_len; i++) {
+		/* Field has been decoded already, skip */
+		if (field_decoded(decoded, i)) {
+			continue;
+		}
+
+		/* Check if it's the i-th field */
+		if (key_len != descr[i].field_name_len) {
+			continue;
+		}
+
+		if (memcmp(key, descr[i].field_name,
+			   descr[i].field_name_len)) {
+			continue;
+		}
+
+		return i;
+	}
+
+	return -ENOENT;
+}
+
+/* FNV-1a */
+static uint32_t key_hash(const char *key, size_t key_len)
+{
+	uint32_t hash = 2166136261U;
+
+	while (key_len--) {
+		hash = (hash ^ (uint8_t)*key++) * 16777619U;
+	}
+
+	return hash;
+}
+
+/*
+ * Keys are first hashed to a bucket, whose seed then hashes them to a
+ * slot of the table.
+ */
+static size_t key_slot(const struct json_obj_key_table *table, uint32_t hash)
+{
+	size_t mask = table->size - 1;
+	uint32_t h = hash ^ (table->seeds[hash & mask] * 0x9e3779b9U);
+
+	/* MurmurHash3 finalizer */
+	h ^= h >> 16;
+	h *= 0x85ebca6bU;
+	h ^= h >> 13;
+	h *= 0xc2b2ae35U;
+	h ^= h >> 16;
+
+	return h & mask;
+}
+
+static int key_table_find(const struct json_obj_key_table *table,
+			  const char *key, size_t key_len)
+{
+	const struct json_obj_descr *descr;
+	uint16_t slot;
+
+	slot = table->slots[key_slot(table, key_hash(key, key_len))];
+	if (slot == 0U) {
+		return -ENOENT;
+	}
+
+	descr = &table->descr[slot - 1U];
+	if ((key_len != descr->field_name_len) ||
+	    memcmp(key, descr->field_name, key_len)) {
+		return -ENOENT;
+	}
+
+	return slot - 1U;
+}
+
+static int obj_parse_fields(struct json_obj *obj,
+			    const struct json_obj_descr *descr,
+			    size_t descr_len,
+			    const struct json_obj_key_table *table,
+			    void *val, uint32_t *decoded)
+{
+	struct json_obj_key_value kv;
+	int decoded_count = 0;
+	int i;
 	int ret;
 
 	while (!obj_next(obj, &kv)) {
 		if (kv.value.type == JSON_TOK_OBJECT_END) {
-			return decoded_fields;
+			return decoded_count;
 		}
 
-		for (i = 0; i < descr_len; i++) {
-			void *decode_field = (char *)val + descr[i].offset;
+		if (table) {
+			i = key_table_find(table, kv.key, kv.key_len);
+		} else {
+			i = descr_find(descr, descr_len, decoded, kv.key,
+				       kv.key_len);
+		}
 
-			/* Field has been decoded already, skip */
-			if (decoded_fields & (1 << i)) {
-				continue;
-			}
+		if ((i < 0) || field_decoded(decoded, i)) {
+			continue;
+		}
 
-			/* Check if it's the i-th field */
-			if (kv.key_len != descr[i].field_name_len) {
-				continue;
+		/* Store the decoded value */
+		ret = decode_value(obj, &descr[i], &kv.value,
+				   (char *)val + descr[i].offset, val);
+		if (ret < 0) {
+			return ret;
+		}
+
+		decoded[i / 32U] |= BIT(i % 32U);
+		decoded_count++;
+	}
+
+	return -EINVAL;
+}
+
+static int obj_parse(struct json_obj *obj, const struct json_obj_descr *descr,
+		     size_t descr_len, void *val)
+{
+	uint32_t decoded_fields = 0;
+	int ret;
+
+	__ASSERT_NO_MSG(descr_len < (sizeof(ret) * CHAR_BIT - 1));
+
+	ret = obj_parse_fields(obj, descr, descr_len, NULL, val,
+			       &decoded_fields);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return decoded_fields;
+}
+
+int json_obj_parse(char *payload, size_t len,
+		   const struct json_obj_descr *descr, size_t descr_len,
+		   void *val)
+{
+	struct json_obj obj;
+	int ret;
+
+	ret = obj_init(&obj, payload, len);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return obj_parse(&obj, descr, descr_len, val);
+}
+
+/* Count the fields hashed to a bucket */
+static size_t key_bucket_count(const struct json_obj_key_table *table,
+			       size_t bucket)
+{
+	size_t mask = table->size - 1;
+	size_t count = 0;
+	size_t i;
+
+	for (i = 0; i < table->descr_len; i++) {
+		const struct json_obj_descr *descr = &table->descr[i];
+
+		if ((key_hash(descr->field_name, descr->field_name_len) &
+		     mask) == bucket) {
+			count++;
+		}
+	}
+
+	return count;
+}
+
+/* Place the fields of a bucket in free slots with the seed of the bucket */
+static bool key_bucket_place(struct json_obj_key_table *table, size_t bucket)
+{
+	size_t mask = table->size - 1;
+	size_t i, j;
+
+	for (i = 0; i < table->descr_len; i++) {
+		const struct json_obj_descr *descr = &table->descr[i];
+		uint32_t hash = key_hash(descr->field_name,
+					 descr->field_name_len);
+		size_t slot;
+
+		if ((hash & mask) != bucket) {
+			continue;
+		}
+
+		slot = key_slot(table, hash);
+
+		if (table->slots[slot] == 0U) {
+			table->slots[slot] = i + 1U;
+			continue;
+		}
+
+		/* Take back the fields of the bucket placed so far */
+		for (j = 0; j < i; j++) {
+			descr = &table->descr[j];
+			hash = key_hash(descr->field_name,
+					descr->field_name_len);
+			if ((hash & mask) == bucket) {
+				table->slots[key_slot(table, hash)] = 0U;
 			}
+		}
+
+		return false;
+	}
+
+	return true;
+}
+
+int json_obj_key_table_init(struct json_obj_key_table *table)
+{
+	size_t max_count = 0;
+	size_t bucket;
+	size_t count;
+	unsigned int seed;
+
+	if ((table->size == 0U) || ((table->size & (table->size - 1)) != 0U) ||
+	    (table->descr_len > table->size) ||
+	    (table->descr_len >= UINT16_MAX)) {
+		return -EINVAL;
+	}
 
-			if (memcmp(kv.key, descr[i].field_name,
-				   descr[i].field_name_len)) {
+	(void)memset(table->slots, 0, table->size * sizeof(table->slots[0]));
+	(void)memset(table->seeds, 0, table->size * sizeof(table->seeds[0]));
+
+	for (bucket = 0; bucket < table->size; bucket++) {
+		max_count = MAX(max_count, key_bucket_count(table, bucket));
+	}
+
+	/* Place the largest buckets first, while most slots are free */
+	for (count = max_count; count > 0; count--) {
+		for (bucket = 0; bucket < table->size; bucket++) {
+			if (key_bucket_count(table, bucket) != count) {
 				continue;
 			}
 
-			/* Store the decoded value */
-			ret = decode_value(obj, &descr[i], &kv.value,
-					   decode_field, val);
-			if (ret < 0) {
-				return ret;
+			for (seed = 0; seed <= UINT8_MAX; seed++) {
+				table->seeds[bucket] = seed;
+				if (key_bucket_place(table, bucket)) {
+					break;
+				}
 			}
 
-			decoded_fields |= 1<<i;
-			break;
+			if (seed > UINT8_MAX) {
+				return -ENOSPC;
+			}
 		}
 	}
 
-	return -EINVAL;
+	return 0;
 }
 
-int json_obj_parse(char *payload, size_t len,
-		   const struct json_obj_descr *descr, size_t descr_len,
-		   void *val)
+int json_obj_parse_table(char *payload, size_t len,
+			 const struct json_obj_key_table *table, void *val,
+			 uint32_t *decoded)
 {
 	struct json_obj obj;
 	int ret;
 
-	__ASSERT_NO_MSG(descr_len < (sizeof(ret) * CHAR_BIT - 1));
+	(void)memset(decoded, 0,
+		     JSON_OBJ_DECODED_LEN(table->descr_len) * sizeof(uint32_t));
 
 	ret = obj_init(&obj, payload, len);
 	if (ret < 0) {
 		return ret;
 	}
 
-	return obj_parse(&obj, descr, descr_len, val);
+	return obj_parse_fields(&obj, table->descr, table->descr_len, table,
+				val, decoded);
 }
 
 int json_arr_parse(char *payload, size_t len,
@@ -8,6 +8,7 @@
 #include <zephyr/sys/mutex.h>
 #include <zephyr/syscall_handler.h>
 #include <zephyr/kernel_structs.h>
+#include <kernel_internal.h>
 
 static struct k_mutex *get_k_mutex(struct sys_mutex *mutex)
 {
@@ -23,13 +24,116 @@ static struct k_mutex *get_k_mutex(struct sys_mutex *mutex)
 
 static bool check_sys_mutex_addr(struct sys_mutex *addr)
 {
-	/* sys_mutex memory is never touched, just used to lookup the
-	 * underlying k_mutex, but we don't want threads using mutexes
-	 * that are outside their memory domain
+	/* sys_mutex memory is just used to lookup the underlying k_mutex,
+	 * and with CONFIG_SYS_MUTEX_FAST_PATH for its value, but we don't
+	 * want threads using mutexes that are outside their memory domain
 	 */
 	return Z_SYSCALL_MEMORY_WRITE(addr, sizeof(struct sys_mutex));
 }
 
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+/* The sys_mutex value is zero while unlocked, and the owner thread while
+ * locked from user space, the kernel mutex being unlocked. A thread that
+ * finds the mutex locked by another thread hands it over to the kernel
+ * mutex, locking it on behalf of the owner so that priority inheritance
+ * applies, then waits on it. From then on the value is SYS_MUTEX_KERNEL
+ * plus SYS_MUTEX_USER for each thread holding or waiting for the kernel
+ * mutex, and every operation goes through the kernel until the last of
+ * them is done. A thread locking a mutex it already holds hands it over
+ * as well, so that the kernel mutex keeps the lock count.
+ *
+ * Kernel side changes of the value are serialized by the lock, user space
+ * only ever swaps zero and its own thread.
+ */
+#define SYS_MUTEX_KERNEL BIT(0)
+#define SYS_MUTEX_USER   2
+
+static struct k_spinlock lock;
+
+static inline bool is_kernel(atomic_val_t val)
+{
+	return (val & SYS_MUTEX_KERNEL) != 0;
+}
+
+/* The owner gets the priority of the threads waiting for it, only accept
+ * live threads of the caller's memory domain.
+ */
+static struct k_thread *owner_get(atomic_val_t val)
+{
+	struct k_thread *thread = (struct k_thread *)val;
+	struct z_object *ko = z_object_find(thread);
+
+	if (ko == NULL || ko->type != K_OBJ_THREAD ||
+	    (ko->flags & K_OBJ_FLAG_INITIALIZED) == 0U ||
+	    thread->mem_domain_info.mem_domain !=
+	    _current->mem_domain_info.mem_domain) {
+		return NULL;
+	}
+
+	return thread;
+}
+
+/* Count the caller as a kernel mutex user, handing the mutex over if it
+ * was locked from user space.
+ */
+static int kernel_enter(struct sys_mutex *mutex, struct k_mutex *kernel_mutex,
+			k_timeout_t timeout)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	struct k_thread *owner = NULL;
+	atomic_val_t val, new_val;
+	int ret = 0;
+
+	do {
+		val = atomic_get(&mutex->val);
+
+		if (val == 0) {
+			new_val = SYS_MUTEX_KERNEL + SYS_MUTEX_USER;
+		} else if (is_kernel(val)) {
+			/* The holder is counted already */
+			new_val = (kernel_mutex->owner == _current) ?
+				  val : val + SYS_MUTEX_USER;
+		} else if (val == (atomic_val_t)_current) {
+			owner = _current;
+			new_val = SYS_MUTEX_KERNEL + SYS_MUTEX_USER;
+		} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			ret = -EBUSY;
+			break;
+		} else {
+			owner = owner_get(val);
+			if (owner == NULL) {
+				ret = -EINVAL;
+				break;
+			}
+			new_val = SYS_MUTEX_KERNEL + 2 * SYS_MUTEX_USER;
+		}
+	} while (!atomic_cas(&mutex->val, val, new_val));
+
+	if ((ret == 0) && (owner != NULL)) {
+		(void)z_mutex_lock_for(kernel_mutex, owner);
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+
+/* Hand the mutex back to user space once the last user is done */
+static void kernel_leave(struct sys_mutex *mutex)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	atomic_val_t val = atomic_get(&mutex->val);
+
+	if (is_kernel(val)) {
+		atomic_set(&mutex->val,
+			   (val == SYS_MUTEX_KERNEL + SYS_MUTEX_USER) ?
+			   0 : val - SYS_MUTEX_USER);
+	}
+
+	k_spin_unlock(&lock, key);
+}
+#endif /* CONFIG_SYS_MUTEX_FAST_PATH */
+
 int z_impl_z_sys_mutex_kernel_lock(struct sys_mutex *mutex, k_timeout_t timeout)
 {
 	struct k_mutex *kernel_mutex = get_k_mutex(mutex);
@@ -38,7 +142,22 @@ int z_impl_z_sys_mutex_kernel_lock(struct sys_mutex *mutex, k_timeout_t timeout)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+	int ret = kernel_enter(mutex, kernel_mutex, timeout);
+
+	if (ret != 0) {
+		return ret;
+	}
+
+	ret = k_mutex_lock(kernel_mutex, timeout);
+	if (ret != 0) {
+		kernel_leave(mutex);
+	}
+
+	return ret;
+#else
 	return k_mutex_lock(kernel_mutex, timeout);
+#endif
 }
 
 static inline int z_vrfy_z_sys_mutex_kernel_lock(struct sys_mutex *mutex,
@@ -56,11 +175,43 @@ int z_impl_z_sys_mutex_kernel_unlock(struct sys_mutex *mutex)
 {
 	struct k_mutex *kernel_mutex = get_k_mutex(mutex);
 
-	if (kernel_mutex == NULL || kernel_mutex->lock_count == 0) {
+	if (kernel_mutex == NULL) {
+		return -EINVAL;
+	}
+
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+	/* Serialized with kernel_enter(), so that the owner holds the kernel
+	 * mutex once the value says it was handed over.
+	 */
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	atomic_val_t val = atomic_get(&mutex->val);
+	uint32_t lock_count = kernel_mutex->lock_count;
+
+	k_spin_unlock(&lock, key);
+
+	if (!is_kernel(val)) {
+		/* Locked from user space by another thread, if at all */
+		return (val == 0) ? -EINVAL : -EPERM;
+	}
+
+	if (lock_count == 0) {
+		return -EINVAL;
+	}
+
+	int ret = k_mutex_unlock(kernel_mutex);
+
+	if ((ret == 0) && (kernel_mutex->owner != _current)) {
+		kernel_leave(mutex);
+	}
+
+	return ret;
+#else
+	if (kernel_mutex->lock_count == 0) {
 		return -EINVAL;
 	}
 
 	return k_mutex_unlock(kernel_mutex);
+#endif
 }
 
 static inline int z_vrfy_z_sys_mutex_kernel_unlock(struct sys_mutex *mutex)
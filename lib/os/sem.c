@@ -9,7 +9,14 @@
 
 #ifdef CONFIG_USERSPACE
 #define SYS_SEM_MINIMUM      0
-#define SYS_SEM_CONTENDED    (SYS_SEM_MINIMUM - 1)
+
+/* The futex value is the count, which never goes negative. Takers that
+ * find no count register in the waiters counter before waiting for the
+ * value to change, and givers only enter the kernel to wake one of them
+ * up if there are any. Both sides update one variable then read the
+ * other, so either the giver sees the waiter or the waiter sees the
+ * count, and k_futex_wait() rechecks the value under the futex lock.
+ */
 
 static inline atomic_t bounded_dec(atomic_t *val, atomic_t minimum)
 {
@@ -17,7 +24,7 @@ static inline atomic_t bounded_dec(atomic_t *val, atomic_t minimum)
 
 	do {
 		old_value = atomic_get(val);
-		if (old_value < minimum) {
+		if (old_value <= minimum) {
 			break;
 		}
 
@@ -27,8 +34,7 @@ static inline atomic_t bounded_dec(atomic_t *val, atomic_t minimum)
 	return old_value;
 }
 
-static inline atomic_t bounded_inc(atomic_t *val, atomic_t minimum,
-				   atomic_t maximum)
+static inline atomic_t bounded_inc(atomic_t *val, atomic_t maximum)
 {
 	atomic_t old_value, new_value;
 
@@ -38,8 +44,7 @@ static inline atomic_t bounded_inc(atomic_t *val, atomic_t minimum,
 			break;
 		}
 
-		new_value = old_value < minimum ?
-			    minimum + 1 : old_value + 1;
+		new_value = old_value + 1;
 	} while (atomic_cas(val, old_value, new_value) == 0U);
 
 	return old_value;
@@ -55,55 +60,64 @@ int sys_sem_init(struct sys_sem *sem, unsigned int initial_count,
 
 	atomic_set(&sem->futex.val, initial_count);
 	sem->limit = limit;
+	atomic_set(&sem->waiters, 0);
 
 	return 0;
 }
 
 int sys_sem_give(struct sys_sem *sem)
 {
-	int ret = 0;
 	atomic_t old_value;
 
-	old_value = bounded_inc(&sem->futex.val,
-				SYS_SEM_MINIMUM, sem->limit);
-	if (old_value < 0) {
-		ret = k_futex_wake(&sem->futex, true);
+	old_value = bounded_inc(&sem->futex.val, sem->limit);
+	if (old_value >= sem->limit) {
+		return -EAGAIN;
+	}
+
+	/* Uncontended give never enters the kernel */
+	if (atomic_get(&sem->waiters) > 0) {
+		int ret = k_futex_wake(&sem->futex, false);
 
-		if (ret > 0) {
-			return 0;
+		if (ret < 0) {
+			return ret;
 		}
-	} else if (old_value >= sem->limit) {
-		return -EAGAIN;
-	} else {
-		;
 	}
-	return ret;
+
+	return 0;
 }
 
 int sys_sem_take(struct sys_sem *sem, k_timeout_t timeout)
 {
-	int ret = 0;
-	atomic_t old_value;
+	int ret;
+
+	if (bounded_dec(&sem->futex.val, SYS_SEM_MINIMUM) > SYS_SEM_MINIMUM) {
+		return 0;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		return -ETIMEDOUT;
+	}
+
+	atomic_inc(&sem->waiters);
 
 	do {
-		old_value = bounded_dec(&sem->futex.val,
-					SYS_SEM_MINIMUM);
-		if (old_value > 0) {
-			return 0;
+		if (bounded_dec(&sem->futex.val,
+				SYS_SEM_MINIMUM) > SYS_SEM_MINIMUM) {
+			ret = 0;
+			break;
 		}
 
-		ret = k_futex_wait(&sem->futex,
-				   SYS_SEM_CONTENDED, timeout);
+		ret = k_futex_wait(&sem->futex, SYS_SEM_MINIMUM, timeout);
 	} while (ret == 0 || ret == -EAGAIN);
 
+	atomic_dec(&sem->waiters);
+
 	return ret;
 }
 
 unsigned int sys_sem_count_get(struct sys_sem *sem)
 {
-	int value = atomic_get(&sem->futex.val);
-
-	return value > SYS_SEM_MINIMUM ? value : SYS_SEM_MINIMUM;
+	return atomic_get(&sem->futex.val);
 }
 #else
 int sys_sem_init(struct sys_sem *sem, unsigned int initial_count,
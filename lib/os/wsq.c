@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/kernel.h>
+#include <zephyr/sys/wsq.h>
+
+/* Each worker thread owns a deque of queued work items, protected by its
+ * own spinlock. Workers take work items from the tail of their own deque,
+ * most recently submitted first, and steal from the head of the other
+ * deques, oldest first, once theirs is empty. Workers with nothing to do
+ * sleep on the queue semaphore, which submitters give if any worker is
+ * idle.
+ *
+ * Work item state is kept in atomic flags, using the k_work K_WORK_QUEUED,
+ * K_WORK_RUNNING and K_WORK_CANCELING bits. Flags are exactly
+ * K_WORK_QUEUED while the work item is on a deque. State changes happen
+ * with the work item locked, except for taking a work item off a deque,
+ * which only needs the deque lock. Locks are always taken in work item,
+ * then deque order.
+ *
+ * A work item submitted while running is not put on a deque, only flagged
+ * as queued. The worker running it puts it on its own deque once the
+ * handler returns, so deques never hold running work items and a handler
+ * never runs on two workers at once.
+ */
+
+static void deque_push(struct k_wsq_worker *worker, struct k_wsq_work *work)
+{
+	k_spinlock_key_t key = k_spin_lock(&worker->lock);
+
+	work->worker = worker;
+	atomic_set(&work->flags, K_WORK_QUEUED);
+	sys_dlist_append(&worker->deque, &work->node);
+
+	k_spin_unlock(&worker->lock, key);
+}
+
+/* Called with the work item locked. If the work item is on a deque, lock
+ * that deque, so that the work item cannot be taken, and return it.
+ */
+static struct k_wsq_worker *deque_lock_queued(struct k_wsq_work *work,
+					      k_spinlock_key_t *key)
+{
+	struct k_wsq_worker *worker;
+
+	if (atomic_get(&work->flags) != K_WORK_QUEUED) {
+		return NULL;
+	}
+
+	worker = work->worker;
+	*key = k_spin_lock(&worker->lock);
+
+	if (atomic_get(&work->flags) != K_WORK_QUEUED) {
+		/* Taken in the meantime */
+		k_spin_unlock(&worker->lock, *key);
+		return NULL;
+	}
+
+	return worker;
+}
+
+static struct k_wsq_work *deque_take(struct k_wsq_worker *worker, bool steal)
+{
+	k_spinlock_key_t key = k_spin_lock(&worker->lock);
+	struct k_wsq_work *work = NULL;
+	sys_dnode_t *node;
+
+	node = steal ? sys_dlist_peek_head(&worker->deque) :
+		       sys_dlist_peek_tail(&worker->deque);
+	if (node != NULL) {
+		sys_dlist_remove(node);
+		work = CONTAINER_OF(node, struct k_wsq_work, node);
+		atomic_set(&work->flags, K_WORK_RUNNING);
+	}
+
+	k_spin_unlock(&worker->lock, key);
+
+	return work;
+}
+
+/* Own deque first, then steal from the other workers in turn */
+static struct k_wsq_work *worker_take(struct k_wsq_worker *self)
+{
+	struct k_wsq *queue = self->queue;
+	unsigned int n = queue->num_workers;
+	unsigned int first = self - queue->workers;
+	struct k_wsq_work *work;
+
+	for (unsigned int i = 0; i < n; i++) {
+		work = deque_take(&queue->workers[(first + i) % n], i != 0);
+		if (work != NULL) {
+			return work;
+		}
+	}
+
+	return NULL;
+}
+
+/* Called with the work item locked once it is idle */
+static void waiters_notify(struct k_wsq_work *work)
+{
+	sys_snode_t *node;
+
+	while ((node = sys_slist_get(&work->waiters)) != NULL) {
+		struct k_wsq_work_sync *sync =
+			CONTAINER_OF(node, struct k_wsq_work_sync, node);
+
+		k_sem_give(&sync->sem);
+	}
+}
+
+static void waiter_add(struct k_wsq_work *work, struct k_wsq_work_sync *sync)
+{
+	k_sem_init(&sync->sem, 0, 1);
+	sys_slist_append(&work->waiters, &sync->node);
+}
+
+static void work_done(struct k_wsq_worker *self, struct k_wsq_work *work)
+{
+	k_spinlock_key_t key = k_spin_lock(&work->lock);
+
+	if ((atomic_get(&work->flags) & K_WORK_QUEUED) != 0) {
+		/* Submitted again while running */
+		deque_push(self, work);
+	} else {
+		atomic_set(&work->flags, 0);
+		waiters_notify(work);
+	}
+
+	k_spin_unlock(&work->lock, key);
+}
+
+static void wsq_loop(void *p1, void *p2, void *p3)
+{
+	struct k_wsq_worker *self = p1;
+	struct k_wsq *queue = self->queue;
+	struct k_wsq_work *work;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		work = worker_take(self);
+		if (work == NULL) {
+			/* Become idle before looking again, so that a
+			 * concurrent submitter either sees an idle worker to
+			 * wake up or has its work item found here.
+			 */
+			atomic_inc(&queue->idle);
+			work = worker_take(self);
+			if (work == NULL) {
+				(void)k_sem_take(&queue->wake, K_FOREVER);
+			}
+			atomic_dec(&queue->idle);
+
+			if (work == NULL) {
+				continue;
+			}
+		}
+
+		work->handler(work);
+		work_done(self, work);
+	}
+}
+
+void k_wsq_start(struct k_wsq *queue, int prio)
+{
+	uintptr_t ssz = K_THREAD_STACK_LEN(queue->stack_size);
+
+	queue->num_workers = arch_num_cpus();
+	atomic_set(&queue->idle, 0);
+	k_sem_init(&queue->wake, 0, K_SEM_MAX_LIMIT);
+
+	for (unsigned int i = 0; i < queue->num_workers; i++) {
+		queue->workers[i].queue = queue;
+		sys_dlist_init(&queue->workers[i].deque);
+	}
+
+	for (unsigned int i = 0; i < queue->num_workers; i++) {
+		struct k_thread *thread = &queue->workers[i].thread;
+
+		k_thread_create(thread, &queue->stacks[ssz * i],
+				queue->stack_size, wsq_loop,
+				&queue->workers[i], NULL, NULL, prio, 0,
+				K_FOREVER);
+#ifdef CONFIG_SCHED_CPU_MASK
+		(void)k_thread_cpu_pin(thread, i);
+#endif
+		k_thread_start(thread);
+	}
+}
+
+void k_wsq_work_init(struct k_wsq_work *work, k_wsq_handler_t handler)
+{
+	*work = (struct k_wsq_work) {
+		.handler = handler,
+	};
+	sys_slist_init(&work->waiters);
+}
+
+int k_wsq_submit(struct k_wsq *queue, struct k_wsq_work *work)
+{
+	k_spinlock_key_t key = k_spin_lock(&work->lock);
+	atomic_val_t flags = atomic_get(&work->flags);
+	int ret;
+
+	if ((flags & K_WORK_CANCELING) != 0) {
+		ret = -EBUSY;
+	} else if ((flags & K_WORK_QUEUED) != 0) {
+		ret = 0;
+	} else if ((flags & K_WORK_RUNNING) != 0) {
+		/* Queued by the running worker when the handler returns */
+		atomic_or(&work->flags, K_WORK_QUEUED);
+		ret = 2;
+	} else {
+		deque_push(&queue->workers[arch_curr_cpu()->id %
+					   queue->num_workers], work);
+		ret = 1;
+	}
+
+	k_spin_unlock(&work->lock, key);
+
+	if ((ret == 1) && (atomic_get(&queue->idle) > 0)) {
+		k_sem_give(&queue->wake);
+	}
+
+	return ret;
+}
+
+/* Called with the work item locked */
+static int cancel_locked(struct k_wsq_work *work)
+{
+	struct k_wsq_worker *worker;
+	k_spinlock_key_t key;
+
+	worker = deque_lock_queued(work, &key);
+	if (worker != NULL) {
+		sys_dlist_remove(&work->node);
+		atomic_set(&work->flags, 0);
+		k_spin_unlock(&worker->lock, key);
+	} else {
+		/* Drop any resubmission of a running work item */
+		atomic_and(&work->flags, ~K_WORK_QUEUED);
+	}
+
+	if (atomic_get(&work->flags) == 0) {
+		waiters_notify(work);
+	}
+
+	return atomic_get(&work->flags);
+}
+
+int k_wsq_cancel(struct k_wsq_work *work)
+{
+	k_spinlock_key_t key = k_spin_lock(&work->lock);
+	int ret = cancel_locked(work);
+
+	k_spin_unlock(&work->lock, key);
+
+	return ret;
+}
+
+bool k_wsq_cancel_sync(struct k_wsq_work *work, struct k_wsq_work_sync *sync)
+{
+	k_spinlock_key_t key = k_spin_lock(&work->lock);
+	bool pending = atomic_get(&work->flags) != 0;
+	bool need_wait = false;
+
+	if ((cancel_locked(work) & K_WORK_RUNNING) != 0) {
+		atomic_or(&work->flags, K_WORK_CANCELING);
+		waiter_add(work, sync);
+		need_wait = true;
+	}
+
+	k_spin_unlock(&work->lock, key);
+
+	if (need_wait) {
+		(void)k_sem_take(&sync->sem, K_FOREVER);
+	}
+
+	return pending;
+}
+
+bool k_wsq_flush(struct k_wsq_work *work, struct k_wsq_work_sync *sync)
+{
+	k_spinlock_key_t key = k_spin_lock(&work->lock);
+	bool need_wait = atomic_get(&work->flags) != 0;
+
+	if (need_wait) {
+		waiter_add(work, sync);
+	}
+
+	k_spin_unlock(&work->lock, key);
+
+	if (need_wait) {
+		(void)k_sem_take(&sync->sem, K_FOREVER);
+	}
+
+	return need_wait;
+}
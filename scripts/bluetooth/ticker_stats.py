@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2022 The Zephyr Project Contributors
+#
+# SPDX-License-Identifier: Apache-2.0
+"""
+Decode Bluetooth Controller ticker instrumentation events.
+
+Build the controller with CONFIG_BT_TICKER_STATS=y and
+CONFIG_BT_TICKER_STATS_SHELL=y, periodically run the "ticker trace" shell
+command and capture the console output to a file. This script parses the
+captured "TKR" lines and prints per ticker node expiry, skip and latency
+statistics, and a ticker_job execution time summary. Use --csv to dump the
+decoded events instead, one per line.
+
+    ./scripts/bluetooth/ticker_stats.py console.log
+"""
+
+import argparse
+import re
+import sys
+
+EVT_EXPIRE = 0
+EVT_SKIP = 1
+EVT_JOB = 2
+
+EVT_NAMES = {EVT_EXPIRE: "expire", EVT_SKIP: "skip", EVT_JOB: "job"}
+
+TICKER_NULL = 255
+
+RE_EVT = re.compile(r"TKR (\d+) (\d+) ([0-9a-f]{8}) ([0-9a-f]{8}) (\d+)")
+RE_END = re.compile(r"TKR end (\d+) (\d+) (\d+)")
+
+
+class Node:
+    def __init__(self):
+        self.expire = 0
+        self.skip = 0
+        self.lazy_max = 0
+        self.latencies = []
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("logfile", help="captured console output")
+    parser.add_argument("--csv", action="store_true",
+                        help="print decoded events as CSV")
+    return parser.parse_args()
+
+
+def percentile(values, pct):
+    values = sorted(values)
+    idx = min(len(values) - 1, (len(values) * pct) // 100)
+    return values[idx]
+
+
+def main():
+    args = parse_args()
+
+    nodes = {}
+    job_cycles = []
+    dropped = 0
+    us_per_kilotick = None
+
+    if args.csv:
+        print("type,ticker_id,ticks,value,lazy")
+
+    with open(args.logfile, "r", errors="ignore") as f:
+        for line in f:
+            match = RE_END.search(line)
+            if match:
+                dropped += int(match.group(2))
+                us_per_kilotick = int(match.group(3))
+                continue
+
+            match = RE_EVT.search(line)
+            if not match:
+                continue
+
+            evt_type = int(match.group(1))
+            ticker_id = int(match.group(2))
+            ticks = int(match.group(3), 16)
+            value = int(match.group(4), 16)
+            lazy = int(match.group(5))
+
+            if args.csv:
+                print(f"{EVT_NAMES.get(evt_type, evt_type)},{ticker_id},"
+                      f"{ticks},{value},{lazy}")
+                continue
+
+            if evt_type == EVT_JOB:
+                job_cycles.append(value)
+                continue
+
+            node = nodes.setdefault(ticker_id, Node())
+            if evt_type == EVT_EXPIRE:
+                node.expire += 1
+                node.latencies.append(value)
+                if lazy != 0xFFFF:
+                    node.lazy_max = max(node.lazy_max, lazy)
+            elif evt_type == EVT_SKIP:
+                node.skip += 1
+                node.lazy_max = max(node.lazy_max, lazy)
+
+    if args.csv:
+        return 0
+
+    if not nodes and not job_cycles:
+        sys.exit("No ticker events found in " + args.logfile)
+
+    unit = "ticks" if us_per_kilotick is None else "us"
+
+    def to_unit(ticks):
+        if us_per_kilotick is None:
+            return ticks
+        return (ticks * us_per_kilotick) // 1000
+
+    print(f" id   expire     skip lazy_max  lat_p50  lat_p99  lat_max ({unit})")
+    expire = 0
+    skip = 0
+    for ticker_id in sorted(nodes):
+        node = nodes[ticker_id]
+        if node.latencies:
+            p50 = to_unit(percentile(node.latencies, 50))
+            p99 = to_unit(percentile(node.latencies, 99))
+            lmax = to_unit(max(node.latencies))
+        else:
+            p50 = p99 = lmax = 0
+        print(f"{ticker_id:3} {node.expire:8} {node.skip:8} "
+              f"{node.lazy_max:8} {p50:8} {p99:8} {lmax:8}")
+        expire += node.expire
+        skip += node.skip
+
+    if expire + skip:
+        print(f"Scheduling efficiency: {100.0 * expire / (expire + skip):.1f}%"
+              f" ({expire} of {expire + skip})")
+
+    if job_cycles:
+        print(f"Job: count {len(job_cycles)}, "
+              f"p50 {percentile(job_cycles, 50)} cycles, "
+              f"p99 {percentile(job_cycles, 99)} cycles, "
+              f"max {max(job_cycles)} cycles")
+
+    print(f"Events dropped: {dropped}")
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -50,6 +50,8 @@ FMT_MSG_HDR_64 = "IQ"
 # Message type
 # 0: normal message
 # 1: number of dropped messages
+# 2: compact normal message
+# 3: compressed compact normal message
 FMT_MSG_TYPE = "B"
 
 # Depends on CONFIG_LOG_TIMESTAMP_64BIT
@@ -59,6 +61,19 @@ FMT_MSG_TIMESTAMP_64 = "Q"
 # Keep message types in sync with include/logging/log_output_dict.h
 MSG_TYPE_NORMAL = 0
 MSG_TYPE_DROPPED = 1
+MSG_TYPE_NORMAL_COMPACT = 2
+MSG_TYPE_COMPRESSED = 3
+
+# Descriptor byte of compact messages, keep in sync with
+# include/logging/log_output_dict.h.
+COMPACT_SAME_SOURCE = 0x40
+COMPACT_HAS_DATA = 0x80
+
+# Minimum match length of compressed messages
+COMPRESS_MIN_MATCH = 4
+
+# Compressed messages only refer to the last few kilobytes of the stream
+COMPRESS_HISTORY_MAX = 65536
 
 # Number of dropped messages
 FMT_DROPPED_CNT = "H"
@@ -187,8 +202,16 @@ class LogParserV1(LogParser):
         else:
             self.fmt_msg_timestamp = endian + FMT_MSG_TIMESTAMP_32
 
+        self.fmt_pkg_word = endian + "I"
+        self.timestamp_mask = (1 << (8 * struct.calcsize(self.fmt_msg_timestamp))) - 1
+
         self.data_types = DataTypes(self.database)
 
+        # State of the compact message stream
+        self.compact_timestamp = 0
+        self.compact_source_id = 0
+        self.compact_history = bytearray()
+
 
     def __get_string(self, arg, arg_offset, string_tbl):
         one_str = self.database.find_string(arg)
@@ -371,37 +394,192 @@ class LogParserV1(LogParser):
         pkg_len = (log_desc >> 6) & int(math.pow(2, 10) - 1)
         data_len = (log_desc >> 16) & int(math.pow(2, 12) - 1)
 
+        # Skip over data to point to next message (save as return value)
+        next_msg_offset = offset + pkg_len + data_len
+
+        if not self.print_one_msg(domain_id, level, source_id, timestamp,
+                                  logdata[offset:(offset + pkg_len)],
+                                  logdata[(offset + pkg_len):next_msg_offset]):
+            return None
+
+        # Point to next message
+        return next_msg_offset
+
+
+    @staticmethod
+    def read_varint(logdata, offset):
+        """Read a variable length integer, return it and the offset past it"""
+        val = 0
+        shift = 0
+
+        while True:
+            one_byte = logdata[offset]
+            offset += 1
+
+            val |= (one_byte & 0x7F) << shift
+            shift += 7
+
+            if (one_byte & 0x80) == 0:
+                return (val, offset)
+
+
+    def parse_one_compact_msg(self, logdata, offset):
+        """Parse one compact log message and print the encoded message"""
+        desc = logdata[offset]
+        offset += 1
+
+        domain_id = desc & 0x07
+        level = (desc >> 3) & 0x07
+
+        delta, offset = self.read_varint(logdata, offset)
+        timestamp = (self.compact_timestamp + delta) & self.timestamp_mask
+        self.compact_timestamp = timestamp
+
+        if (desc & COMPACT_SAME_SOURCE) == 0:
+            self.compact_source_id, offset = self.read_varint(logdata, offset)
+        source_id = self.compact_source_id
+
+        pkg_len, offset = self.read_varint(logdata, offset)
+
+        data_len = 0
+        if (desc & COMPACT_HAS_DATA) != 0:
+            data_len, offset = self.read_varint(logdata, offset)
+
+        # Words of the package header and arguments, the header
+        # starts with the number of words.
+        pkg = bytearray()
+        word_size = struct.calcsize(self.fmt_pkg_word)
+        num_words = 0
+        if pkg_len >= word_size:
+            num_words = 1
+
+        idx = 0
+        while idx < num_words:
+            word, offset = self.read_varint(logdata, offset)
+            pkg += struct.pack(self.fmt_pkg_word, word)
+
+            if idx == 0:
+                num_words = min(max(pkg[0], 1), int(pkg_len / word_size))
+
+            idx += 1
+
+        # Rest of the package and data
+        rest_len = pkg_len - len(pkg)
+        pkg += logdata[offset:(offset + rest_len)]
+        offset += rest_len
+
+        extra_data = logdata[offset:(offset + data_len)]
+        offset += data_len
+
+        if len(pkg) != pkg_len or len(extra_data) != data_len:
+            logger.error("------ Truncated compact message")
+            return None
+
+        if not self.print_one_msg(domain_id, level, source_id, timestamp,
+                                  bytes(pkg), extra_data):
+            return None
+
+        return offset
+
+
+    def add_compact_history(self, msg):
+        """Add a compact message to the stream matches are found in"""
+        self.compact_history += msg
+
+        if len(self.compact_history) > 2 * COMPRESS_HISTORY_MAX:
+            del self.compact_history[:-COMPRESS_HISTORY_MAX]
+
+
+    @staticmethod
+    def read_seq_len(logdata, offset, length):
+        """Read the bytes added to a length of a compressed sequence"""
+        if length == 15:
+            while True:
+                one_byte = logdata[offset]
+                offset += 1
+                length += one_byte
+
+                if one_byte != 255:
+                    break
+
+        return (length, offset)
+
+
+    def decompress_one_msg(self, logdata, offset):
+        """Decompress one compressed message, return the compact message
+        and the offset of the next message"""
+        msg_len, offset = self.read_varint(logdata, offset)
+
+        hist = self.compact_history
+        start = len(hist)
+
+        while len(hist) - start < msg_len:
+            token = logdata[offset]
+            offset += 1
+
+            lit_len, offset = self.read_seq_len(logdata, offset, token >> 4)
+            hist += logdata[offset:(offset + lit_len)]
+            offset += lit_len
+
+            if len(hist) - start >= msg_len:
+                break
+
+            dist = struct.unpack_from("<H", logdata, offset)[0]
+            offset += 2
+
+            match_len, offset = self.read_seq_len(logdata, offset, token & 0x0F)
+            match_len += COMPRESS_MIN_MATCH
+
+            if dist == 0 or dist > len(hist):
+                logger.error("------ Invalid match distance: %d", dist)
+                return (None, offset)
+
+            # Matches may overlap the bytes they produce
+            for _ in range(match_len):
+                hist.append(hist[-dist])
+
+        msg = bytes(hist[start:])
+        del hist[start:]
+
+        if len(msg) != msg_len:
+            logger.error("------ Invalid compressed message length")
+            return (None, offset)
+
+        self.add_compact_history(msg)
+
+        return (msg, offset)
+
+
+    def print_one_msg(self, domain_id, level, source_id, timestamp, pkg, extra_data):
+        """Print one log message from its package and extra data"""
         level_str, color = get_log_level_str_color(level)
         source_id_str = self.database.get_log_source_string(domain_id, source_id)
 
-        # Skip over data to point to next message (save as return value)
-        next_msg_offset = offset + pkg_len + data_len
+        offset = 0
+        pkg_len = len(pkg)
 
         # Offset from beginning of cbprintf_packaged data to end of va_list arguments
-        offset_end_of_args = struct.unpack_from("B", logdata, offset)[0]
+        offset_end_of_args = struct.unpack_from("B", pkg, offset)[0]
         offset_end_of_args *= self.data_types.get_sizeof(DataTypes.INT)
         offset_end_of_args += offset
 
-        # Extra data after packaged log
-        extra_data = logdata[(offset + pkg_len):next_msg_offset]
-
         # Number of appended strings in package
-        num_packed_strings = struct.unpack_from("B", logdata, offset+1)[0]
+        num_packed_strings = struct.unpack_from("B", pkg, offset+1)[0]
 
         # Number of read-only string indexes
-        num_ro_str_indexes = struct.unpack_from("B", logdata, offset+2)[0]
+        num_ro_str_indexes = struct.unpack_from("B", pkg, offset+2)[0]
         offset_end_of_args += num_ro_str_indexes
 
         # Number of read-write string indexes
-        num_rw_str_indexes = struct.unpack_from("B", logdata, offset+3)[0]
+        num_rw_str_indexes = struct.unpack_from("B", pkg, offset+3)[0]
         offset_end_of_args += num_rw_str_indexes
 
         # Extract the string table in the packaged log message
-        string_tbl = self.extract_string_table(logdata[offset_end_of_args:(offset + pkg_len)])
+        string_tbl = self.extract_string_table(pkg[offset_end_of_args:(offset + pkg_len)])
 
         if len(string_tbl) != num_packed_strings:
             logger.error("------ Error extracting string table")
-            return None
+            return False
 
         # Skip packaged string header
         offset += self.data_types.get_sizeof(DataTypes.PTR)
@@ -413,7 +591,7 @@ class LogParserV1(LogParser):
         # itself is before the va_list, so need to go back the width of
         # a pointer.
         fmt_str_ptr = struct.unpack_from(self.data_types.get_formatter(DataTypes.PTR),
-                                         logdata, offset)[0]
+                                         pkg, offset)[0]
         fmt_str = self.__get_string(fmt_str_ptr,
                                     -self.data_types.get_sizeof(DataTypes.PTR),
                                     string_tbl)
@@ -421,9 +599,9 @@ class LogParserV1(LogParser):
 
         if not fmt_str:
             logger.error("------ Error getting format string at 0x%x", fmt_str_ptr)
-            return None
+            return False
 
-        args = self.process_one_fmt_str(fmt_str, logdata[offset:offset_end_of_args], string_tbl)
+        args = self.process_one_fmt_str(fmt_str, pkg[offset:offset_end_of_args], string_tbl)
 
         fmt_str = formalize_fmt_string(fmt_str)
         log_msg = fmt_str % args
@@ -434,12 +612,11 @@ class LogParserV1(LogParser):
             log_prefix = f"[{timestamp:>10}] <{level_str}> {source_id_str}: "
             print(f"{color}%s%s{Fore.RESET}" % (log_prefix, log_msg))
 
-        if data_len > 0:
+        if len(extra_data) > 0:
             # Has hexdump data
             self.print_hexdump(extra_data, len(log_prefix), color)
 
-        # Point to next message
-        return next_msg_offset
+        return True
 
 
     def parse_log_data(self, logdata, debug=False):
@@ -464,6 +641,24 @@ class LogParserV1(LogParser):
 
                 offset = ret
 
+            elif msg_type == MSG_TYPE_NORMAL_COMPACT:
+                ret = self.parse_one_compact_msg(logdata, offset)
+                if ret is None:
+                    return False
+
+                # Compressed messages may refer to it
+                self.add_compact_history(logdata[(offset - 1):ret])
+                offset = ret
+
+            elif msg_type == MSG_TYPE_COMPRESSED:
+                msg, offset = self.decompress_one_msg(logdata, offset)
+                if msg is None or msg[0] != MSG_TYPE_NORMAL_COMPACT:
+                    logger.error("------ Error decompressing message")
+                    return False
+
+                if self.parse_one_compact_msg(msg, 1) != len(msg):
+                    return False
+
             else:
                 logger.error("------ Unknown message type: %s", msg_type)
                 return False
@@ -5666,6 +5666,49 @@ int hci_acl_handle(struct net_buf *buf, struct net_buf **evt)
 #endif /* CONFIG_BT_CONN */
 
 #if defined(CONFIG_BT_CTLR_ADV_ISO) || defined(CONFIG_BT_CTLR_CONN_ISO)
+#if defined(CONFIG_BT_CTLR_CONN_ISO) && defined(CONFIG_BT_CTLR_ISOAL_SG)
+/* Frame the SDU fragment of an HCI ISO Data packet whose ISO_Data_Load
+ * continues in the fragments of buf, in place, without linearizing them.
+ */
+static int iso_sdu_fragment_sg(isoal_source_handle_t source,
+			       struct isoal_sdu_tx *sdu_frag_tx,
+			       struct net_buf *buf, uint16_t len)
+{
+	struct isoal_sdu_seg seg[CONFIG_BT_CTLR_ISOAL_SG_SEGMENTS];
+	uint8_t seg_cnt;
+
+	/* A zero length SDU is framed from a single empty segment */
+	seg[0].dbuf = buf->data;
+	seg[0].size = 0U;
+	seg_cnt = 0U;
+
+	for (struct net_buf *frag = buf; frag && len; frag = frag->frags) {
+		uint16_t seg_len = MIN(frag->len, len);
+
+		if (!seg_len) {
+			continue;
+		}
+
+		if (seg_cnt == ARRAY_SIZE(seg)) {
+			LOG_ERR("Too many HCI ISO data fragments");
+			return -EINVAL;
+		}
+
+		seg[seg_cnt].dbuf = frag->data;
+		seg[seg_cnt].size = seg_len;
+		seg_cnt++;
+		len -= seg_len;
+	}
+
+	if (isoal_tx_sdu_fragment_sg(source, sdu_frag_tx, seg,
+				     MAX(seg_cnt, 1U))) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_BT_CTLR_CONN_ISO && CONFIG_BT_CTLR_ISOAL_SG */
+
 int hci_iso_handle(struct net_buf *buf, struct net_buf **evt)
 {
 	struct bt_hci_iso_data_hdr *iso_data_hdr;
@@ -5694,7 +5737,12 @@ int hci_iso_handle(struct net_buf *buf, struct net_buf **evt)
 	handle = sys_le16_to_cpu(iso_hdr->handle);
 	len = sys_le16_to_cpu(iso_hdr->len);
 
+#if defined(CONFIG_BT_CTLR_ISOAL_SG)
+	/* The ISO_Data_Load may continue in the fragments of buf */
+	if (net_buf_frags_len(buf) < len) {
+#else /* !CONFIG_BT_CTLR_ISOAL_SG */
 	if (buf->len < len) {
+#endif /* !CONFIG_BT_CTLR_ISOAL_SG */
 		LOG_ERR("Invalid HCI ISO packet length");
 		return -EINVAL;
 	}
@@ -5705,6 +5753,15 @@ int hci_iso_handle(struct net_buf *buf, struct net_buf **evt)
 	ts_flag = bt_iso_flags_ts(flags);
 	handle = bt_iso_handle(handle);
 
+#if defined(CONFIG_BT_CTLR_ISOAL_SG)
+	/* Headers are expected in the first buffer */
+	if (buf->len < ((ts_flag ? sizeof(*time_stamp) : 0U) +
+			(((pb_flag & 0x01) == 0) ? sizeof(*iso_data_hdr) : 0U))) {
+		LOG_ERR("Invalid HCI ISO packet headers");
+		return -EINVAL;
+	}
+#endif /* CONFIG_BT_CTLR_ISOAL_SG */
+
 	/* Extract time stamp */
 	/* Set default to current time
 	 * BT Core V5.3 : Vol 6 Low Energy Controller : Part G IS0-AL:
@@ -5793,6 +5850,14 @@ int hci_iso_handle(struct net_buf *buf, struct net_buf **evt)
 		/* Get input data path's source handle */
 		isoal_source_handle_t source = dp_in->source_hdl;
 
+#if defined(CONFIG_BT_CTLR_ISOAL_SG)
+		if (buf->frags) {
+			/* Start Fragmentation from the fragment chain */
+			return iso_sdu_fragment_sg(source, &sdu_frag_tx, buf,
+						   len);
+		}
+#endif /* CONFIG_BT_CTLR_ISOAL_SG */
+
 		/* Start Fragmentation */
 		if (isoal_tx_sdu_fragment(source, &sdu_frag_tx)) {
 			return -EINVAL;
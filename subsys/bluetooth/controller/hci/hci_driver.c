@@ -98,6 +98,10 @@ isoal_status_t sink_sdu_alloc_hci(const struct isoal_sink    *sink_ctx,
 
 		sdu_buffer->dbuf = buf;
 		sdu_buffer->size = net_buf_tailroom(buf);
+#if defined(CONFIG_BT_CTLR_ISOAL_SG)
+		/* Reassembled into directly when there is no write callback */
+		sdu_buffer->data = net_buf_tail(buf);
+#endif /* CONFIG_BT_CTLR_ISOAL_SG */
 	} else {
 		LL_ASSERT(0);
 	}
@@ -125,6 +129,13 @@ isoal_status_t sink_sdu_emit_hci(const struct isoal_sink             *sink_ctx,
 
 
 	if (buf) {
+#if defined(CONFIG_BT_CTLR_ISOAL_SG)
+		if (!sink_ctx->session.sdu_write) {
+			/* Account for the data reassembled by the ISO-AL */
+			net_buf_add(buf, sdu_frag->sdu_frag_size);
+		}
+#endif /* CONFIG_BT_CTLR_ISOAL_SG */
+
 #if defined(CONFIG_BT_CTLR_CONN_ISO_HCI_DATAPATH_SKIP_INVALID_DATA)
 		if (sdu_frag->sdu.status != ISOAL_SDU_STATUS_VALID) {
 			/* unref buffer if invalid fragment */
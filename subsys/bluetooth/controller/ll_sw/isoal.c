@@ -544,6 +544,32 @@ static isoal_status_t isoal_rx_try_emit_sdu(struct isoal_sink *sink, bool end_of
 	return err;
 }
 
+/**
+ * @brief  Write a chunk of PDU payload at the current SDU write point
+ * @details Without a write callback the payload is reassembled directly into
+ *          the flat storage of the allocated SDU buffer.
+ */
+static inline isoal_status_t isoal_rx_sdu_write(const struct isoal_sink_session *session,
+						const struct isoal_sdu_production *sp,
+						const uint8_t *pdu_payload,
+						size_t consume_len)
+{
+#if defined(CONFIG_BT_CTLR_ISOAL_SG)
+	if (!session->sdu_write) {
+		LL_ASSERT(sp->sdu.contents.data);
+		LL_ASSERT((sp->sdu_written + consume_len) <= sp->sdu.contents.size);
+
+		(void)memcpy(&sp->sdu.contents.data[sp->sdu_written],
+			     pdu_payload, consume_len);
+
+		return ISOAL_STATUS_OK;
+	}
+#endif /* CONFIG_BT_CTLR_ISOAL_SG */
+
+	return session->sdu_write(sp->sdu.contents.dbuf, pdu_payload,
+				  consume_len);
+}
+
 static isoal_status_t isoal_rx_append_to_sdu(struct isoal_sink *sink,
 					     const struct isoal_pdu_rx *pdu_meta,
 					     uint8_t offset,
@@ -570,7 +596,6 @@ static isoal_status_t isoal_rx_append_to_sdu(struct isoal_sink *sink,
 	while ((packet_available > 0) || handle_error_case) {
 		isoal_status_t err_alloc;
 		struct isoal_sdu_production *sp;
-		struct isoal_sdu_produced *sdu;
 
 		err_alloc = ISOAL_STATUS_OK;
 		if (!is_padding) {
@@ -582,7 +607,6 @@ static isoal_status_t isoal_rx_append_to_sdu(struct isoal_sink *sink,
 		}
 
 		sp = &sink->sdu_production;
-		sdu = &sp->sdu;
 
 		err |= err_alloc;
 
@@ -599,8 +623,7 @@ static isoal_status_t isoal_rx_append_to_sdu(struct isoal_sink *sink,
 		if (consume_len > 0) {
 			const struct isoal_sink_session *session = &sink->session;
 
-			err |= session->sdu_write(sdu->contents.dbuf,
-						  pdu_payload,
+			err |= isoal_rx_sdu_write(session, sp, pdu_payload,
 						  consume_len);
 			pdu_payload += consume_len;
 			sp->sdu_written   += consume_len;
@@ -1364,6 +1387,32 @@ void isoal_source_destroy(isoal_source_handle_t hdl)
 	isoal_source_deallocate(hdl);
 }
 
+/**
+ * @brief  Write bytes to the PDU under production
+ * @details Without a write callback the payload is copied directly into the
+ *          allocated PDU, saving an indirect call per segment header and data
+ *          chunk.
+ */
+static inline isoal_status_t isoal_tx_pdu_write(const struct isoal_source_session *session,
+						struct isoal_pdu_buffer *pdu_buffer,
+						const size_t offset,
+						const uint8_t *sdu_payload,
+						const size_t consume_len)
+{
+#if defined(CONFIG_BT_CTLR_ISOAL_SG)
+	if (!session->pdu_write) {
+		LL_ASSERT((offset + consume_len) <= pdu_buffer->size);
+
+		(void)memcpy(&pdu_buffer->pdu->payload[offset], sdu_payload,
+			     consume_len);
+
+		return ISOAL_STATUS_OK;
+	}
+#endif /* CONFIG_BT_CTLR_ISOAL_SG */
+
+	return session->pdu_write(pdu_buffer, offset, sdu_payload, consume_len);
+}
+
 /**
  * Queue the PDU in production in the relevant LL transmit queue. If the
  * attmept to release the PDU fails, the buffer linked to the PDU will be released
@@ -1505,11 +1554,13 @@ static isoal_status_t isoal_tx_try_emit_pdu(struct isoal_source *source,
  *
  * @param source[in,out] Destination source with bookkeeping state
  * @param tx_sdu[in]     SDU with packet boundary information
+ * @param frag_end[in]   Data ends the SDU fragment given by the upper layer
  *
  * @return Status
  */
 static isoal_status_t isoal_tx_unframed_produce(struct isoal_source *source,
-						const struct isoal_sdu_tx *tx_sdu)
+						const struct isoal_sdu_tx *tx_sdu,
+						const bool frag_end)
 {
 	struct isoal_source_session *session;
 	isoal_sdu_len_t packet_available;
@@ -1624,12 +1675,12 @@ static isoal_status_t isoal_tx_unframed_produce(struct isoal_source *source,
 		/* End of the SDU fragment has been reached when the last of the
 		 * SDU is packed into a PDU.
 		 */
-		bool end_of_sdu_frag = !padding_pdu &&
+		bool end_of_sdu_frag = !padding_pdu && frag_end &&
 				((consume_len > 0 && consume_len == packet_available) ||
 					zero_length_sdu);
 
 		if (consume_len > 0) {
-			err |= session->pdu_write(&pdu->contents,
+			err |= isoal_tx_pdu_write(session, &pdu->contents,
 						  pp->pdu_written,
 						  sdu_payload,
 						  consume_len);
@@ -1750,10 +1801,10 @@ static isoal_status_t isoal_insert_seg_header_timeoffset(struct isoal_source *so
 	 */
 	pp->last_seg_hdr_loc = pp->pdu_written;
 	/* Write to PDU */
-	err = session->pdu_write(&pdu->contents,
-				  pp->pdu_written,
-				  (uint8_t *) &seg_hdr,
-				  write_size);
+	err = isoal_tx_pdu_write(session, &pdu->contents,
+				 pp->pdu_written,
+				 (uint8_t *) &seg_hdr,
+				 write_size);
 	pp->pdu_written   += write_size;
 	pp->pdu_available -= write_size;
 
@@ -1790,7 +1841,7 @@ static isoal_status_t isoal_update_seg_header_cmplt_length(struct isoal_source *
 
 
 	/* Re-write the segmentation header at the same location */
-	return session->pdu_write(&pdu->contents,
+	return isoal_tx_pdu_write(session, &pdu->contents,
 				  pp->last_seg_hdr_loc,
 				  (uint8_t *) &seg_hdr,
 				  PDU_ISO_SEG_HDR_SIZE);
@@ -1802,11 +1853,13 @@ static isoal_status_t isoal_update_seg_header_cmplt_length(struct isoal_source *
  *
  * @param source[in,out] Destination source with bookkeeping state
  * @param tx_sdu[in]     SDU with packet boundary information
+ * @param frag_end[in]   Data ends the SDU fragment given by the upper layer
  *
  * @return Status
  */
 static isoal_status_t isoal_tx_framed_produce(struct isoal_source *source,
-						const struct isoal_sdu_tx *tx_sdu)
+						const struct isoal_sdu_tx *tx_sdu,
+						const bool frag_end)
 {
 	struct isoal_source_session *session;
 	struct isoal_pdu_production *pp;
@@ -1964,12 +2017,12 @@ static isoal_status_t isoal_tx_framed_produce(struct isoal_source *source,
 		/* End of the SDU fragment has been reached when the last of the
 		 * SDU is packed into a PDU.
 		 */
-		bool end_of_sdu_frag = !padding_pdu &&
+		bool end_of_sdu_frag = !padding_pdu && frag_end &&
 				((consume_len > 0 && consume_len == packet_available) ||
 					zero_length_sdu);
 
 		if (consume_len > 0) {
-			err |= session->pdu_write(&pdu->contents,
+			err |= isoal_tx_pdu_write(session, &pdu->contents,
 						  pp->pdu_written,
 						  sdu_payload,
 						  consume_len);
@@ -2097,9 +2150,112 @@ isoal_status_t isoal_tx_sdu_fragment(isoal_source_handle_t source_hdl,
 		 *     Controller shall use framed PDUs.
 		 */
 		if (source->session.framed) {
-			err = isoal_tx_framed_produce(source, tx_sdu);
+			err = isoal_tx_framed_produce(source, tx_sdu, true);
 		} else {
-			err = isoal_tx_unframed_produce(source, tx_sdu);
+			err = isoal_tx_unframed_produce(source, tx_sdu, true);
+		}
+	}
+
+	source->context_active = false;
+
+	if (source->timeout_trigger) {
+		source->timeout_trigger = false;
+		if (session->framed) {
+			isoal_tx_framed_event_prepare_handle(source_hdl,
+						source->timeout_event_count);
+		}
+	}
+
+	return err;
+}
+
+#if defined(CONFIG_BT_CTLR_ISOAL_SG)
+/**
+ * @brief Fragment an SDU fragment held in several host buffers into PDU(s)
+ * @details The segments are framed in place, in order, as if they were one
+ *          contiguous SDU fragment with the packet boundary of tx_sdu. This
+ *          avoids linearizing the host buffers before handing them over.
+ *          The dbuf and size members of tx_sdu are ignored.
+ *
+ * @param source_hdl[in] Handle of destination source
+ * @param tx_sdu[in]     SDU timing and packet boundary information
+ * @param seg[in]        Segments of the SDU fragment
+ * @param seg_cnt[in]    Number of segments, at least one
+ * @return Status
+ */
+isoal_status_t isoal_tx_sdu_fragment_sg(isoal_source_handle_t source_hdl,
+					struct isoal_sdu_tx *tx_sdu,
+					const struct isoal_sdu_seg *seg,
+					uint8_t seg_cnt)
+{
+	struct isoal_source_session *session;
+	struct isoal_source *source;
+	struct isoal_sdu_tx seg_sdu;
+	uint8_t first;
+	uint8_t last;
+	bool sdu_start;
+	bool sdu_end;
+	isoal_status_t err;
+
+	LL_ASSERT(seg && seg_cnt);
+
+	source = &isoal_global.source_state[source_hdl];
+	session = &source->session;
+	err = ISOAL_STATUS_ERR_PDU_ALLOC;
+
+	sdu_start = (tx_sdu->sdu_state == BT_ISO_START) ||
+		    (tx_sdu->sdu_state == BT_ISO_SINGLE);
+	sdu_end = (tx_sdu->sdu_state == BT_ISO_END) ||
+		  (tx_sdu->sdu_state == BT_ISO_SINGLE);
+
+	/* Empty segments do not contribute to the SDU. If all are empty, the
+	 * first one is produced with the packet boundary given by the caller,
+	 * which covers zero length SDUs.
+	 */
+	first = 0U;
+	while ((first < (seg_cnt - 1U)) && !seg[first].size) {
+		first++;
+	}
+
+	last = seg_cnt - 1U;
+	while ((last > first) && !seg[last].size) {
+		last--;
+	}
+
+	seg_sdu = *tx_sdu;
+
+	source->context_active = true;
+
+	if (source->pdu_production.mode != ISOAL_PRODUCTION_MODE_DISABLED) {
+		err = ISOAL_STATUS_OK;
+
+		for (uint8_t i = first; (i <= last) && !err; i++) {
+			const bool seg_start = sdu_start && (i == first);
+			const bool seg_end = sdu_end && (i == last);
+
+			if (!seg[i].size && (i != first)) {
+				continue;
+			}
+
+			seg_sdu.dbuf = (void *)seg[i].dbuf;
+			seg_sdu.size = seg[i].size;
+			if (seg_start) {
+				seg_sdu.sdu_state = seg_end ? BT_ISO_SINGLE : BT_ISO_START;
+			} else {
+				seg_sdu.sdu_state = seg_end ? BT_ISO_END : BT_ISO_CONT;
+			}
+
+			/* Only the last segment completes the upper layer's
+			 * SDU fragment, so that PDUs report the same number of
+			 * completed fragments as for a contiguous fragment.
+			 */
+			if (session->framed) {
+				err = isoal_tx_framed_produce(source, &seg_sdu,
+							      (i == last));
+			} else {
+				err = isoal_tx_unframed_produce(source, &seg_sdu,
+								(i == last));
+			}
 		}
 	}
 
@@ -2115,6 +2271,7 @@ isoal_status_t isoal_tx_sdu_fragment(isoal_source_handle_t source_hdl,
 
 	return err;
 }
+#endif /* CONFIG_BT_CTLR_ISOAL_SG */
 
 void isoal_tx_pdu_release(isoal_source_handle_t source_hdl,
 			  struct node_tx_iso *node_tx)
@@ -87,6 +87,12 @@ struct isoal_sdu_buffer {
 	void *dbuf;
 	/** Number of bytes accessible behind the dbuf pointer */
 	isoal_sdu_len_t  size;
+#if defined(CONFIG_BT_CTLR_ISOAL_SG)
+	/** Flat storage of the size bytes, e.g. in a preallocated slab. Sinks
+	 *  without SDU write callback reassemble directly into it.
+	 */
+	uint8_t         *data;
+#endif /* CONFIG_BT_CTLR_ISOAL_SG */
 };
 
 
@@ -196,6 +202,16 @@ struct isoal_sdu_tx {
 	uint64_t target_event:39;
 };
 
+#if defined(CONFIG_BT_CTLR_ISOAL_SG)
+/** @brief Contiguous segment of an SDU fragment held in a host buffer */
+struct isoal_sdu_seg {
+	/** Segment data, read in place by the ISO-AL */
+	const uint8_t   *dbuf;
+	/** Number of bytes in the segment */
+	isoal_sdu_len_t size;
+};
+#endif /* CONFIG_BT_CTLR_ISOAL_SG */
+
 
 
 /* Forward declaration */
@@ -237,6 +253,11 @@ typedef isoal_status_t (*isoal_sink_sdu_emit_cb)(
 
 /**
  * @brief  Callback: Write a number of bytes to SDU buffer
+ *
+ * With CONFIG_BT_CTLR_ISOAL_SG a NULL callback may be given, in which case
+ * the ISO-AL reassembles directly into the data member of the SDU buffer
+ * provided at allocation. The SDU allocator must then set it, and the emit
+ * callback accounts for the sdu_frag_size bytes written.
  */
 typedef isoal_status_t (*isoal_sink_sdu_write_cb)(
 	/*!< [in]  Destination buffer */
@@ -340,6 +361,9 @@ typedef isoal_status_t (*isoal_source_pdu_release_cb)(
 
 /**
  * @brief  Callback: Write a number of bytes to PDU buffer
+ *
+ * With CONFIG_BT_CTLR_ISOAL_SG a NULL callback may be given, in which case
+ * the ISO-AL copies directly into the payload of the allocated PDU.
  */
 typedef isoal_status_t (*isoal_source_pdu_write_cb)(
 	/*!< [out]  PDU under production */
@@ -487,6 +511,13 @@ void isoal_source_destroy(isoal_source_handle_t hdl);
 isoal_status_t isoal_tx_sdu_fragment(isoal_source_handle_t source_hdl,
 				     struct isoal_sdu_tx *tx_sdu);
 
+#if defined(CONFIG_BT_CTLR_ISOAL_SG)
+isoal_status_t isoal_tx_sdu_fragment_sg(isoal_source_handle_t source_hdl,
+					struct isoal_sdu_tx *tx_sdu,
+					const struct isoal_sdu_seg *seg,
+					uint8_t seg_cnt);
+#endif /* CONFIG_BT_CTLR_ISOAL_SG */
+
 void isoal_tx_pdu_release(isoal_source_handle_t source_hdl,
 			  struct node_tx_iso *node_tx);
 
@@ -405,7 +405,9 @@ uint8_t ll_setup_iso_path(uint16_t handle, uint8_t path_dir, uint8_t path_id,
 						sdu_interval, iso_interval,
 						stream_sync_delay, group_sync_delay,
 						sink_sdu_alloc_hci, sink_sdu_emit_hci,
-						sink_sdu_write_hci, &sink_handle);
+						IS_ENABLED(CONFIG_BT_CTLR_ISOAL_SG) ?
+						NULL : sink_sdu_write_hci,
+						&sink_handle);
 		} else {
 			/* Set up vendor specific data path */
 			isoal_sink_sdu_alloc_cb sdu_alloc;
@@ -457,7 +459,8 @@ uint8_t ll_setup_iso_path(uint16_t handle, uint8_t path_dir, uint8_t path_id,
 		 * or that the vendor specific path is the same.
 		 */
 		pdu_alloc   = ll_iso_pdu_alloc;
-		pdu_write   = ll_iso_pdu_write;
+		pdu_write   = IS_ENABLED(CONFIG_BT_CTLR_ISOAL_SG) ? NULL :
+			      ll_iso_pdu_write;
 		pdu_emit    = ll_iso_pdu_emit;
 		pdu_release = ll_iso_pdu_release;
 
@@ -505,7 +508,9 @@ uint8_t ll_setup_iso_path(uint16_t handle, uint8_t path_dir, uint8_t path_id,
 					sdu_interval, iso_interval,
 					stream_sync_delay, group_sync_delay,
 					sink_sdu_alloc_hci, sink_sdu_emit_hci,
-					sink_sdu_write_hci, &sink_handle);
+					IS_ENABLED(CONFIG_BT_CTLR_ISOAL_SG) ?
+					NULL : sink_sdu_write_hci,
+					&sink_handle);
 	} else {
 		/* Set up vendor specific data path */
 		isoal_sink_sdu_alloc_cb sdu_alloc;
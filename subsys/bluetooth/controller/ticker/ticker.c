@@ -6,9 +6,15 @@
  */
 
 #include <stdbool.h>
+#include <string.h>
 #include <zephyr/types.h>
 #include <soc.h>
 
+#if defined(CONFIG_BT_TICKER_STATS)
+#include <zephyr/kernel.h>
+#endif /* CONFIG_BT_TICKER_STATS */
+
+#include "hal/cpu.h"
 #include "hal/cntr.h"
 #include "hal/ticker.h"
 
@@ -296,10 +302,142 @@ BUILD_ASSERT(sizeof(struct ticker_user_op) == TICKER_USER_OP_T_SIZE);
 #define TICKER_INSTANCE_MAX 1
 static struct ticker_instance _instance[TICKER_INSTANCE_MAX];
 
+#if defined(CONFIG_BT_TICKER_STATS)
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_BT_TICKER_STATS_EVT_COUNT));
+
+/* Ticker instrumentation data. Counters and the event ring are only written
+ * from ticker_worker and ticker_job, which never execute concurrently (see
+ * worker_trigger and job_guard), hence there is a single producer. The event
+ * ring is consumed by one thread, e.g. the shell, without any locking.
+ */
+static struct {
+	struct ticker_stats_node node[CONFIG_BT_TICKER_STATS_NODE_COUNT];
+	struct ticker_stats_job  job;
+	struct ticker_stats_evt  evt[CONFIG_BT_TICKER_STATS_EVT_COUNT];
+	uint32_t evt_dropped;
+	volatile uint32_t evt_wr;
+	volatile uint32_t evt_rd;
+} stats;
+#endif /* CONFIG_BT_TICKER_STATS */
+
 /*****************************************************************************
  * Static Functions
  ****************************************************************************/
 
+#if defined(CONFIG_BT_TICKER_STATS)
+/**
+ * @brief Record a ticker instrumentation event
+ *
+ * @details Pushes an event into the lock-free single producer, single
+ * consumer event ring. If the consumer has not kept up, the event is
+ * dropped and counted.
+ *
+ * @param type      Event type, one of TICKER_STATS_EVT_XXX
+ * @param ticker_id Id of ticker node, or TICKER_NULL for job events
+ * @param ticks     Absolute ticks at which the event occurred
+ * @param value     Event specific value
+ * @param lazy      Lazy count of ticker node at event
+ *
+ * @internal
+ */
+static void ticker_stats_evt_put(uint8_t type, uint8_t ticker_id,
+				 uint32_t ticks, uint32_t value, uint16_t lazy)
+{
+	struct ticker_stats_evt *evt;
+	uint32_t wr = stats.evt_wr;
+
+	if ((wr - stats.evt_rd) >= CONFIG_BT_TICKER_STATS_EVT_COUNT) {
+		stats.evt_dropped++;
+		return;
+	}
+
+	evt = &stats.evt[wr & (CONFIG_BT_TICKER_STATS_EVT_COUNT - 1U)];
+	evt->ticks = ticks;
+	evt->value = value;
+	evt->lazy = lazy;
+	evt->ticker_id = ticker_id;
+	evt->type = type;
+
+	cpu_dmb(); /* Ensure event is written before it is published */
+	stats.evt_wr = wr + 1U;
+}
+
+/**
+ * @brief Account a ticker node expiry in instrumentation data
+ *
+ * @param ticker_id       Id of expired ticker node
+ * @param ticks_at_expire Absolute ticks at which the node was due
+ * @param ticks_now       Absolute ticks at which the timeout callback was
+ *                        invoked
+ * @param lazy            Lazy count passed to the timeout callback
+ *
+ * @internal
+ */
+static void ticker_stats_expire(uint8_t ticker_id, uint32_t ticks_at_expire,
+				uint32_t ticks_now, uint16_t lazy)
+{
+	uint32_t latency;
+
+	latency = ticker_ticks_diff_get(ticks_now, ticks_at_expire);
+	if (ticker_id < CONFIG_BT_TICKER_STATS_NODE_COUNT) {
+		struct ticker_stats_node *node = &stats.node[ticker_id];
+
+		node->expire++;
+		node->latency_sum += latency;
+		node->latency_max = MAX(node->latency_max, latency);
+		if (lazy != TICKER_LAZY_MUST_EXPIRE) {
+			node->lazy_max = MAX(node->lazy_max, lazy);
+		}
+	}
+
+	ticker_stats_evt_put(TICKER_STATS_EVT_EXPIRE, ticker_id,
+			     ticks_at_expire, latency, lazy);
+}
+
+/**
+ * @brief Account a ticker node skipped due to collision
+ *
+ * @param ticker_id Id of skipped ticker node
+ * @param ticks     Absolute ticks at which the node was due
+ * @param lazy      Lazy count of the node after the skip
+ *
+ * @internal
+ */
+static void ticker_stats_skip(uint8_t ticker_id, uint32_t ticks, uint16_t lazy)
+{
+	if (ticker_id < CONFIG_BT_TICKER_STATS_NODE_COUNT) {
+		struct ticker_stats_node *node = &stats.node[ticker_id];
+
+		node->skip++;
+		node->lazy_max = MAX(node->lazy_max, lazy);
+	}
+
+	ticker_stats_evt_put(TICKER_STATS_EVT_SKIP, ticker_id, ticks, 0U,
+			     lazy);
+}
+
+/**
+ * @brief Account a ticker_job execution in instrumentation data
+ *
+ * @param cycles_start Hardware cycle count when ticker_job started
+ *
+ * @internal
+ */
+static void ticker_stats_job(uint32_t cycles_start)
+{
+	uint32_t cycles = k_cycle_get_32() - cycles_start;
+
+	stats.job.count++;
+	stats.job.cycles_sum += cycles;
+	stats.job.cycles_max = MAX(stats.job.cycles_max, cycles);
+
+	if (IS_ENABLED(CONFIG_BT_TICKER_STATS_JOB_EVT)) {
+		ticker_stats_evt_put(TICKER_STATS_EVT_JOB, TICKER_NULL,
+				     cntr_cnt_get(), cycles, 0U);
+	}
+}
+#endif /* CONFIG_BT_TICKER_STATS */
+
 /**
  * @brief Update elapsed index
  *
@@ -1033,6 +1171,15 @@ void ticker_worker(void *param)
 				 * ticker node. Mark it as elapsed.
 				 */
 				ticker->ack--;
+
+#if defined(CONFIG_BT_TICKER_STATS)
+				ticker_stats_skip(ticker - node,
+						  (instance->ticks_current +
+						   ticks_expired) &
+						  HAL_TICKER_CNTR_MASK,
+						  ticker->lazy_current);
+#endif /* CONFIG_BT_TICKER_STATS */
+
 				continue;
 			}
 			/* Continue but perform shallow expiry */
@@ -1066,12 +1213,20 @@ void ticker_worker(void *param)
 
 		if (ticker->timeout_func) {
 			uint32_t ticks_at_expire;
+#if defined(CONFIG_BT_TICKER_STATS)
+			uint32_t ticks_now;
+#endif /* CONFIG_BT_TICKER_STATS */
 
 			ticks_at_expire = (instance->ticks_current +
 					   ticks_expired -
 					   ticker->ticks_to_expire_minus) &
 					   HAL_TICKER_CNTR_MASK;
 
+#if defined(CONFIG_BT_TICKER_STATS)
+			/* Latency up to the callback, not including it */
+			ticks_now = cntr_cnt_get();
+#endif /* CONFIG_BT_TICKER_STATS */
+
 			DEBUG_TICKER_TASK(1);
 			/* Invoke the timeout callback */
 			ticker->timeout_func(ticks_at_expire,
@@ -1084,6 +1239,13 @@ void ticker_worker(void *param)
 					     ticker->context);
 			DEBUG_TICKER_TASK(0);
 
+#if defined(CONFIG_BT_TICKER_STATS)
+			ticker_stats_expire(ticker - node, ticks_at_expire,
+					    ticks_now, must_expire_skip ?
+					    TICKER_LAZY_MUST_EXPIRE :
+					    ticker->lazy_current);
+#endif /* CONFIG_BT_TICKER_STATS */
+
 			if (!IS_ENABLED(CONFIG_BT_TICKER_LOW_LAT) &&
 			   (must_expire_skip == 0U)) {
 				/* Reset latency to periodic offset */
@@ -2551,6 +2713,9 @@ void ticker_job(void *param)
 	uint8_t insert_head;
 	uint32_t ticks_now;
 	uint8_t pending;
+#if defined(CONFIG_BT_TICKER_STATS)
+	uint32_t cycles_start;
+#endif /* CONFIG_BT_TICKER_STATS */
 
 	DEBUG_TICKER_JOB(1);
 
@@ -2568,6 +2733,10 @@ void ticker_job(void *param)
 	}
 	instance->job_guard = 1U;
 
+#if defined(CONFIG_BT_TICKER_STATS)
+	cycles_start = k_cycle_get_32();
+#endif /* CONFIG_BT_TICKER_STATS */
+
 	/* Back up the previous known tick */
 	ticks_previous = instance->ticks_current;
 
@@ -2659,6 +2828,10 @@ void ticker_job(void *param)
 		compare_trigger = 0U;
 	}
 
+#if defined(CONFIG_BT_TICKER_STATS)
+	ticker_stats_job(cycles_start);
+#endif /* CONFIG_BT_TICKER_STATS */
+
 	/* Permit worker to run */
 	instance->job_guard = 0U;
 
@@ -3411,3 +3584,87 @@ uint32_t ticker_ticks_diff_get(uint32_t ticks_now, uint32_t ticks_old)
 {
 	return ((ticks_now - ticks_old) & HAL_TICKER_CNTR_MASK);
 }
+
+#if defined(CONFIG_BT_TICKER_STATS)
+/**
+ * @brief Get instrumentation counters of a ticker node
+ *
+ * @param ticker_id Id of ticker node
+ * @param node      Pointer to counters to populate
+ *
+ * @return TICKER_STATUS_SUCCESS, or TICKER_STATUS_FAILURE if the ticker id is
+ * outside the instrumented range
+ */
+uint32_t ticker_stats_node_get(uint8_t ticker_id,
+			       struct ticker_stats_node *node)
+{
+	if (ticker_id >= CONFIG_BT_TICKER_STATS_NODE_COUNT) {
+		return TICKER_STATUS_FAILURE;
+	}
+
+	*node = stats.node[ticker_id];
+
+	return TICKER_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Get ticker_job execution counters
+ *
+ * @param job Pointer to counters to populate
+ */
+void ticker_stats_job_get(struct ticker_stats_job *job)
+{
+	*job = stats.job;
+}
+
+/**
+ * @brief Get oldest recorded instrumentation event
+ *
+ * @details Dequeues from the event ring. Shall only be called from a single
+ * consumer context.
+ *
+ * @param evt Pointer to event to populate
+ *
+ * @return true if an event was dequeued, false if the ring is empty
+ */
+bool ticker_stats_evt_get(struct ticker_stats_evt *evt)
+{
+	uint32_t rd = stats.evt_rd;
+
+	if (rd == stats.evt_wr) {
+		return false;
+	}
+
+	cpu_dmb(); /* Ensure event is read after it was published */
+	*evt = stats.evt[rd & (CONFIG_BT_TICKER_STATS_EVT_COUNT - 1U)];
+
+	cpu_dmb(); /* Ensure event is read before slot is released */
+	stats.evt_rd = rd + 1U;
+
+	return true;
+}
+
+/**
+ * @brief Get number of events dropped due to a full event ring
+ *
+ * @return Number of dropped events
+ */
+uint32_t ticker_stats_evt_dropped_get(void)
+{
+	return stats.evt_dropped;
+}
+
+/**
+ * @brief Reset instrumentation counters and flush the event ring
+ *
+ * @details Counters updated concurrently by ticker_worker or ticker_job may
+ * be partially reset. Shall be called from the event ring consumer context.
+ */
+void ticker_stats_reset(void)
+{
+	(void)memset(stats.node, 0, sizeof(stats.node));
+	(void)memset(&stats.job, 0, sizeof(stats.job));
+	stats.evt_dropped = 0U;
+	stats.evt_rd = stats.evt_wr;
+}
+#endif /* CONFIG_BT_TICKER_STATS */
@@ -168,6 +168,60 @@ void ticker_job_sched(uint8_t instance_index, uint8_t user_id);
 uint32_t ticker_ticks_now_get(void);
 uint32_t ticker_ticks_diff_get(uint32_t ticks_now, uint32_t ticks_old);
 
+#if defined(CONFIG_BT_TICKER_STATS)
+/** \defgroup Timer instrumentation event types.
+ *
+ * @{
+ */
+#define TICKER_STATS_EVT_EXPIRE 0 /**< Node expired, value is latency in
+				    * ticks.
+				    */
+#define TICKER_STATS_EVT_SKIP   1 /**< Node skipped due to collision. */
+#define TICKER_STATS_EVT_JOB    2 /**< ticker_job executed, value is
+				    * execution time in cycles.
+				    */
+/**
+ * @}
+ */
+
+/** \brief Timer node instrumentation counters.
+ */
+struct ticker_stats_node {
+	uint32_t expire;      /* Number of timeout callbacks invoked */
+	uint32_t skip;        /* Number of expiries skipped by collision */
+	uint32_t lazy_max;    /* Maximum lazy count observed */
+	uint32_t latency_max; /* Maximum ticks from due expiry to callback */
+	uint32_t latency_sum; /* Accumulated ticks from due expiry to
+			       * callback
+			       */
+};
+
+/** \brief Timer job instrumentation counters.
+ */
+struct ticker_stats_job {
+	uint32_t count;      /* Number of ticker_job executions */
+	uint32_t cycles_max; /* Maximum execution time in cycles */
+	uint32_t cycles_sum; /* Accumulated execution time in cycles */
+};
+
+/** \brief Timer instrumentation event.
+ */
+struct ticker_stats_evt {
+	uint32_t ticks;     /* Absolute ticks of the event */
+	uint32_t value;     /* Event type specific value */
+	uint16_t lazy;      /* Lazy count of the node */
+	uint8_t  ticker_id; /* Ticker node id, TICKER_NULL for job */
+	uint8_t  type;      /* One of TICKER_STATS_EVT_XXX */
+};
+
+uint32_t ticker_stats_node_get(uint8_t ticker_id,
+			       struct ticker_stats_node *node);
+void ticker_stats_job_get(struct ticker_stats_job *job);
+bool ticker_stats_evt_get(struct ticker_stats_evt *evt);
+uint32_t ticker_stats_evt_dropped_get(void);
+void ticker_stats_reset(void);
+#endif /* CONFIG_BT_TICKER_STATS */
+
 #if !defined(CONFIG_BT_TICKER_LOW_LAT) && \
 	!defined(CONFIG_BT_TICKER_SLOT_AGNOSTIC)
 uint32_t ticker_priority_set(uint8_t instance_index, uint8_t user_id,
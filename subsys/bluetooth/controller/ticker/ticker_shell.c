@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdbool.h>
+#include <zephyr/types.h>
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+
+#include "hal/ticker.h"
+
+#include "ticker.h"
+
+/* Prefix of event lines emitted by "ticker trace", parsed by
+ * scripts/bluetooth/ticker_stats.py
+ */
+#define TRACE_PREFIX "TKR"
+
+static int cmd_stats(const struct shell *sh, size_t argc, char *argv[])
+{
+	struct ticker_stats_job job;
+	uint32_t expire = 0U;
+	uint32_t skip = 0U;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(sh, " id   expire     skip lazy_max lat_avg_us lat_max_us");
+
+	for (uint16_t id = 0U; id < CONFIG_BT_TICKER_STATS_NODE_COUNT; id++) {
+		struct ticker_stats_node node;
+		uint32_t latency_avg;
+
+		(void)ticker_stats_node_get(id, &node);
+		if (!node.expire && !node.skip) {
+			continue;
+		}
+
+		latency_avg = node.expire ? (node.latency_sum / node.expire) :
+			      0U;
+
+		shell_print(sh, "%3u %8u %8u %8u %10u %10u", id, node.expire,
+			    node.skip, node.lazy_max,
+			    HAL_TICKER_TICKS_TO_US(latency_avg),
+			    HAL_TICKER_TICKS_TO_US(node.latency_max));
+
+		expire += node.expire;
+		skip += node.skip;
+	}
+
+	if (expire || skip) {
+		shell_print(sh, "Scheduling efficiency: %u%% (%u of %u)",
+			    (uint32_t)(((uint64_t)expire * 100U) /
+				       (expire + skip)),
+			    expire, expire + skip);
+	}
+
+	ticker_stats_job_get(&job);
+	shell_print(sh, "Job: count %u, avg %u us, max %u us", job.count,
+		    job.count ? k_cyc_to_us_floor32(job.cycles_sum / job.count) :
+		    0U,
+		    k_cyc_to_us_floor32(job.cycles_max));
+	shell_print(sh, "Events dropped: %u", ticker_stats_evt_dropped_get());
+
+	return 0;
+}
+
+static int cmd_trace(const struct shell *sh, size_t argc, char *argv[])
+{
+	struct ticker_stats_evt evt;
+	uint32_t count = 0U;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	while (ticker_stats_evt_get(&evt)) {
+		shell_print(sh, TRACE_PREFIX " %u %u %08x %08x %u", evt.type,
+			    evt.ticker_id, evt.ticks, evt.value, evt.lazy);
+		count++;
+	}
+
+	shell_print(sh, TRACE_PREFIX " end %u %u %u", count,
+		    ticker_stats_evt_dropped_get(),
+		    HAL_TICKER_TICKS_TO_US(1000U));
+
+	return 0;
+}
+
+static int cmd_reset(const struct shell *sh, size_t argc, char *argv[])
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	ticker_stats_reset();
+
+	shell_print(sh, "Ticker instrumentation reset");
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(ticker_cmds,
+	SHELL_CMD_ARG(stats, NULL, "Print per node and job counters",
+		      cmd_stats, 1, 0),
+	SHELL_CMD_ARG(trace, NULL, "Drain event ring for host decoding",
+		      cmd_trace, 1, 0),
+	SHELL_CMD_ARG(reset, NULL, "Reset counters and flush event ring",
+		      cmd_reset, 1, 0),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(ticker, &ticker_cmds, "Ticker instrumentation commands",
+		   NULL);
@@ -354,6 +354,124 @@ int bt_mesh_net_decrypt(const uint8_t key[16], struct net_buf_simple *buf,
 			      &buf->data[7], mic_len);
 }
 
+#if defined(CONFIG_BT_MESH_NET_KEY_SCHED)
+int bt_mesh_key_sched_set(struct tc_aes_key_sched_struct *sched,
+			  const uint8_t key[16])
+{
+	if (tc_aes128_set_encrypt_key(sched, key) == TC_CRYPTO_FAIL) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+int bt_mesh_net_obfuscate_sched(uint8_t *pdu, uint32_t iv_index,
+				const struct tc_aes_key_sched_struct *privacy)
+{
+	uint8_t priv_rand[16] = { 0x00, 0x00, 0x00, 0x00, 0x00, };
+	uint8_t tmp[16];
+	int i;
+
+	LOG_DBG("IVIndex %u", iv_index);
+
+	sys_put_be32(iv_index, &priv_rand[5]);
+	memcpy(&priv_rand[9], &pdu[7], 7);
+
+	LOG_DBG("PrivacyRandom %s", bt_hex(priv_rand, 16));
+
+	if (tc_aes_encrypt(tmp, priv_rand, (TCAesKeySched_t)privacy) ==
+	    TC_CRYPTO_FAIL) {
+		return -EINVAL;
+	}
+
+	for (i = 0; i < 6; i++) {
+		pdu[1 + i] ^= tmp[i];
+	}
+
+	return 0;
+}
+
+static int net_ccm_config(struct tc_ccm_mode_struct *ccm,
+			  const struct tc_aes_key_sched_struct *enc,
+			  uint8_t nonce[13], const uint8_t *pdu,
+			  uint32_t iv_index, bool proxy)
+{
+	if (IS_ENABLED(CONFIG_BT_MESH_PROXY) && proxy) {
+		create_proxy_nonce(nonce, pdu, iv_index);
+	} else {
+		create_net_nonce(nonce, pdu, iv_index);
+	}
+
+	LOG_DBG("Nonce %s", bt_hex(nonce, 13));
+
+	/* TinyCrypt only reads from the key schedule */
+	if (tc_ccm_config(ccm, (TCAesKeySched_t)enc, nonce, 13,
+			  NET_MIC_LEN(pdu)) == TC_CRYPTO_FAIL) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+int bt_mesh_net_encrypt_sched(const struct tc_aes_key_sched_struct *enc,
+			      struct net_buf_simple *buf, uint32_t iv_index,
+			      bool proxy)
+{
+	uint8_t mic_len = NET_MIC_LEN(buf->data);
+	struct tc_ccm_mode_struct ccm;
+	uint8_t nonce[13];
+	int err;
+
+	LOG_DBG("IVIndex %u mic_len %u", iv_index, mic_len);
+	LOG_DBG("PDU (len %u) %s", buf->len, bt_hex(buf->data, buf->len));
+
+	err = net_ccm_config(&ccm, enc, nonce, buf->data, iv_index, proxy);
+	if (err) {
+		return err;
+	}
+
+	if (tc_ccm_generation_encryption(&buf->data[7],
+					 buf->len - 7 + mic_len, NULL, 0,
+					 &buf->data[7], buf->len - 7,
+					 &ccm) == TC_CRYPTO_FAIL) {
+		return -EINVAL;
+	}
+
+	net_buf_simple_add(buf, mic_len);
+
+	return 0;
+}
+
+int bt_mesh_net_decrypt_sched(const struct tc_aes_key_sched_struct *enc,
+			      struct net_buf_simple *buf, uint32_t iv_index,
+			      bool proxy)
+{
+	uint8_t mic_len = NET_MIC_LEN(buf->data);
+	struct tc_ccm_mode_struct ccm;
+	uint8_t nonce[13];
+	int err;
+
+	LOG_DBG("PDU (%u bytes) %s", buf->len, bt_hex(buf->data, buf->len));
+	LOG_DBG("iv_index %u mic_len %u", iv_index, mic_len);
+
+	err = net_ccm_config(&ccm, enc, nonce, buf->data, iv_index, proxy);
+	if (err) {
+		return err;
+	}
+
+	buf->len -= mic_len;
+
+	if (tc_ccm_decryption_verification(&buf->data[7], buf->len - 7, NULL, 0,
+					   &buf->data[7],
+					   buf->len - 7 + mic_len,
+					   &ccm) == TC_CRYPTO_FAIL) {
+		return -EBADMSG;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_BT_MESH_NET_KEY_SCHED */
+
 static void create_app_nonce(uint8_t nonce[13],
 			     const struct bt_mesh_app_crypto_ctx *ctx)
 {
@@ -89,6 +89,24 @@ int bt_mesh_net_encrypt(const uint8_t key[16], struct net_buf_simple *buf,
 int bt_mesh_net_decrypt(const uint8_t key[16], struct net_buf_simple *buf,
 			uint32_t iv_index, bool proxy);
 
+#if defined(CONFIG_BT_MESH_NET_KEY_SCHED)
+struct tc_aes_key_sched_struct;
+
+int bt_mesh_key_sched_set(struct tc_aes_key_sched_struct *sched,
+			  const uint8_t key[16]);
+
+int bt_mesh_net_obfuscate_sched(uint8_t *pdu, uint32_t iv_index,
+				const struct tc_aes_key_sched_struct *privacy);
+
+int bt_mesh_net_encrypt_sched(const struct tc_aes_key_sched_struct *enc,
+			      struct net_buf_simple *buf, uint32_t iv_index,
+			      bool proxy);
+
+int bt_mesh_net_decrypt_sched(const struct tc_aes_key_sched_struct *enc,
+			      struct net_buf_simple *buf, uint32_t iv_index,
+			      bool proxy);
+#endif
+
 
 struct bt_mesh_app_crypto_ctx {
 	bool dev_key;
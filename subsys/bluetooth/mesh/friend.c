@@ -504,12 +504,12 @@ static int encrypt_friend_pdu(struct bt_mesh_friend *frnd, struct net_buf *buf,
 
 	buf->data[0] = (cred->nid | (iv_index & 1) << 7);
 
-	if (bt_mesh_net_encrypt(cred->enc, &buf->b, iv_index, false)) {
+	if (bt_mesh_net_cred_encrypt(cred, &buf->b, iv_index, false)) {
 		LOG_ERR("Encrypting failed");
 		return -EINVAL;
 	}
 
-	if (bt_mesh_net_obfuscate(buf->data, iv_index, cred->privacy)) {
+	if (bt_mesh_net_cred_obfuscate(cred, buf->data, iv_index)) {
 		LOG_ERR("Obfuscating failed");
 		return -EINVAL;
 	}
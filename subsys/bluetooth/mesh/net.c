@@ -461,12 +461,12 @@ static int net_encrypt(struct net_buf_simple *buf,
 {
 	int err;
 
-	err = bt_mesh_net_encrypt(cred->enc, buf, iv_index, proxy);
+	err = bt_mesh_net_cred_encrypt(cred, buf, iv_index, proxy);
 	if (err) {
 		return err;
 	}
 
-	return bt_mesh_net_obfuscate(buf->data, iv_index, cred->privacy);
+	return bt_mesh_net_cred_obfuscate(cred, buf->data, iv_index);
 }
 
 int bt_mesh_net_encode(struct bt_mesh_net_tx *tx, struct net_buf_simple *buf,
@@ -621,8 +621,8 @@ static bool net_decrypt(struct bt_mesh_net_rx *rx, struct net_buf_simple *in,
 	net_buf_simple_reset(out);
 	net_buf_simple_add_mem(out, in->data, in->len);
 
-	if (bt_mesh_net_obfuscate(out->data, BT_MESH_NET_IVI_RX(rx),
-				  cred->privacy)) {
+	if (bt_mesh_net_cred_obfuscate(cred, out->data,
+				       BT_MESH_NET_IVI_RX(rx))) {
 		return false;
 	}
 
@@ -644,8 +644,8 @@ static bool net_decrypt(struct bt_mesh_net_rx *rx, struct net_buf_simple *in,
 
 	LOG_DBG("src 0x%04x", rx->ctx.addr);
 
-	return bt_mesh_net_decrypt(cred->enc, out, BT_MESH_NET_IVI_RX(rx),
-				   proxy) == 0;
+	return bt_mesh_net_cred_decrypt(cred, out, BT_MESH_NET_IVI_RX(rx),
+					proxy) == 0;
 }
 
 /* Relaying from advertising to the advertising bearer should only happen
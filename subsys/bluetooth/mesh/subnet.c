@@ -282,7 +282,23 @@ static void subnet_del(struct bt_mesh_subnet *sub)
 static int msg_cred_create(struct bt_mesh_net_cred *cred, const uint8_t *p,
 			   size_t p_len, const uint8_t key[16])
 {
-	return bt_mesh_k2(key, p, p_len, &cred->nid, cred->enc, cred->privacy);
+	int err;
+
+	err = bt_mesh_k2(key, p, p_len, &cred->nid, cred->enc, cred->privacy);
+	if (err) {
+		return err;
+	}
+
+#if defined(CONFIG_BT_MESH_NET_KEY_SCHED)
+	err = bt_mesh_key_sched_set(&cred->enc_sched, cred->enc);
+	if (err) {
+		return err;
+	}
+
+	err = bt_mesh_key_sched_set(&cred->privacy_sched, cred->privacy);
+#endif
+
+	return err;
 }
 
 static int net_keys_create(struct bt_mesh_subnet_keys *keys,
@@ -460,6 +476,38 @@ int bt_mesh_friend_cred_create(struct bt_mesh_net_cred *cred, uint16_t lpn_addr,
 	return msg_cred_create(cred, p, sizeof(p), key);
 }
 
+int bt_mesh_net_cred_encrypt(const struct bt_mesh_net_cred *cred,
+			     struct net_buf_simple *buf, uint32_t iv_index,
+			     bool proxy)
+{
+#if defined(CONFIG_BT_MESH_NET_KEY_SCHED)
+	return bt_mesh_net_encrypt_sched(&cred->enc_sched, buf, iv_index, proxy);
+#else
+	return bt_mesh_net_encrypt(cred->enc, buf, iv_index, proxy);
+#endif
+}
+
+int bt_mesh_net_cred_decrypt(const struct bt_mesh_net_cred *cred,
+			     struct net_buf_simple *buf, uint32_t iv_index,
+			     bool proxy)
+{
+#if defined(CONFIG_BT_MESH_NET_KEY_SCHED)
+	return bt_mesh_net_decrypt_sched(&cred->enc_sched, buf, iv_index, proxy);
+#else
+	return bt_mesh_net_decrypt(cred->enc, buf, iv_index, proxy);
+#endif
+}
+
+int bt_mesh_net_cred_obfuscate(const struct bt_mesh_net_cred *cred,
+			       uint8_t *pdu, uint32_t iv_index)
+{
+#if defined(CONFIG_BT_MESH_NET_KEY_SCHED)
+	return bt_mesh_net_obfuscate_sched(pdu, iv_index, &cred->privacy_sched);
+#else
+	return bt_mesh_net_obfuscate(pdu, iv_index, cred->privacy);
+#endif
+}
+
 uint8_t bt_mesh_subnet_kr_phase_set(uint16_t net_idx, uint8_t *phase)
 {
 	/* Table in Bluetooth Mesh Profile Specification Section 4.2.14: */
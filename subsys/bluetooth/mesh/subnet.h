@@ -11,6 +11,9 @@
 #include <sys/types.h>
 #include <zephyr/net/buf.h>
 #include <zephyr/kernel.h>
+#if defined(CONFIG_BT_MESH_NET_KEY_SCHED)
+#include <tinycrypt/aes.h>
+#endif
 
 #define BT_MESH_NET_FLAG_KR       BIT(0)
 #define BT_MESH_NET_FLAG_IVU      BIT(1)
@@ -31,6 +34,10 @@ struct bt_mesh_net_cred {
 	uint8_t nid;         /* NID */
 	uint8_t enc[16];     /* EncKey */
 	uint8_t privacy[16]; /* PrivacyKey */
+#if defined(CONFIG_BT_MESH_NET_KEY_SCHED)
+	struct tc_aes_key_sched_struct enc_sched;     /* Expanded EncKey */
+	struct tc_aes_key_sched_struct privacy_sched; /* Expanded PrivacyKey */
+#endif
 };
 
 /** Subnet instance. */
@@ -151,6 +158,44 @@ int bt_mesh_friend_cred_create(struct bt_mesh_net_cred *cred,
 			       uint16_t lpn_counter, uint16_t frnd_counter,
 			       const uint8_t key[16]);
 
+/** @brief Encrypt a network PDU with the given network credentials.
+ *
+ *  @param cred     Network credentials.
+ *  @param buf      Network PDU to encrypt in place. The NetMIC is appended.
+ *  @param iv_index IV Index to use.
+ *  @param proxy    Whether to use the proxy nonce.
+ *
+ *  @return 0 on success, or (negative) error code on failure.
+ */
+int bt_mesh_net_cred_encrypt(const struct bt_mesh_net_cred *cred,
+			     struct net_buf_simple *buf, uint32_t iv_index,
+			     bool proxy);
+
+/** @brief Decrypt a network PDU with the given network credentials.
+ *
+ *  @param cred     Network credentials.
+ *  @param buf      Deobfuscated network PDU to decrypt in place. The NetMIC
+ *                  is removed.
+ *  @param iv_index IV Index to use.
+ *  @param proxy    Whether to use the proxy nonce.
+ *
+ *  @return 0 on success, or (negative) error code on failure.
+ */
+int bt_mesh_net_cred_decrypt(const struct bt_mesh_net_cred *cred,
+			     struct net_buf_simple *buf, uint32_t iv_index,
+			     bool proxy);
+
+/** @brief Obfuscate or deobfuscate a network PDU header.
+ *
+ *  @param cred     Network credentials.
+ *  @param pdu      Network PDU.
+ *  @param iv_index IV Index to use.
+ *
+ *  @return 0 on success, or (negative) error code on failure.
+ */
+int bt_mesh_net_cred_obfuscate(const struct bt_mesh_net_cred *cred,
+			       uint8_t *pdu, uint32_t iv_index);
+
 /** @brief Iterate through all valid network credentials to decrypt a message.
  *
  *  @param rx Network RX parameters, passed to the callback.
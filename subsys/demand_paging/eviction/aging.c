@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Aging least recently used (LRU) approximation eviction algorithm for
+ * demand paging
+ */
+#include <zephyr/kernel.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+
+/* Every page frame has an 8-bit age. On each periodic update the age is
+ * shifted right by one, and its most significant bit set if the page frame
+ * was accessed during the last period, after which the accessed state is
+ * cleared. The age thus records whether the page was used in each of the
+ * last eight periods, recent periods weighing more, and a lower age means
+ * less recently used.
+ *
+ * To keep page fault handling from walking every page frame, a selection
+ * examines at most CONFIG_EVICTION_LRU_AGING_WINDOW evictable page frames,
+ * starting where the previous selection stopped, and evicts the one with
+ * the lowest rank. Pages accessed during the current period rank above any
+ * age, and dirty pages rank above clean pages of the same age since they
+ * need to be paged out first.
+ */
+static uint8_t ages[Z_NUM_PAGE_FRAMES];
+static size_t hand;
+
+static void aging_periodic_update(struct k_timer *timer)
+{
+	uintptr_t phys, flags;
+	struct z_page_frame *pf;
+	unsigned int key = irq_lock();
+
+	Z_PAGE_FRAME_FOREACH(phys, pf) {
+		uint8_t *age = &ages[pf - z_page_frames];
+
+		if (!z_page_frame_is_evictable(pf)) {
+			continue;
+		}
+
+		flags = arch_page_info_get(pf->addr, NULL, false);
+
+		*age >>= 1;
+		if ((flags & ARCH_DATA_PAGE_ACCESSED) != 0UL) {
+			*age |= BIT(7);
+
+			/* Clear accessed bit in page tables */
+			(void)arch_page_info_get(pf->addr, NULL, true);
+		}
+	}
+
+	irq_unlock(key);
+}
+
+struct z_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	struct z_page_frame *last_pf = NULL;
+	unsigned int last_rank = UINT_MAX;
+	unsigned int candidates = 0U;
+	unsigned long scanned;
+	bool last_dirty = false;
+	bool accessed, dirty;
+	uintptr_t flags;
+
+	for (scanned = 0U; scanned < Z_NUM_PAGE_FRAMES; scanned++) {
+		struct z_page_frame *pf;
+		unsigned int rank;
+
+		if (candidates == CONFIG_EVICTION_LRU_AGING_WINDOW) {
+			break;
+		}
+
+		pf = &z_page_frames[hand];
+		hand++;
+		if (hand == Z_NUM_PAGE_FRAMES) {
+			hand = 0U;
+		}
+
+		if (!z_page_frame_is_evictable(pf)) {
+			continue;
+		}
+		candidates++;
+
+		flags = arch_page_info_get(pf->addr, NULL, false);
+		accessed = (flags & ARCH_DATA_PAGE_ACCESSED) != 0UL;
+		dirty = (flags & ARCH_DATA_PAGE_DIRTY) != 0UL;
+
+		/* Implies a mismatch with page frame ontology and page
+		 * tables
+		 */
+		__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0U,
+			 "non-present page, %s",
+			 ((flags & ARCH_DATA_PAGE_NOT_MAPPED) != 0U) ?
+			 "un-mapped" : "paged out");
+
+		rank = (((accessed ? BIT(8) : 0U) | ages[pf - z_page_frames]) << 1) |
+		       (dirty ? 1U : 0U);
+		if (rank < last_rank) {
+			last_rank = rank;
+			last_pf = pf;
+			last_dirty = dirty;
+		}
+
+		if (rank == 0U) {
+			/* Not accessed for eight periods and clean, we're done */
+			scanned++;
+			break;
+		}
+	}
+	/* Shouldn't ever happen unless every page is pinned */
+	__ASSERT(last_pf != NULL, "no page to evict");
+
+	/* The age belongs to the evicted data page, not the page frame */
+	ages[last_pf - z_page_frames] = 0U;
+
+	z_paging_stats_eviction_scanned(scanned);
+
+	*dirty_ptr = last_dirty;
+
+	return last_pf;
+}
+
+static K_TIMER_DEFINE(aging_timer, aging_periodic_update, NULL);
+
+void k_mem_paging_eviction_init(void)
+{
+	k_timer_start(&aging_timer, K_NO_WAIT,
+		      K_MSEC(CONFIG_EVICTION_LRU_AGING_PERIOD));
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Clock (second chance) eviction algorithm for demand paging
+ */
+#include <zephyr/kernel.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+
+/* The hand points at the next page frame to examine. It sweeps the page
+ * frames in physical address order and wraps around, resuming from where
+ * the previous selection stopped.
+ *
+ * An evictable page frame that has been accessed since the hand last passed
+ * it gets a second chance: its accessed state is cleared and the hand moves
+ * on. The first evictable page frame found not accessed is evicted. As one
+ * full revolution clears the accessed state of every evictable page frame,
+ * a selection never examines more than two revolutions worth of page frames.
+ */
+static size_t hand;
+
+struct z_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	struct z_page_frame *pf = NULL;
+	unsigned long scanned;
+	uintptr_t flags;
+
+	for (scanned = 0U; scanned < (2U * Z_NUM_PAGE_FRAMES); scanned++) {
+		struct z_page_frame *cur = &z_page_frames[hand];
+
+		hand++;
+		if (hand == Z_NUM_PAGE_FRAMES) {
+			hand = 0U;
+		}
+
+		if (!z_page_frame_is_evictable(cur)) {
+			continue;
+		}
+
+		flags = arch_page_info_get(cur->addr, NULL, false);
+
+		/* Implies a mismatch with page frame ontology and page
+		 * tables
+		 */
+		__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0U,
+			 "non-present page, %s",
+			 ((flags & ARCH_DATA_PAGE_NOT_MAPPED) != 0U) ?
+			 "un-mapped" : "paged out");
+
+		if ((flags & ARCH_DATA_PAGE_ACCESSED) == 0UL) {
+			pf = cur;
+			*dirty_ptr = (flags & ARCH_DATA_PAGE_DIRTY) != 0UL;
+			scanned++;
+			break;
+		}
+
+		/* Second chance, clear accessed bit in page tables */
+		(void)arch_page_info_get(cur->addr, NULL, true);
+	}
+	/* Shouldn't ever happen unless every page is pinned */
+	__ASSERT(pf != NULL, "no page to evict");
+
+	z_paging_stats_eviction_scanned(scanned);
+
+	return pf;
+}
+
+void k_mem_paging_eviction_init(void)
+{
+}
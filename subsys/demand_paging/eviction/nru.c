@@ -48,10 +48,12 @@ struct z_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
 	bool last_dirty = false;
 	bool dirty = false;
 	uintptr_t flags, phys;
+	unsigned long scanned = 0U;
 
 	Z_PAGE_FRAME_FOREACH(phys, pf) {
 		unsigned int prec;
 
+		scanned++;
 		if (!z_page_frame_is_evictable(pf)) {
 			continue;
 		}
@@ -85,6 +87,8 @@ struct z_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
 	/* Shouldn't ever happen unless every page is pinned */
 	__ASSERT(last_pf != NULL, "no page to evict");
 
+	z_paging_stats_eviction_scanned(scanned);
+
 	*dirty_ptr = last_dirty;
 
 	return last_pf;
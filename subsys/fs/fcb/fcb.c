@@ -107,6 +107,12 @@ fcb_init(int f_area_id, struct fcb *fcb)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_FCB_INDEX
+	if (fcb->f_index && fcb->f_index_size == 0U) {
+		return -EINVAL;
+	}
+#endif
+
 	rc = flash_area_open(f_area_id, &fcb->fap);
 	if (rc != 0) {
 		return -EINVAL;
@@ -170,6 +176,9 @@ fcb_init(int f_area_id, struct fcb *fcb)
 			break;
 		}
 	}
+#ifdef CONFIG_FCB_INDEX
+	fcb_index_build(fcb);
+#endif
 	k_mutex_init(&fcb->f_mtx);
 	return rc;
 }
@@ -270,6 +279,9 @@ fcb_sector_hdr_init(struct fcb *fcb, struct flash_sector *sector, uint16_t id)
 	if (rc != 0) {
 		return -EIO;
 	}
+#ifdef CONFIG_FCB_INDEX
+	fcb_index_clear(fcb, sector);
+#endif
 	return 0;
 }
 
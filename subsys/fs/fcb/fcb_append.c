@@ -136,5 +136,15 @@ fcb_append_finish(struct fcb *fcb, struct fcb_entry *loc)
 	if (rc) {
 		return -EIO;
 	}
+#ifdef CONFIG_FCB_INDEX
+	if (fcb->f_index) {
+		rc = k_mutex_lock(&fcb->f_mtx, K_FOREVER);
+		if (rc) {
+			return -EINVAL;
+		}
+		fcb_index_add(fcb, loc);
+		k_mutex_unlock(&fcb->f_mtx);
+	}
+#endif
 	return 0;
 }
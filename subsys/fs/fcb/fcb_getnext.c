@@ -6,6 +6,7 @@
  */
 
 #include <stddef.h>
+#include <stdbool.h>
 
 #include <zephyr/fs/fcb.h>
 #include "fcb_priv.h"
@@ -40,11 +41,38 @@ fcb_getnext_sector(struct fcb *fcb, struct flash_sector *sector)
 	return sector;
 }
 
+#ifdef CONFIG_FCB_INDEX
+static int
+fcb_index_getnext(struct fcb *fcb, struct fcb_entry *loc)
+{
+	if (loc->fe_sector == NULL) {
+		loc->fe_sector = fcb->f_oldest;
+		loc->fe_elem_off = 0U;
+	}
+
+	while (fcb_index_getnext_in_sector(fcb, loc) != 0) {
+		if (loc->fe_sector == fcb->f_active.fe_sector) {
+			return -ENOTSUP;
+		}
+		loc->fe_sector = fcb_getnext_sector(fcb, loc->fe_sector);
+		loc->fe_elem_off = 0U;
+	}
+
+	return 0;
+}
+#endif
+
 int
 fcb_getnext_nolock(struct fcb *fcb, struct fcb_entry *loc)
 {
 	int rc;
 
+#ifdef CONFIG_FCB_INDEX
+	if (fcb->f_index) {
+		return fcb_index_getnext(fcb, loc);
+	}
+#endif
+
 	if (loc->fe_sector == NULL) {
 		/*
 		 * Find the first one we have in flash.
@@ -119,3 +147,102 @@ fcb_getnext(struct fcb *fcb, struct fcb_entry *loc)
 
 	return rc;
 }
+
+static struct flash_sector *
+fcb_getprev_sector(struct fcb *fcb, struct flash_sector *sector)
+{
+	if (sector == &fcb->f_sectors[0]) {
+		sector = &fcb->f_sectors[fcb->f_sector_cnt];
+	}
+	return sector - 1;
+}
+
+/*
+ * Find the last element of the sector at loc placed before the given offset.
+ */
+static int
+fcb_getprev_in_sector(struct fcb *fcb, struct fcb_entry *loc, uint32_t before)
+{
+	struct fcb_entry it;
+	bool found = false;
+	int rc;
+
+	/* Walk the sector from its first element */
+	it.fe_sector = loc->fe_sector;
+	it.fe_elem_off = fcb_len_in_flash(fcb, sizeof(struct fcb_disk_area));
+
+#ifdef CONFIG_FCB_INDEX
+	if (fcb->f_index) {
+		rc = fcb_index_getprev_in_sector(fcb, &it, before);
+		if (rc != -EAGAIN) {
+			if (rc == 0) {
+				*loc = it;
+			}
+			return rc;
+		}
+
+		/* or on from the last indexed element */
+		*loc = it;
+		found = true;
+		it.fe_elem_off = it.fe_data_off +
+			fcb_len_in_flash(fcb, it.fe_data_len) +
+			fcb_len_in_flash(fcb, FCB_CRC_SZ);
+	}
+#endif
+
+	rc = fcb_elem_info(fcb, &it);
+	while ((rc == 0) || (rc == -EBADMSG)) {
+		if (it.fe_elem_off >= before) {
+			break;
+		}
+		if (rc == 0) {
+			*loc = it;
+			found = true;
+		}
+		it.fe_elem_off = it.fe_data_off +
+			fcb_len_in_flash(fcb, it.fe_data_len) +
+			fcb_len_in_flash(fcb, FCB_CRC_SZ);
+		rc = fcb_elem_info(fcb, &it);
+	}
+
+	return found ? 0 : -ENOTSUP;
+}
+
+int
+fcb_getprev_nolock(struct fcb *fcb, struct fcb_entry *loc)
+{
+	uint32_t before = loc->fe_elem_off;
+
+	if (loc->fe_sector == NULL) {
+		/*
+		 * Find the newest one we have in flash.
+		 */
+		loc->fe_sector = fcb->f_active.fe_sector;
+		before = UINT32_MAX;
+	}
+
+	while (fcb_getprev_in_sector(fcb, loc, before) != 0) {
+		if (loc->fe_sector == fcb->f_oldest) {
+			return -ENOTSUP;
+		}
+		loc->fe_sector = fcb_getprev_sector(fcb, loc->fe_sector);
+		before = UINT32_MAX;
+	}
+
+	return 0;
+}
+
+int
+fcb_getprev(struct fcb *fcb, struct fcb_entry *loc)
+{
+	int rc;
+
+	rc = k_mutex_lock(&fcb->f_mtx, K_FOREVER);
+	if (rc) {
+		return -EINVAL;
+	}
+	rc = fcb_getprev_nolock(fcb, loc);
+	k_mutex_unlock(&fcb->f_mtx);
+
+	return rc;
+}
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/fs/fcb.h>
+#include "fcb_priv.h"
+
+/*
+ * The index of a sector holds the offsets of its valid elements in ascending
+ * order, followed by unused entries with an offset of 0. When all its
+ * entries are used, the elements following the last indexed one are found
+ * by reading the flash.
+ */
+
+static struct fcb_index_entry *
+fcb_index_get(struct fcb *fcb, const struct flash_sector *sector)
+{
+	return &fcb->f_index[(sector - fcb->f_sectors) * fcb->f_index_size];
+}
+
+/* Number of used entries */
+static size_t fcb_index_count(struct fcb *fcb, const struct fcb_index_entry *ie)
+{
+	size_t lo = 0;
+	size_t hi = fcb->f_index_size;
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (ie[mid].ie_elem_off != 0U) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
+/* Position of the first entry with an offset above off */
+static size_t fcb_index_upper(const struct fcb_index_entry *ie, size_t count,
+			      uint32_t off)
+{
+	size_t lo = 0;
+	size_t hi = count;
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (ie[mid].ie_elem_off <= off) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
+static void fcb_index_load(struct fcb *fcb, const struct fcb_index_entry *ie,
+			   struct fcb_entry *loc)
+{
+	loc->fe_elem_off = ie->ie_elem_off;
+	loc->fe_data_off = ie->ie_elem_off +
+		fcb_len_in_flash(fcb, (ie->ie_data_len < 0x80) ? 1 : 2);
+	loc->fe_data_len = ie->ie_data_len;
+}
+
+void fcb_index_clear(struct fcb *fcb, struct flash_sector *sector)
+{
+	if (fcb->f_index == NULL) {
+		return;
+	}
+
+	memset(fcb_index_get(fcb, sector), 0,
+	       fcb->f_index_size * sizeof(struct fcb_index_entry));
+}
+
+void fcb_index_add(struct fcb *fcb, const struct fcb_entry *loc)
+{
+	struct fcb_index_entry *ie;
+	size_t count;
+	size_t pos;
+
+	if (fcb->f_index == NULL) {
+		return;
+	}
+
+	ie = fcb_index_get(fcb, loc->fe_sector);
+	count = fcb_index_count(fcb, ie);
+	pos = fcb_index_upper(ie, count, loc->fe_elem_off);
+
+	if ((pos > 0) && (ie[pos - 1].ie_elem_off == loc->fe_elem_off)) {
+		return;
+	}
+
+	if (count == fcb->f_index_size) {
+		if (pos == count) {
+			/* Found by reading the flash past the index */
+			return;
+		}
+		/* The last element is then found by reading the flash */
+		count--;
+	}
+
+	memmove(&ie[pos + 1], &ie[pos], (count - pos) * sizeof(*ie));
+	ie[pos].ie_elem_off = loc->fe_elem_off;
+	ie[pos].ie_data_len = loc->fe_data_len;
+}
+
+static void fcb_index_build_sector(struct fcb *fcb, struct flash_sector *sector)
+{
+	struct fcb_index_entry *ie = fcb_index_get(fcb, sector);
+	struct fcb_entry loc = {
+		.fe_sector = sector,
+		.fe_elem_off = fcb_len_in_flash(fcb, sizeof(struct fcb_disk_area)),
+	};
+	size_t count = 0;
+	int rc;
+
+	rc = fcb_elem_info(fcb, &loc);
+	while (((rc == 0) || (rc == -EBADMSG)) && (count < fcb->f_index_size)) {
+		if (rc == 0) {
+			ie[count].ie_elem_off = loc.fe_elem_off;
+			ie[count].ie_data_len = loc.fe_data_len;
+			count++;
+		}
+		loc.fe_elem_off = loc.fe_data_off +
+			fcb_len_in_flash(fcb, loc.fe_data_len) +
+			fcb_len_in_flash(fcb, FCB_CRC_SZ);
+		rc = fcb_elem_info(fcb, &loc);
+	}
+}
+
+void fcb_index_build(struct fcb *fcb)
+{
+	struct flash_sector *sector = fcb->f_oldest;
+
+	if (fcb->f_index == NULL) {
+		return;
+	}
+
+	memset(fcb->f_index, 0, fcb->f_sector_cnt * fcb->f_index_size *
+	       sizeof(struct fcb_index_entry));
+
+	while (true) {
+		fcb_index_build_sector(fcb, sector);
+		if (sector == fcb->f_active.fe_sector) {
+			break;
+		}
+		sector = fcb_getnext_sector(fcb, sector);
+	}
+}
+
+int fcb_index_getnext_in_sector(struct fcb *fcb, struct fcb_entry *loc)
+{
+	struct fcb_index_entry *ie = fcb_index_get(fcb, loc->fe_sector);
+	size_t count = fcb_index_count(fcb, ie);
+	size_t pos = fcb_index_upper(ie, count, loc->fe_elem_off);
+
+	if (pos < count) {
+		fcb_index_load(fcb, &ie[pos], loc);
+		return 0;
+	}
+
+	if (count < fcb->f_index_size) {
+		return -ENOTSUP;
+	}
+
+	/* Past the index, loc is at or after the last indexed element */
+	if (fcb_getnext_in_sector(fcb, loc) != 0) {
+		return -ENOTSUP;
+	}
+
+	return 0;
+}
+
+int fcb_index_getprev_in_sector(struct fcb *fcb, struct fcb_entry *loc,
+				uint32_t before)
+{
+	struct fcb_index_entry *ie = fcb_index_get(fcb, loc->fe_sector);
+	size_t count = fcb_index_count(fcb, ie);
+	size_t pos;
+
+	if ((count == fcb->f_index_size) &&
+	    (before > ie[count - 1].ie_elem_off + 1U)) {
+		/* The preceding element may be past the index, found by
+		 * reading the flash from the last indexed one.
+		 */
+		fcb_index_load(fcb, &ie[count - 1], loc);
+		return -EAGAIN;
+	}
+
+	pos = fcb_index_upper(ie, count, before - 1U);
+	if (pos == 0) {
+		return -ENOTSUP;
+	}
+
+	fcb_index_load(fcb, &ie[pos - 1], loc);
+
+	return 0;
+}
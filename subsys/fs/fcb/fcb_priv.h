@@ -68,10 +68,20 @@ int fcb_getnext_in_sector(struct fcb *fcb, struct fcb_entry *loc);
 struct flash_sector *fcb_getnext_sector(struct fcb *fcb,
 					struct flash_sector *sector);
 int fcb_getnext_nolock(struct fcb *fcb, struct fcb_entry *loc);
+int fcb_getprev_nolock(struct fcb *fcb, struct fcb_entry *loc);
 
 int fcb_elem_info(struct fcb *fcb, struct fcb_entry *loc);
 int fcb_elem_crc8(struct fcb *fcb, struct fcb_entry *loc, uint8_t *crc8p);
 
+#ifdef CONFIG_FCB_INDEX
+void fcb_index_build(struct fcb *fcb);
+void fcb_index_clear(struct fcb *fcb, struct flash_sector *sector);
+void fcb_index_add(struct fcb *fcb, const struct fcb_entry *loc);
+int fcb_index_getnext_in_sector(struct fcb *fcb, struct fcb_entry *loc);
+int fcb_index_getprev_in_sector(struct fcb *fcb, struct fcb_entry *loc,
+				uint32_t before);
+#endif
+
 int fcb_sector_hdr_init(struct fcb *fcb, struct flash_sector *sector, uint16_t id);
 int fcb_sector_hdr_read(struct fcb *fcb, struct flash_sector *sector,
 			struct fcb_disk_area *fdap);
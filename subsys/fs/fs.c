@@ -79,15 +79,16 @@ static const struct fs_file_system_t *fs_type_get(int type)
 	return (ep != NULL) ? ep->fstp : NULL;
 }
 
-static int fs_get_mnt_point(struct fs_mount_t **mnt_pntp,
-			    const char *name, size_t *match_len)
+/* Find the mount point of a path by comparing it with every mount point.
+ * Must be called with the lock held.
+ */
+static struct fs_mount_t *mnt_list_find(const char *name, size_t name_len)
 {
 	struct fs_mount_t *mnt_p = NULL, *itr;
 	size_t longest_match = 0;
-	size_t len, name_len = strlen(name);
+	size_t len;
 	sys_dnode_t *node;
 
-	k_mutex_lock(&mutex, K_FOREVER);
 	SYS_DLIST_FOR_EACH_NODE(&fs_mnt_list, node) {
 		itr = CONTAINER_OF(node, struct fs_mount_t, node);
 		len = itr->mountp_len;
@@ -115,8 +116,181 @@ static int fs_get_mnt_point(struct fs_mount_t **mnt_pntp,
 			longest_match = len;
 		}
 	}
+
+	return mnt_p;
+}
+
+#ifdef CONFIG_FILE_SYSTEM_MOUNT_INDEX
+/* Hash table of mount points, with linear probing. It is rebuilt with the
+ * lock held on every mount and unmount, the sequence count being odd while
+ * it is. Lookups read it without the lock and are repeated under the lock
+ * if the sequence count changed meanwhile.
+ */
+#define MNT_INDEX_SIZE CONFIG_FILE_SYSTEM_MOUNT_INDEX_SIZE
+
+/* Number of path prefixes a lookup probes at most */
+#define MNT_INDEX_PREFIXES 8
+
+#define MNT_HASH_BASIS 2166136261U
+#define MNT_HASH_PRIME 16777619U
+
+static atomic_ptr_t mnt_index[MNT_INDEX_SIZE];
+static atomic_t mnt_index_seq;
+static atomic_t mnt_index_max_len;
+static atomic_t mnt_index_overflow;
+
+static inline uint32_t mnt_hash_step(uint32_t hash, char c)
+{
+	return (hash ^ (uint8_t)c) * MNT_HASH_PRIME;
+}
+
+static uint32_t mnt_hash(const char *name, size_t len)
+{
+	uint32_t hash = MNT_HASH_BASIS;
+
+	for (size_t i = 0; i < len; i++) {
+		hash = mnt_hash_step(hash, name[i]);
+	}
+
+	return hash;
+}
+
+/* Must be called with the lock held */
+static void mnt_index_rebuild(void)
+{
+	struct fs_mount_t *itr;
+	sys_dnode_t *node;
+	size_t count = 0;
+	size_t max_len = 0;
+	bool overflow = false;
+	uint32_t i;
+
+	atomic_inc(&mnt_index_seq);
+
+	for (i = 0; i < MNT_INDEX_SIZE; i++) {
+		atomic_ptr_clear(&mnt_index[i]);
+	}
+
+	SYS_DLIST_FOR_EACH_NODE(&fs_mnt_list, node) {
+		itr = CONTAINER_OF(node, struct fs_mount_t, node);
+
+		if (count == MNT_INDEX_SIZE) {
+			overflow = true;
+			break;
+		}
+
+		i = mnt_hash(itr->mnt_point, itr->mountp_len) % MNT_INDEX_SIZE;
+		while (atomic_ptr_get(&mnt_index[i]) != NULL) {
+			i = (i + 1) % MNT_INDEX_SIZE;
+		}
+		atomic_ptr_set(&mnt_index[i], itr);
+
+		max_len = MAX(max_len, itr->mountp_len);
+		count++;
+	}
+
+	atomic_set(&mnt_index_max_len, max_len);
+	atomic_set(&mnt_index_overflow, overflow);
+
+	atomic_inc(&mnt_index_seq);
+}
+
+/* Returns -EAGAIN if the path cannot be looked up in the index */
+static int mnt_index_find(struct fs_mount_t **mnt_pntp, const char *name,
+			  size_t name_len)
+{
+	size_t max_len = MIN(name_len, (size_t)atomic_get(&mnt_index_max_len));
+	size_t lens[MNT_INDEX_PREFIXES];
+	uint32_t hashes[MNT_INDEX_PREFIXES];
+	uint32_t hash = MNT_HASH_BASIS;
+	struct fs_mount_t *itr;
+	int n = 0;
+
+	if (atomic_get(&mnt_index_overflow)) {
+		return -EAGAIN;
+	}
+
+	/* Hash the prefixes a mount point can match in a single pass */
+	for (size_t i = 0; i <= max_len; i++) {
+		if ((i > 1) && ((name[i] == '/') || (name[i] == '\0'))) {
+			if (n == MNT_INDEX_PREFIXES) {
+				return -EAGAIN;
+			}
+			lens[n] = i;
+			hashes[n] = hash;
+			n++;
+		}
+		hash = mnt_hash_step(hash, name[i]);
+	}
+
+	while (n-- > 0) {
+		uint32_t slot = hashes[n] % MNT_INDEX_SIZE;
+
+		for (int probes = 0; probes < MNT_INDEX_SIZE; probes++) {
+			itr = atomic_ptr_get(&mnt_index[slot]);
+			if (itr == NULL) {
+				break;
+			}
+
+			if ((itr->mountp_len == lens[n]) &&
+			    (strncmp(name, itr->mnt_point, lens[n]) == 0)) {
+				*mnt_pntp = itr;
+				return 0;
+			}
+
+			slot = (slot + 1) % MNT_INDEX_SIZE;
+		}
+	}
+
+	return -ENOENT;
+}
+
+static int mnt_index_lookup(struct fs_mount_t **mnt_pntp, const char *name,
+			    size_t name_len)
+{
+	atomic_val_t seq = atomic_get(&mnt_index_seq);
+	int rc;
+
+	if ((seq & 1) == 0) {
+		rc = mnt_index_find(mnt_pntp, name, name_len);
+		if (atomic_get(&mnt_index_seq) == seq) {
+			return rc;
+		}
+	}
+
+	/* The index is being rebuilt, wait for it on the lock */
+	k_mutex_lock(&mutex, K_FOREVER);
+	rc = mnt_index_find(mnt_pntp, name, name_len);
 	k_mutex_unlock(&mutex);
 
+	return rc;
+}
+#else
+static inline void mnt_index_rebuild(void)
+{
+}
+#endif /* CONFIG_FILE_SYSTEM_MOUNT_INDEX */
+
+static int fs_get_mnt_point(struct fs_mount_t **mnt_pntp,
+			    const char *name, size_t *match_len)
+{
+	struct fs_mount_t *mnt_p = NULL;
+	size_t name_len = strlen(name);
+
+#ifdef CONFIG_FILE_SYSTEM_MOUNT_INDEX
+	int rc = mnt_index_lookup(&mnt_p, name, name_len);
+
+	if (rc == -ENOENT) {
+		return rc;
+	}
+#endif
+
+	if (mnt_p == NULL) {
+		k_mutex_lock(&mutex, K_FOREVER);
+		mnt_p = mnt_list_find(name, name_len);
+		k_mutex_unlock(&mutex);
+	}
+
 	if (mnt_p == NULL) {
 		return -ENOENT;
 	}
@@ -714,6 +888,7 @@ int fs_mount(struct fs_mount_t *mp)
 	mp->fs = fs;
 
 	sys_dlist_append(&fs_mnt_list, &mp->node);
+	mnt_index_rebuild();
 	LOG_DBG("fs mounted at %s", mp->mnt_point);
 
 mount_err:
@@ -754,6 +929,7 @@ int fs_unmount(struct fs_mount_t *mp)
 
 	/* remove mount node from the list */
 	sys_dlist_remove(&mp->node);
+	mnt_index_rebuild();
 	LOG_DBG("fs unmounted from %s", mp->mnt_point);
 
 unmount_err:
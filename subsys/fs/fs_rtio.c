@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <errno.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/fs/fs_rtio.h>
+
+#define LOG_LEVEL CONFIG_FS_LOG_LEVEL
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(fs);
+
+static K_THREAD_STACK_DEFINE(fs_rtio_stack, CONFIG_FILE_SYSTEM_RTIO_STACK_SIZE);
+static struct k_work_q fs_rtio_queue;
+
+/* RTIO executors are not thread safe, the submissions and completions of
+ * requests to file I/O devices go through this lock.
+ */
+static K_MUTEX_DEFINE(fs_rtio_exec_lock);
+
+static int batch_flush(struct fs_rtio_file *f)
+{
+	ssize_t len = f->batch_len;
+	ssize_t rc;
+
+	if (len == 0) {
+		return 0;
+	}
+
+	/* The batch is dropped on error, so that it is reported once */
+	f->batch_len = 0;
+
+	rc = fs_write(&f->file, f->batch, len);
+	if (rc < 0) {
+		return rc;
+	}
+
+	return (rc == len) ? 0 : -ENOSPC;
+}
+
+static ssize_t batch_write(struct fs_rtio_file *f, const uint8_t *buf,
+			   size_t len)
+{
+	size_t done = 0;
+	size_t n;
+	int rc;
+
+	if ((f->batch_len == 0) && (len >= f->batch_size)) {
+		return fs_write(&f->file, buf, len);
+	}
+
+	while (done < len) {
+		n = MIN(len - done, f->batch_size - f->batch_len);
+		memcpy(&f->batch[f->batch_len], &buf[done], n);
+		f->batch_len += n;
+		done += n;
+
+		if (f->batch_len == f->batch_size) {
+			rc = batch_flush(f);
+			if (rc < 0) {
+				return rc;
+			}
+		}
+	}
+
+	return len;
+}
+
+static int fs_rtio_do(struct fs_rtio_file *f, const struct rtio_sqe *sqe)
+{
+	int rc;
+
+	switch (sqe->op) {
+	case RTIO_OP_NOP:
+		return 0;
+	case RTIO_OP_RX:
+		rc = batch_flush(f);
+		if (rc < 0) {
+			return rc;
+		}
+		return fs_read(&f->file, sqe->buf, sqe->buf_len);
+	case RTIO_OP_TX:
+		return batch_write(f, sqe->buf, sqe->buf_len);
+	case FS_RTIO_OP_SYNC:
+		rc = batch_flush(f);
+		if (rc < 0) {
+			return rc;
+		}
+		return fs_sync(&f->file);
+	default:
+		return -ENOTSUP;
+	}
+}
+
+static void fs_rtio_work_handler(struct k_work *work)
+{
+	struct fs_rtio_file *f = CONTAINER_OF(work, struct fs_rtio_file, work);
+	struct rtio_iodev_sq *iodev_sq = f->iodev->iodev_sq;
+	struct rtio_iodev_sqe *entry;
+	const struct rtio_sqe *sqe;
+	struct rtio *r;
+	int rc;
+
+	while ((entry = rtio_spsc_consume(iodev_sq)) != NULL) {
+		sqe = entry->sqe;
+		r = entry->r;
+		rtio_spsc_release(iodev_sq);
+
+		rc = fs_rtio_do(f, sqe);
+
+		k_mutex_lock(&fs_rtio_exec_lock, K_FOREVER);
+		if (rc < 0) {
+			LOG_DBG("file request %u error (%d)", sqe->op, rc);
+			rtio_sqe_err(r, sqe, rc);
+		} else {
+			rtio_sqe_ok(r, sqe, rc);
+		}
+		k_mutex_unlock(&fs_rtio_exec_lock);
+	}
+}
+
+/* Called by the executor, with fs_rtio_exec_lock held */
+static void fs_rtio_iodev_submit(const struct rtio_sqe *sqe, struct rtio *r)
+{
+	const struct rtio_iodev *iodev = sqe->iodev;
+	struct fs_rtio_file *f = iodev->data;
+	struct rtio_iodev_sqe *entry = NULL;
+	k_spinlock_key_t key;
+
+	if (f->iodev == NULL) {
+		rtio_sqe_err(r, sqe, -EBADF);
+		return;
+	}
+
+	key = k_spin_lock(&f->lock);
+	entry = rtio_spsc_acquire(iodev->iodev_sq);
+	if (entry != NULL) {
+		entry->sqe = sqe;
+		entry->r = r;
+		rtio_spsc_produce(iodev->iodev_sq);
+	}
+	k_spin_unlock(&f->lock, key);
+
+	if (entry == NULL) {
+		LOG_ERR("file request queue full");
+		rtio_sqe_err(r, sqe, -ENOMEM);
+		return;
+	}
+
+	k_work_submit_to_queue(&fs_rtio_queue, &f->work);
+}
+
+const struct rtio_iodev_api fs_rtio_api = {
+	.submit = fs_rtio_iodev_submit,
+};
+
+int fs_rtio_submit(struct rtio *r, uint32_t wait_count)
+{
+	int rc;
+
+	k_mutex_lock(&fs_rtio_exec_lock, K_FOREVER);
+#ifdef CONFIG_RTIO_SUBMIT_SEM
+	if (wait_count > 0) {
+		k_sem_reset(r->submit_sem);
+		r->submit_count = wait_count;
+	}
+#endif
+	rc = rtio_submit(r, 0);
+	k_mutex_unlock(&fs_rtio_exec_lock);
+
+	if ((rc != 0) || (wait_count == 0)) {
+		return rc;
+	}
+
+#ifdef CONFIG_RTIO_SUBMIT_SEM
+	rc = k_sem_take(r->submit_sem, K_FOREVER);
+#else
+	while (rtio_spsc_consumable(r->cq) < wait_count) {
+#ifdef CONFIG_BOARD_NATIVE_POSIX
+		k_busy_wait(1);
+#else
+		k_yield();
+#endif /* CONFIG_BOARD_NATIVE_POSIX */
+	}
+#endif
+
+	return rc;
+}
+
+int fs_rtio_open(const struct rtio_iodev *iodev, const char *path,
+		 fs_mode_t flags)
+{
+	struct fs_rtio_file *f = iodev->data;
+	int rc;
+
+	if (f->iodev != NULL) {
+		return -EBUSY;
+	}
+
+	fs_file_t_init(&f->file);
+	rc = fs_open(&f->file, path, flags);
+	if (rc < 0) {
+		return rc;
+	}
+
+	f->batch_len = 0;
+	k_work_init(&f->work, fs_rtio_work_handler);
+	f->iodev = iodev;
+
+	return 0;
+}
+
+int fs_rtio_close(const struct rtio_iodev *iodev)
+{
+	struct fs_rtio_file *f = iodev->data;
+	int rc, rc_close;
+
+	if (f->iodev == NULL) {
+		return -EBADF;
+	}
+
+	rc = batch_flush(f);
+	rc_close = fs_close(&f->file);
+	f->iodev = NULL;
+
+	return (rc < 0) ? rc : rc_close;
+}
+
+static int fs_rtio_init(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	k_work_queue_start(&fs_rtio_queue, fs_rtio_stack,
+			   K_THREAD_STACK_SIZEOF(fs_rtio_stack),
+			   CONFIG_FILE_SYSTEM_RTIO_PRIORITY, NULL);
+	k_thread_name_set(&fs_rtio_queue.thread, "fs_rtio");
+
+	return 0;
+}
+
+SYS_INIT(fs_rtio_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
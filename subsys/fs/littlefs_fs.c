@@ -614,7 +614,8 @@ static lfs_size_t get_block_size(const struct flash_area *fa)
 	};
 	const struct device *dev = flash_area_get_device(fa);
 
-	flash_page_foreach(dev, get_page_cb, &ctx);
+	flash_page_foreach_range(dev, fa->fa_off, fa->fa_size, get_page_cb,
+				 &ctx);
 
 	return ctx.max_size;
 }
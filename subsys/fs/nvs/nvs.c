@@ -1184,6 +1184,67 @@ ssize_t nvs_read(struct nvs_fs *fs, uint16_t id, void *data, size_t len)
 	return rc;
 }
 
+int nvs_walk(struct nvs_fs *fs, nvs_walk_cb_t cb, void *param)
+{
+	int rc;
+	uint32_t wlk_addr, rd_addr;
+	struct nvs_ate wlk_ate;
+	struct nvs_entry entry;
+
+	if (!fs->ready) {
+		LOG_ERR("NVS not initialized");
+		return -EACCES;
+	}
+
+	wlk_addr = fs->ate_wra;
+
+	do {
+		rd_addr = wlk_addr;
+		rc = nvs_prev_ate(fs, &wlk_addr, &wlk_ate);
+		if (rc) {
+			return rc;
+		}
+
+		/* 0xFFFF is the id of the gc_done ate, not an entry */
+		if (!nvs_ate_valid(fs, &wlk_ate) || (wlk_ate.id == 0xFFFF)) {
+			continue;
+		}
+
+		entry.id = wlk_ate.id;
+		entry.len = wlk_ate.len;
+		entry.data_addr = (rd_addr & ADDR_SECT_MASK) + wlk_ate.offset;
+
+		rc = cb(fs, &entry, param);
+		if (rc) {
+			return rc;
+		}
+	} while (wlk_addr != fs->ate_wra);
+
+	return 0;
+}
+
+ssize_t nvs_entry_read(struct nvs_fs *fs, const struct nvs_entry *entry,
+		       void *data, size_t len)
+{
+	int rc;
+
+	if (!fs->ready) {
+		LOG_ERR("NVS not initialized");
+		return -EACCES;
+	}
+
+	if (entry->len == 0U) {
+		return -ENOENT;
+	}
+
+	rc = nvs_flash_rd(fs, entry->data_addr, data, MIN(len, entry->len));
+	if (rc) {
+		return rc;
+	}
+
+	return entry->len;
+}
+
 ssize_t nvs_calc_free_space(struct nvs_fs *fs)
 {
 
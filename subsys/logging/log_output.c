@@ -13,6 +13,7 @@
 #include <time.h>
 #include <stdio.h>
 #include <stdbool.h>
+#include <string.h>
 
 #define LOG_COLOR_CODE_DEFAULT "\x1B[0m"
 #define LOG_COLOR_CODE_RED     "\x1B[1;31m"
@@ -97,6 +98,18 @@ static int level_to_rfc5424_severity(uint32_t level)
 	return ret;
 }
 
+static void buffer_write(log_output_func_t outf, uint8_t *buf, size_t len,
+			 void *ctx)
+{
+	int processed;
+
+	do {
+		processed = outf(buf, len, ctx);
+		len -= processed;
+		buf += processed;
+	} while (len != 0);
+}
+
 static int out_func(int c, void *ctx)
 {
 	const struct log_output *out_ctx = (const struct log_output *)ctx;
@@ -133,6 +146,54 @@ static int cr_out_func(int c, void *ctx)
 	return 0;
 }
 
+static int out_span(const char *buf, size_t len, void *ctx)
+{
+	const struct log_output *out_ctx = (const struct log_output *)ctx;
+	size_t chunk;
+	int idx;
+
+	if (len == 0) {
+		return 0;
+	}
+
+	if (IS_ENABLED(CONFIG_LOG_MODE_IMMEDIATE)) {
+		/* Backend must be thread safe in synchronous operation. */
+		buffer_write(out_ctx->func, (uint8_t *)buf, len,
+			     out_ctx->control_block->ctx);
+		return 0;
+	}
+
+	while (len != 0) {
+		if (out_ctx->control_block->offset == out_ctx->size) {
+			log_output_flush(out_ctx);
+		}
+
+		chunk = MIN(len, out_ctx->size - out_ctx->control_block->offset);
+		idx = atomic_add(&out_ctx->control_block->offset, chunk);
+		memcpy(&out_ctx->buf[idx], buf, chunk);
+		buf += chunk;
+		len -= chunk;
+	}
+
+	__ASSERT_NO_MSG(out_ctx->control_block->offset <= out_ctx->size);
+
+	return 0;
+}
+
+static int cr_out_span(const char *buf, size_t len, void *ctx)
+{
+	const char *nl;
+
+	while ((nl = memchr(buf, '\n', len)) != NULL) {
+		out_span(buf, nl - buf, ctx);
+		out_span("\r\n", 2, ctx);
+		len -= nl - buf + 1;
+		buf = nl + 1;
+	}
+
+	return out_span(buf, len, ctx);
+}
+
 static int print_formatted(const struct log_output *output,
 			   const char *fmt, ...)
 {
@@ -140,22 +201,46 @@ static int print_formatted(const struct log_output *output,
 	int length = 0;
 
 	va_start(args, fmt);
-	length = cbvprintf(out_func, (void *)output, fmt, args);
+	length = cbvprintf_span(out_func, out_span, (void *)output, fmt, args);
 	va_end(args);
 
 	return length;
 }
 
-static void buffer_write(log_output_func_t outf, uint8_t *buf, size_t len,
-			 void *ctx)
+/* Formatters of packages emitting runs of characters at once */
+static cbprintf_span_cb span_of(cbprintf_cb out)
 {
-	int processed;
+	return (out == cr_out_func) ? cr_out_span : out_span;
+}
 
-	do {
-		processed = outf(buf, len, ctx);
-		len -= processed;
-		buf += processed;
-	} while (len != 0);
+static int span_formatter(cbprintf_cb out, void *ctx, const char *fmt,
+			  va_list ap)
+{
+	return cbvprintf_span(out, span_of(out), ctx, fmt, ap);
+}
+
+#if defined(CONFIG_CBPRINTF_PACKAGE_SUPPORT_TAGGED_ARGUMENTS)
+static int span_tagged_formatter(cbprintf_cb out, void *ctx, const char *fmt,
+				 va_list ap)
+{
+	return cbvprintf_span_tagged_args(out, span_of(out), ctx, fmt, ap);
+}
+#endif
+
+static int package_print(const struct log_output *output, cbprintf_cb cb,
+			 void *package)
+{
+#if defined(CONFIG_CBPRINTF_PACKAGE_SUPPORT_TAGGED_ARGUMENTS)
+	union cbprintf_package_hdr *hdr = package;
+
+	if ((hdr->desc.pkg_flags & CBPRINTF_PACKAGE_ARGS_ARE_TAGGED)
+	    == CBPRINTF_PACKAGE_ARGS_ARE_TAGGED) {
+		return cbpprintf_external(cb, span_tagged_formatter,
+					  (void *)output, package);
+	}
+#endif
+
+	return cbpprintf_external(cb, span_formatter, (void *)output, package);
 }
 
 
@@ -506,7 +591,7 @@ void log_output_process(const struct log_output *output,
 	}
 
 	if (package) {
-		int err = cbpprintf(cb, (void *)output, (void *)package);
+		int err = package_print(output, cb, (void *)package);
 
 		(void)err;
 		__ASSERT_NO_MSG(err >= 0);
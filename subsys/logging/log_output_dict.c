@@ -10,7 +10,9 @@
 #include <zephyr/logging/log_output.h>
 #include <zephyr/logging/log_output_dict.h>
 #include <zephyr/sys/__assert.h>
+#include <zephyr/sys/byteorder.h>
 #include <zephyr/sys/util.h>
+#include <string.h>
 
 static void buffer_write(log_output_func_t outf, uint8_t *buf, size_t len,
 			 void *ctx)
@@ -24,11 +26,373 @@ static void buffer_write(log_output_func_t outf, uint8_t *buf, size_t len,
 	} while (len != 0);
 }
 
-void log_dict_output_msg_process(const struct log_output *output,
-				 struct log_msg *msg, uint32_t flags)
+#ifdef CONFIG_LOG_DICTIONARY_COMPACT
+
+/* Values encoded are at most as wide as timestamps. */
+#define VARINT_MAX_LEN ceiling_fraction(sizeof(log_timestamp_t) * 8, 7)
+#define WORD_VARINT_MAX_LEN ceiling_fraction(sizeof(uint32_t) * 8, 7)
+
+/* Type, descriptor, timestamp, source and lengths */
+#define COMPACT_HDR_MAX_LEN (2 + 4 * VARINT_MAX_LEN)
+#define COMPACT_BUF_LEN 64
+
+BUILD_ASSERT(COMPACT_HDR_MAX_LEN + WORD_VARINT_MAX_LEN <= COMPACT_BUF_LEN);
+
+static size_t varint_put(uint8_t *buf, log_timestamp_t val)
+{
+	size_t len = 0;
+
+	while (val >= 0x80U) {
+		buf[len++] = (uint8_t)val | 0x80U;
+		val >>= 7;
+	}
+	buf[len++] = (uint8_t)val;
+
+	return len;
+}
+
+/* Number of words of the package holding its header and arguments, which
+ * are sent as variable length integers.
+ */
+static size_t package_words(const uint8_t *package, size_t len)
+{
+	if (len < sizeof(uint32_t)) {
+		return 0;
+	}
+
+	/* The package header starts with its length in words */
+	return CLAMP(package[0], 1U, len / sizeof(uint32_t));
+}
+
+static size_t words_put(uint8_t *buf, const uint8_t *words, size_t n)
+{
+	size_t len = 0;
+	uint32_t word;
+
+	for (size_t i = 0; i < n; i++) {
+		memcpy(&word, &words[i * sizeof(uint32_t)], sizeof(word));
+		len += varint_put(&buf[len], word);
+	}
+
+	return len;
+}
+
+static size_t compact_hdr_put(struct log_output_dict_state *state,
+			      uint8_t *buf, struct log_msg *msg,
+			      uint32_t source, size_t package_len,
+			      size_t data_len)
+{
+	uint8_t desc = msg->hdr.desc.domain | (msg->hdr.desc.level << 3);
+	log_timestamp_t delta = msg->hdr.timestamp - state->timestamp;
+	bool same_source = state->source_valid && (state->source == source);
+	size_t len = 2;
+
+	if (same_source) {
+		desc |= LOG_DICT_COMPACT_SAME_SOURCE;
+	}
+	if (data_len > 0U) {
+		desc |= LOG_DICT_COMPACT_HAS_DATA;
+	}
+
+	buf[0] = MSG_NORMAL_COMPACT;
+	buf[1] = desc;
+	len += varint_put(&buf[len], delta);
+	if (!same_source) {
+		len += varint_put(&buf[len], source);
+	}
+	len += varint_put(&buf[len], package_len);
+	if (data_len > 0U) {
+		len += varint_put(&buf[len], data_len);
+	}
+
+	state->timestamp = msg->hdr.timestamp;
+	state->source = source;
+	state->source_valid = true;
+
+	return len;
+}
+
+/* Writes the message with the header in buf, which is used as scratch. */
+static void compact_write(const struct log_output *output, uint8_t *buf,
+			  size_t len, const uint8_t *package, size_t package_len,
+			  size_t words, const uint8_t *data, size_t data_len)
+{
+	size_t words_len = words * sizeof(uint32_t);
+
+	for (size_t i = 0; i < words; i++) {
+		if (len + WORD_VARINT_MAX_LEN > COMPACT_BUF_LEN) {
+			buffer_write(output->func, buf, len, (void *)output);
+			len = 0;
+		}
+		len += words_put(&buf[len], &package[i * sizeof(uint32_t)], 1);
+	}
+
+	buffer_write(output->func, buf, len, (void *)output);
+
+	if (package_len > words_len) {
+		buffer_write(output->func, (uint8_t *)&package[words_len],
+			     package_len - words_len, (void *)output);
+	}
+
+	if (data_len > 0U) {
+		buffer_write(output->func, (uint8_t *)data, data_len,
+			     (void *)output);
+	}
+}
+
+#ifdef CONFIG_LOG_DICTIONARY_COMPACT_COMPRESS
+
+#define WINDOW CONFIG_LOG_DICTIONARY_COMPACT_WINDOW
+#define MIN_MATCH LOG_DICT_COMPRESS_MIN_MATCH
+#define HASH_BITS 8
+#define SEQ_MAX 16
+
+/* Token and the bytes added to its lengths */
+#define SEQ_HDR_MAX_LEN (3 + WINDOW / 255 + 1)
+
+BUILD_ASSERT(BIT(HASH_BITS) ==
+	     ARRAY_SIZE(((struct log_output_dict_state *)0)->hash));
+
+/* Literals followed by a match found back in the stream */
+struct compress_seq {
+	uint16_t lit_len;
+	uint16_t dist;
+	uint16_t match_len;
+};
+
+static inline uint32_t hash_get(const uint8_t *p)
+{
+	return (sys_get_le32(p) * 2654435761U) >> (32 - HASH_BITS);
+}
+
+static inline void hash_insert(struct log_output_dict_state *state,
+			       size_t pos)
+{
+	state->hash[hash_get(&state->hist[pos])] = pos;
+}
+
+/* Makes room for len bytes at the end of the history, keeping the window
+ * preceding them.
+ */
+static void hist_make_room(struct log_output_dict_state *state, size_t len)
+{
+	size_t keep;
+
+	if (state->hist_len + len <= sizeof(state->hist)) {
+		return;
+	}
+
+	keep = MIN(state->hist_len, WINDOW);
+	memmove(state->hist, &state->hist[state->hist_len - keep], keep);
+	state->hist_len = keep;
+
+	memset(state->hash, 0, sizeof(state->hash));
+	for (size_t pos = 0; pos + MIN_MATCH <= keep; pos++) {
+		hash_insert(state, pos);
+	}
+}
+
+/* Finds the matches of the history from start to end, returns the number
+ * of sequences, the literals ending the message start at lit.
+ */
+static size_t compress_find(struct log_output_dict_state *state, size_t start,
+			    size_t end, struct compress_seq *seqs, size_t *lit)
+{
+	const uint8_t *hist = state->hist;
+	size_t pos = start;
+	size_t n = 0;
+
+	*lit = start;
+	while ((pos + MIN_MATCH <= end) && (n < SEQ_MAX)) {
+		uint32_t h = hash_get(&hist[pos]);
+		size_t cand = state->hash[h];
+		size_t len;
+
+		/* Entries are not cleared, the bytes tell a match */
+		state->hash[h] = pos;
+		if ((cand >= pos) ||
+		    (memcmp(&hist[cand], &hist[pos], MIN_MATCH) != 0)) {
+			pos++;
+			continue;
+		}
+
+		len = MIN_MATCH;
+		while ((pos + len < end) && (hist[cand + len] == hist[pos + len])) {
+			len++;
+		}
+
+		seqs[n].lit_len = pos - *lit;
+		seqs[n].dist = pos - cand;
+		seqs[n].match_len = len;
+		n++;
+
+		for (size_t i = pos + 1; (i < pos + len) && (i + MIN_MATCH <= end); i++) {
+			hash_insert(state, i);
+		}
+		pos += len;
+		*lit = pos;
+	}
+
+	/* Later messages may match the rest */
+	for (; pos + MIN_MATCH <= end; pos++) {
+		hash_insert(state, pos);
+	}
+
+	return n;
+}
+
+static inline size_t len_ext_size(size_t len)
+{
+	return (len < 15U) ? 0 : (len - 15U) / 255U + 1U;
+}
+
+static size_t len_ext_put(uint8_t *buf, size_t len)
+{
+	size_t n = 0;
+
+	for (len -= 15U; len >= 255U; len -= 255U) {
+		buf[n++] = 255U;
+	}
+	buf[n++] = len;
+
+	return n;
+}
+
+static void seq_write(const struct log_output *output, const uint8_t *lit,
+		      size_t lit_len, size_t dist, size_t match_len)
+{
+	uint8_t buf[SEQ_HDR_MAX_LEN];
+	size_t len = 1;
+
+	buf[0] = (MIN(lit_len, 15U) << 4) |
+		 ((match_len > 0U) ? MIN(match_len - MIN_MATCH, 15U) : 0U);
+	if (lit_len >= 15U) {
+		len += len_ext_put(&buf[len], lit_len);
+	}
+	buffer_write(output->func, buf, len, (void *)output);
+
+	if (lit_len > 0U) {
+		buffer_write(output->func, (uint8_t *)lit, lit_len,
+			     (void *)output);
+	}
+
+	if (match_len == 0U) {
+		return;
+	}
+
+	sys_put_le16(dist, buf);
+	len = 2;
+	if (match_len - MIN_MATCH >= 15U) {
+		len += len_ext_put(&buf[len], match_len - MIN_MATCH);
+	}
+	buffer_write(output->func, buf, len, (void *)output);
+}
+
+/* Adds the message to the history and writes it compressed when smaller,
+ * returns false when it does not fit the window.
+ */
+static bool compress_write(const struct log_output *output, const uint8_t *hdr,
+			   size_t hdr_len, const uint8_t *package,
+			   size_t package_len, size_t words,
+			   const uint8_t *data, size_t data_len)
+{
+	struct log_output_dict_state *state = &output->control_block->dict;
+	size_t words_len = words * sizeof(uint32_t);
+	size_t max_len = hdr_len + words * WORD_VARINT_MAX_LEN +
+			 (package_len - words_len) + data_len;
+	struct compress_seq seqs[SEQ_MAX];
+	uint8_t buf[1 + VARINT_MAX_LEN];
+	uint8_t *hist;
+	size_t start, end, lit, n;
+	size_t buf_len, size;
+
+	if (max_len > WINDOW) {
+		/* Not referenced by the next messages */
+		state->hist_len = 0;
+		return false;
+	}
+
+	hist_make_room(state, max_len);
+	start = state->hist_len;
+	hist = state->hist;
+
+	end = start;
+	memcpy(&hist[end], hdr, hdr_len);
+	end += hdr_len;
+	end += words_put(&hist[end], package, words);
+	if (package_len > words_len) {
+		memcpy(&hist[end], &package[words_len], package_len - words_len);
+		end += package_len - words_len;
+	}
+	if (data_len > 0U) {
+		memcpy(&hist[end], data, data_len);
+		end += data_len;
+	}
+	state->hist_len = end;
+
+	n = compress_find(state, start, end, seqs, &lit);
+
+	buf[0] = MSG_COMPRESSED;
+	buf_len = 1 + varint_put(&buf[1], end - start);
+	size = buf_len;
+	for (size_t i = 0; i < n; i++) {
+		size += 3 + len_ext_size(seqs[i].lit_len) + seqs[i].lit_len +
+			len_ext_size(seqs[i].match_len - MIN_MATCH);
+	}
+	if (lit < end) {
+		size += 1 + len_ext_size(end - lit) + (end - lit);
+	}
+
+	if (size >= end - start) {
+		buffer_write(output->func, &hist[start], end - start,
+			     (void *)output);
+		return true;
+	}
+
+	buffer_write(output->func, buf, buf_len, (void *)output);
+	for (size_t i = 0; i < n; i++) {
+		seq_write(output, &hist[start], seqs[i].lit_len, seqs[i].dist,
+			  seqs[i].match_len);
+		start += seqs[i].lit_len + seqs[i].match_len;
+	}
+	if (lit < end) {
+		seq_write(output, &hist[lit], end - lit, 0, 0);
+	}
+
+	return true;
+}
+
+#endif /* CONFIG_LOG_DICTIONARY_COMPACT_COMPRESS */
+
+static void msg_write(const struct log_output *output, struct log_msg *msg,
+		      uint32_t source)
+{
+	struct log_output_dict_state *state = &output->control_block->dict;
+	uint8_t buf[COMPACT_BUF_LEN];
+	size_t package_len, data_len, words, len;
+	uint8_t *package = log_msg_get_package(msg, &package_len);
+	uint8_t *data = log_msg_get_data(msg, &data_len);
+
+	words = package_words(package, package_len);
+	len = compact_hdr_put(state, buf, msg, source, package_len, data_len);
+
+#ifdef CONFIG_LOG_DICTIONARY_COMPACT_COMPRESS
+	if (compress_write(output, buf, len, package, package_len, words,
+			   data, data_len)) {
+		return;
+	}
+#endif
+
+	compact_write(output, buf, len, package, package_len, words,
+		      data, data_len);
+}
+
+#else
+
+static void msg_write(const struct log_output *output, struct log_msg *msg,
+		      uint32_t source)
 {
 	struct log_dict_output_normal_msg_hdr_t output_hdr;
-	void *source = (void *)log_msg_get_source(msg);
 
 	/* Keep sync with header in struct log_msg */
 	output_hdr.type = MSG_NORMAL;
@@ -37,12 +401,7 @@ void log_dict_output_msg_process(const struct log_output *output,
 	output_hdr.package_len = msg->hdr.desc.package_len;
 	output_hdr.data_len = msg->hdr.desc.data_len;
 	output_hdr.timestamp = msg->hdr.timestamp;
-
-	output_hdr.source = (source != NULL) ?
-				(IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) ?
-					log_dynamic_source_id(source) :
-					log_const_source_id(source)) :
-				0U;
+	output_hdr.source = source;
 
 	buffer_write(output->func, (uint8_t *)&output_hdr, sizeof(output_hdr),
 		     (void *)output);
@@ -58,7 +417,21 @@ void log_dict_output_msg_process(const struct log_output *output,
 	if (len > 0U) {
 		buffer_write(output->func, data, len, (void *)output);
 	}
+}
+
+#endif /* CONFIG_LOG_DICTIONARY_COMPACT */
+
+void log_dict_output_msg_process(const struct log_output *output,
+				 struct log_msg *msg, uint32_t flags)
+{
+	void *source = (void *)log_msg_get_source(msg);
+	uint32_t source_id = (source != NULL) ?
+				(IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) ?
+					log_dynamic_source_id(source) :
+					log_const_source_id(source)) :
+				0U;
 
+	msg_write(output, msg, source_id);
 	log_output_flush(output);
 }
 
@@ -25,6 +25,117 @@ sys_slist_t settings_handlers;
 K_MUTEX_DEFINE(settings_lock);
 
 
+#if defined(CONFIG_SETTINGS_HANDLER_TRIE)
+/* Handlers are indexed in a trie of their name components, so that the
+ * lookup of a name compares each of its components with the children of
+ * a single node. Nodes point into handler names instead of copying them.
+ * New children are fully set up before being linked in first, so lookups
+ * done without the settings lock see either the old or the new trie.
+ */
+struct settings_trie_node {
+	const char *name;
+	size_t len;
+	struct settings_trie_node *child;
+	struct settings_trie_node *sibling;
+	struct settings_handler_static *handler;
+};
+
+static struct settings_trie_node trie_nodes[CONFIG_SETTINGS_HANDLER_TRIE_NODES];
+static struct settings_trie_node trie_root;
+static size_t trie_used;
+static bool trie_full;
+
+static struct settings_trie_node *trie_child(struct settings_trie_node *node,
+					     const char *name, size_t len)
+{
+	for (node = node->child; node != NULL; node = node->sibling) {
+		if ((node->len == len) && (strncmp(node->name, name, len) == 0)) {
+			return node;
+		}
+	}
+
+	return NULL;
+}
+
+static void trie_insert(struct settings_handler_static *handler)
+{
+	struct settings_trie_node *node = &trie_root;
+	struct settings_trie_node *child;
+	const char *name = handler->name;
+	const char *next;
+	size_t len;
+
+	if (trie_full) {
+		return;
+	}
+
+	do {
+		len = settings_name_next(name, &next);
+		child = trie_child(node, name, len);
+		if (child == NULL) {
+			if (trie_used == ARRAY_SIZE(trie_nodes)) {
+				LOG_WRN("handler trie full, looking up handlers "
+					"by comparing names");
+				trie_full = true;
+				return;
+			}
+
+			child = &trie_nodes[trie_used++];
+			child->name = name;
+			child->len = len;
+			child->child = NULL;
+			child->handler = NULL;
+			child->sibling = node->child;
+			node->child = child;
+		}
+		node = child;
+		name = next;
+	} while (name != NULL);
+
+	if (node->handler == NULL) {
+		node->handler = handler;
+	}
+}
+
+static struct settings_handler_static *trie_lookup(const char *name,
+						   const char **next)
+{
+	struct settings_handler_static *bestmatch = NULL;
+	struct settings_trie_node *node = &trie_root;
+	const char *tmpnext;
+	size_t len;
+
+	while (name != NULL) {
+		len = settings_name_next(name, &tmpnext);
+		node = trie_child(node, name, len);
+		if (node == NULL) {
+			break;
+		}
+
+		if (node->handler != NULL) {
+			bestmatch = node->handler;
+			if (next) {
+				*next = tmpnext;
+			}
+		}
+		name = tmpnext;
+	}
+
+	return bestmatch;
+}
+
+static void trie_init(void)
+{
+	trie_root.child = NULL;
+	trie_used = 0;
+	trie_full = false;
+
+	STRUCT_SECTION_FOREACH(settings_handler_static, ch) {
+		trie_insert(ch);
+	}
+}
+#endif /* CONFIG_SETTINGS_HANDLER_TRIE */
+
 void settings_store_init(void);
 
 void settings_init(void)
@@ -32,6 +143,9 @@ void settings_init(void)
 #if defined(CONFIG_SETTINGS_DYNAMIC_HANDLERS)
 	sys_slist_init(&settings_handlers);
 #endif /* CONFIG_SETTINGS_DYNAMIC_HANDLERS */
+#if defined(CONFIG_SETTINGS_HANDLER_TRIE)
+	trie_init();
+#endif /* CONFIG_SETTINGS_HANDLER_TRIE */
 	settings_store_init();
 }
 
@@ -56,6 +170,9 @@ int settings_register(struct settings_handler *handler)
 		}
 	}
 	sys_slist_append(&settings_handlers, &handler->node);
+#if defined(CONFIG_SETTINGS_HANDLER_TRIE)
+	trie_insert((struct settings_handler_static *)handler);
+#endif /* CONFIG_SETTINGS_HANDLER_TRIE */
 
 end:
 	k_mutex_unlock(&settings_lock);
@@ -145,6 +262,12 @@ struct settings_handler_static *settings_parse_and_lookup(const char *name,
 		*next = NULL;
 	}
 
+#if defined(CONFIG_SETTINGS_HANDLER_TRIE)
+	if (!trie_full) {
+		return trie_lookup(name, next);
+	}
+#endif /* CONFIG_SETTINGS_HANDLER_TRIE */
+
 	STRUCT_SECTION_FOREACH(settings_handler_static, ch) {
 		if (!settings_name_steq(name, ch->name, &tmpnext)) {
 			continue;
@@ -8,6 +8,7 @@
 #include <errno.h>
 #include <stdbool.h>
 #include <zephyr/fs/fcb.h>
+#include <zephyr/sys/crc.h>
 #include <string.h>
 
 #include <zephyr/settings/settings.h>
@@ -137,6 +138,103 @@ static bool settings_fcb_check_duplicate(struct settings_fcb *cf,
 	return false;
 }
 
+#ifdef CONFIG_FCB_INDEX
+/*
+ * The newest entry of each setting, found by walking the FCB from the newest
+ * entry before loading. Loading then passes an entry when it is the newest
+ * one of its setting, without looking for a duplicate further in the buffer.
+ * Used with settings_lock held.
+ */
+static struct settings_fcb_newest {
+	struct fcb_entry loc;
+	uint16_t name_hash;
+} newest[CONFIG_SETTINGS_FCB_LOAD_NEWEST_SIZE];
+static size_t newest_cnt;
+static bool newest_full;
+
+static bool settings_fcb_newest_has(struct settings_fcb *cf, const char *name,
+				    uint16_t name_hash)
+{
+	struct fcb_entry_ctx entry_ctx = {
+		.fap = cf->cf_fcb.fap
+	};
+	char name2[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+	size_t name2_len;
+
+	for (size_t i = 0; i < newest_cnt; i++) {
+		if (newest[i].name_hash != name_hash) {
+			continue;
+		}
+
+		entry_ctx.loc = newest[i].loc;
+		if (settings_line_name_read(name2, sizeof(name2), &name2_len,
+					    &entry_ctx)) {
+			continue;
+		}
+		name2[name2_len] = '\0';
+		if (!strcmp(name, name2)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void settings_fcb_newest_find(struct settings_fcb *cf)
+{
+	struct fcb_entry_ctx entry_ctx = {
+		{.fe_sector = NULL, .fe_elem_off = 0},
+		.fap = cf->cf_fcb.fap
+	};
+	char name[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+	size_t name_len;
+	uint16_t name_hash;
+
+	newest_cnt = 0;
+	newest_full = false;
+
+	while (fcb_getprev(&cf->cf_fcb, &entry_ctx.loc) == 0) {
+		if (settings_line_name_read(name, sizeof(name), &name_len,
+					    &entry_ctx)) {
+			continue;
+		}
+		name[name_len] = '\0';
+		name_hash = crc16_ccitt(0xffff, name, name_len);
+
+		if (settings_fcb_newest_has(cf, name, name_hash)) {
+			continue;
+		}
+
+		if (newest_cnt == ARRAY_SIZE(newest)) {
+			newest_full = true;
+			break;
+		}
+
+		newest[newest_cnt].loc = entry_ctx.loc;
+		newest[newest_cnt].name_hash = name_hash;
+		newest_cnt++;
+	}
+}
+
+static bool settings_fcb_is_newest(struct settings_fcb *cf,
+				   const struct fcb_entry_ctx *entry_ctx,
+				   const char * const name)
+{
+	uint16_t name_hash = crc16_ccitt(0xffff, name, strlen(name));
+
+	for (size_t i = 0; i < newest_cnt; i++) {
+		if ((newest[i].name_hash == name_hash) &&
+		    (newest[i].loc.fe_sector == entry_ctx->loc.fe_sector) &&
+		    (newest[i].loc.fe_elem_off == entry_ctx->loc.fe_elem_off)) {
+			return true;
+		}
+	}
+
+	/* Settings missing from a full table are looked for the long way */
+	return newest_full && !settings_fcb_check_duplicate(cf, entry_ctx, name);
+}
+#endif /* CONFIG_FCB_INDEX */
+
 static int read_entry_len(const struct fcb_entry_ctx *entry_ctx, off_t off)
 {
 	if (off >= entry_ctx->loc.fe_data_len) {
@@ -157,6 +255,12 @@ static int settings_fcb_load_priv(struct settings_store *cs,
 	};
 	int rc;
 
+#ifdef CONFIG_FCB_INDEX
+	if (filter_duplicates) {
+		settings_fcb_newest_find(cf);
+	}
+#endif
+
 	while ((rc = fcb_getnext(&cf->cf_fcb, &entry_ctx.loc)) == 0) {
 		char name[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
 		size_t name_len;
@@ -171,11 +275,19 @@ static int settings_fcb_load_priv(struct settings_store *cs,
 		}
 		name[name_len] = '\0';
 
+#ifdef CONFIG_FCB_INDEX
+		if (filter_duplicates &&
+		    (!read_entry_len(&entry_ctx, name_len+1) ||
+		     !settings_fcb_is_newest(cf, &entry_ctx, name))) {
+			pass_entry = false;
+		}
+#else
 		if (filter_duplicates &&
 		    (!read_entry_len(&entry_ctx, name_len+1) ||
 		     settings_fcb_check_duplicate(cf, &entry_ctx, name))) {
 			pass_entry = false;
 		}
+#endif
 		/*name, val-read_cb-ctx, val-off*/
 		/* take into account '=' separator after the name */
 		if (pass_entry) {
@@ -368,6 +480,38 @@ static int settings_fcb_save_priv(struct settings_store *cs, const char *name,
 	return rc;
 }
 
+/**
+ * @brief Check the newest value of a setting against the one saved
+ *
+ * Walks the FCB from the newest entry until one of the setting is found.
+ *
+ * @param cf   FCB handler
+ * @param cdca Duplicate check argument
+ */
+static void settings_fcb_dup_check(struct settings_fcb *cf,
+				   struct settings_line_dup_check_arg *cdca)
+{
+	struct fcb_entry_ctx entry_ctx = {
+		{.fe_sector = NULL, .fe_elem_off = 0},
+		.fap = cf->cf_fcb.fap
+	};
+	char name[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+	size_t name_len;
+
+	while (fcb_getprev(&cf->cf_fcb, &entry_ctx.loc) == 0) {
+		if (settings_line_name_read(name, sizeof(name), &name_len,
+					    &entry_ctx)) {
+			continue;
+		}
+		name[name_len] = '\0';
+		if (!strcmp(name, cdca->name)) {
+			settings_line_dup_check_cb(name, &entry_ctx,
+						   name_len + 1, cdca);
+			return;
+		}
+	}
+}
+
 static int settings_fcb_save(struct settings_store *cs, const char *name,
 			     const char *value, size_t val_len)
 {
@@ -384,7 +528,13 @@ static int settings_fcb_save(struct settings_store *cs, const char *name,
 	cdca.val = (char *)value;
 	cdca.is_dup = 0;
 	cdca.val_len = val_len;
-	settings_fcb_load_priv(cs, settings_line_dup_check_cb, &cdca, false);
+	if (IS_ENABLED(CONFIG_FCB_INDEX)) {
+		settings_fcb_dup_check(CONTAINER_OF(cs, struct settings_fcb,
+						    cf_store), &cdca);
+	} else {
+		settings_fcb_load_priv(cs, settings_line_dup_check_cb, &cdca,
+				       false);
+	}
 	if (cdca.is_dup == 1) {
 		return 0;
 	}
@@ -404,9 +554,18 @@ int settings_backend_init(void)
 {
 	static struct flash_sector
 		settings_fcb_area[CONFIG_SETTINGS_FCB_NUM_AREAS + 1];
+#ifdef CONFIG_FCB_INDEX
+	static struct fcb_index_entry
+		settings_fcb_index[(CONFIG_SETTINGS_FCB_NUM_AREAS + 1) *
+				   CONFIG_SETTINGS_FCB_INDEX_SIZE];
+#endif
 	static struct settings_fcb config_init_settings_fcb = {
 		.cf_fcb.f_magic = CONFIG_SETTINGS_FCB_MAGIC,
 		.cf_fcb.f_sectors = settings_fcb_area,
+#ifdef CONFIG_FCB_INDEX
+		.cf_fcb.f_index = settings_fcb_index,
+		.cf_fcb.f_index_size = CONFIG_SETTINGS_FCB_INDEX_SIZE,
+#endif
 	};
 	uint32_t cnt = sizeof(settings_fcb_area) /
 		    sizeof(settings_fcb_area[0]);
@@ -26,6 +26,9 @@ LOG_MODULE_DECLARE(settings, CONFIG_SETTINGS_LOG_LEVEL);
 struct settings_nvs_read_fn_arg {
 	struct nvs_fs *fs;
 	uint16_t id;
+#if CONFIG_SETTINGS_NVS_STREAMING_LOAD
+	struct nvs_entry entry;
+#endif
 };
 
 static int settings_nvs_load(struct settings_store *cs,
@@ -118,71 +121,231 @@ static uint16_t settings_nvs_cache_match(struct settings_nvs *cf, const char *na
 }
 #endif /* CONFIG_SETTINGS_NVS_NAME_CACHE */
 
-static int settings_nvs_load(struct settings_store *cs,
-			     const struct settings_load_arg *arg)
+/* Clean a settings item missing its name or value, to make space for future
+ * settings items.
+ */
+static void settings_nvs_clean(struct settings_nvs *cf, uint16_t name_id)
+{
+	if (name_id == cf->last_name_id) {
+		cf->last_name_id--;
+		nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID,
+			  &cf->last_name_id, sizeof(uint16_t));
+	}
+	nvs_delete(&cf->cf_nvs, name_id);
+	nvs_delete(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET);
+}
+
+static int settings_nvs_load_id(struct settings_nvs *cf, uint16_t name_id,
+				const struct settings_load_arg *arg)
 {
-	int ret = 0;
-	struct settings_nvs *cf = CONTAINER_OF(cs, struct settings_nvs, cf_store);
 	struct settings_nvs_read_fn_arg read_fn_arg;
 	char name[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
 	char buf;
 	ssize_t rc1, rc2;
-	uint16_t name_id = NVS_NAMECNT_ID;
 
-	name_id = cf->last_name_id + 1;
-
-	while (1) {
+	/* In the NVS backend, each setting item is stored in two NVS
+	 * entries one for the setting's name and one with the
+	 * setting's value.
+	 */
+	rc1 = nvs_read(&cf->cf_nvs, name_id, &name, sizeof(name));
+	rc2 = nvs_read(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET,
+		       &buf, sizeof(buf));
 
-		name_id--;
-		if (name_id == NVS_NAMECNT_ID) {
-			break;
-		}
+	if ((rc1 <= 0) && (rc2 <= 0)) {
+		return 0;
+	}
 
-		/* In the NVS backend, each setting item is stored in two NVS
-		 * entries one for the setting's name and one with the
-		 * setting's value.
+	if ((rc1 <= 0) || (rc2 <= 0)) {
+		/* Settings item is not stored correctly in the NVS.
+		 * NVS entry for its name or value is either missing
+		 * or deleted.
 		 */
-		rc1 = nvs_read(&cf->cf_nvs, name_id, &name, sizeof(name));
-		rc2 = nvs_read(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET,
-			       &buf, sizeof(buf));
+		settings_nvs_clean(cf, name_id);
+		return 0;
+	}
 
-		if ((rc1 <= 0) && (rc2 <= 0)) {
-			continue;
+	/* Found a name, this might not include a trailing \0 */
+	name[rc1] = '\0';
+	read_fn_arg.fs = &cf->cf_nvs;
+	read_fn_arg.id = name_id + NVS_NAME_ID_OFFSET;
+
+#if CONFIG_SETTINGS_NVS_NAME_CACHE
+	settings_nvs_cache_add(cf, name, name_id);
+#endif
+
+	return settings_call_set_handler(name, rc2, settings_nvs_read_fn,
+					 &read_fn_arg, (void *)arg);
+}
+
+#if CONFIG_SETTINGS_NVS_STREAMING_LOAD
+/* Settings are located in one walk over the NVS entries, newest first, so
+ * that the first entry found for an id is its current version. The name and
+ * value entries found are kept in the load table, indexed by name id. Once
+ * the walk is done, the settings are loaded from there in the order used
+ * when loading by id: set handlers may write to the NVS, which they must
+ * not do during the walk.
+ */
+#define LOAD_NAME_SEEN  BIT(0)
+#define LOAD_VALUE_SEEN BIT(1)
+
+struct settings_nvs_load_entry {
+	uint32_t name_addr;
+	uint32_t value_addr;
+	uint16_t name_len;
+	uint16_t value_len;
+	uint8_t flags;
+};
+
+static struct settings_nvs_load_entry
+	load_table[CONFIG_SETTINGS_NVS_STREAMING_LOAD_MAX];
+
+static ssize_t settings_nvs_entry_read_fn(void *back_end, void *data,
+					  size_t len)
+{
+	struct settings_nvs_read_fn_arg *rd_fn_arg;
+	ssize_t rc;
+
+	rd_fn_arg = (struct settings_nvs_read_fn_arg *)back_end;
+
+	rc = nvs_entry_read(rd_fn_arg->fs, &rd_fn_arg->entry, data, len);
+	if (rc > (ssize_t)len) {
+		rc = len;
+	}
+	return rc;
+}
+
+static int settings_nvs_load_cb(struct nvs_fs *fs,
+				const struct nvs_entry *entry, void *param)
+{
+	struct settings_nvs *cf = param;
+	struct settings_nvs_load_entry *le;
+	uint16_t name_id = entry->id;
+
+	ARG_UNUSED(fs);
+
+	if (name_id > NVS_NAMECNT_ID + NVS_NAME_ID_OFFSET) {
+		name_id -= NVS_NAME_ID_OFFSET;
+		if ((name_id <= NVS_NAMECNT_ID) || (name_id > cf->last_name_id)) {
+			return 0;
 		}
 
-		if ((rc1 <= 0) || (rc2 <= 0)) {
-			/* Settings item is not stored correctly in the NVS.
-			 * NVS entry for its name or value is either missing
-			 * or deleted. Clean dirty entries to make space for
-			 * future settings item.
-			 */
-			if (name_id == cf->last_name_id) {
-				cf->last_name_id--;
-				nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID,
-					  &cf->last_name_id, sizeof(uint16_t));
-			}
-			nvs_delete(&cf->cf_nvs, name_id);
-			nvs_delete(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET);
-			continue;
+		le = &load_table[name_id - NVS_NAMECNT_ID - 1];
+		if (!(le->flags & LOAD_VALUE_SEEN)) {
+			le->flags |= LOAD_VALUE_SEEN;
+			le->value_addr = entry->data_addr;
+			le->value_len = entry->len;
+		}
+	} else if ((name_id > NVS_NAMECNT_ID) && (name_id <= cf->last_name_id)) {
+		le = &load_table[name_id - NVS_NAMECNT_ID - 1];
+		if (!(le->flags & LOAD_NAME_SEEN)) {
+			le->flags |= LOAD_NAME_SEEN;
+			le->name_addr = entry->data_addr;
+			le->name_len = entry->len;
 		}
+	}
+
+	return 0;
+}
+
+/* Same as settings_nvs_load_id(), with the entries found by the walk */
+static int settings_nvs_load_entry(struct settings_nvs *cf, uint16_t name_id,
+				   const struct settings_load_arg *arg)
+{
+	struct settings_nvs_load_entry *le =
+		&load_table[name_id - NVS_NAMECNT_ID - 1];
+	struct settings_nvs_read_fn_arg read_fn_arg;
+	char name[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+	struct nvs_entry entry = {
+		.id = name_id,
+		.len = (le->flags & LOAD_NAME_SEEN) ? le->name_len : 0U,
+		.data_addr = le->name_addr,
+	};
+	uint16_t value_len = (le->flags & LOAD_VALUE_SEEN) ? le->value_len : 0U;
+	ssize_t rc;
 
-		/* Found a name, this might not include a trailing \0 */
-		name[rc1] = '\0';
-		read_fn_arg.fs = &cf->cf_nvs;
-		read_fn_arg.id = name_id + NVS_NAME_ID_OFFSET;
+	rc = (entry.len != 0U) ?
+	     nvs_entry_read(&cf->cf_nvs, &entry, name, sizeof(name)) : 0;
+
+	if ((rc <= 0) && (value_len == 0U)) {
+		return 0;
+	}
+
+	if ((rc <= 0) || (value_len == 0U)) {
+		settings_nvs_clean(cf, name_id);
+		return 0;
+	}
+
+	name[MIN((size_t)rc, sizeof(name) - 1)] = '\0';
+	read_fn_arg.fs = &cf->cf_nvs;
+	read_fn_arg.entry.id = name_id + NVS_NAME_ID_OFFSET;
+	read_fn_arg.entry.len = value_len;
+	read_fn_arg.entry.data_addr = le->value_addr;
 
 #if CONFIG_SETTINGS_NVS_NAME_CACHE
-		settings_nvs_cache_add(cf, name, name_id);
+	settings_nvs_cache_add(cf, name, name_id);
+#endif
+
+	return settings_call_set_handler(name, value_len,
+					 settings_nvs_entry_read_fn,
+					 &read_fn_arg, (void *)arg);
+}
+
+static int settings_nvs_load_walk(struct settings_nvs *cf,
+				  const struct settings_load_arg *arg)
+{
+	uint32_t ate_wra;
+	uint16_t name_id;
+	int ret;
+
+	memset(load_table, 0, sizeof(load_table));
+
+	ret = nvs_walk(&cf->cf_nvs, settings_nvs_load_cb, cf);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ate_wra = cf->cf_nvs.ate_wra;
+
+	for (name_id = cf->last_name_id; name_id > NVS_NAMECNT_ID; name_id--) {
+		if (cf->cf_nvs.ate_wra == ate_wra) {
+			ret = settings_nvs_load_entry(cf, name_id, arg);
+		} else {
+			/* Written by a handler or a clean up, the entries
+			 * found may have been moved by garbage collection.
+			 */
+			ret = settings_nvs_load_id(cf, name_id, arg);
+		}
+
+		if (ret) {
+			break;
+		}
+	}
+
+	return ret;
+}
+#endif /* CONFIG_SETTINGS_NVS_STREAMING_LOAD */
+
+static int settings_nvs_load(struct settings_store *cs,
+			     const struct settings_load_arg *arg)
+{
+	int ret = 0;
+	struct settings_nvs *cf = CONTAINER_OF(cs, struct settings_nvs, cf_store);
+	uint16_t name_id;
+
+#if CONFIG_SETTINGS_NVS_STREAMING_LOAD
+	if (cf->last_name_id - NVS_NAMECNT_ID <=
+	    CONFIG_SETTINGS_NVS_STREAMING_LOAD_MAX) {
+		return settings_nvs_load_walk(cf, arg);
+	}
 #endif
 
-		ret = settings_call_set_handler(
-			name, rc2,
-			settings_nvs_read_fn, &read_fn_arg,
-			(void *)arg);
+	for (name_id = cf->last_name_id; name_id > NVS_NAMECNT_ID; name_id--) {
+		ret = settings_nvs_load_id(cf, name_id, arg);
 		if (ret) {
 			break;
 		}
 	}
+
 	return ret;
 }
 
@@ -24,6 +24,159 @@ sys_slist_t settings_load_srcs;
 struct settings_store *settings_save_dst;
 extern struct k_mutex settings_lock;
 
+#if defined(CONFIG_SETTINGS_WRITE_BACK)
+/* Value waiting in the write-back cache */
+struct settings_wb_entry {
+	char name[SETTINGS_MAX_NAME_LEN + 1];
+	uint8_t value[CONFIG_SETTINGS_WRITE_BACK_VALUE_MAX];
+	size_t val_len;
+	bool deleted;
+};
+
+/* Entries are kept in the order their key was first saved, so that a flush
+ * interrupted by a power loss leaves the oldest values in storage.
+ */
+static struct settings_wb_entry wb_entries[CONFIG_SETTINGS_WRITE_BACK_ENTRIES];
+static size_t wb_count;
+static struct settings_save_stats wb_stats;
+static struct k_work_delayable wb_work;
+/* Delay before retrying a failed write-back, doubled on each failure */
+static uint32_t wb_retry_ms;
+
+static int wb_write(struct settings_store *cs, const char *name,
+		    const void *value, size_t val_len)
+{
+	int rc;
+
+	rc = cs->cs_itf->csi_save(cs, name, value, val_len);
+	if (rc == 0) {
+		wb_stats.writes++;
+	}
+
+	return rc;
+}
+
+/* Called with settings_lock held */
+static int wb_flush(void)
+{
+	struct settings_store *cs = settings_save_dst;
+	size_t i;
+	int rc = 0;
+
+	if (wb_count == 0) {
+		return 0;
+	}
+
+	if (!cs) {
+		return -ENOENT;
+	}
+
+	for (i = 0; i < wb_count; i++) {
+		struct settings_wb_entry *entry = &wb_entries[i];
+
+		rc = wb_write(cs, entry->name,
+			      entry->deleted ? NULL : entry->value,
+			      entry->val_len);
+		if (rc) {
+			LOG_ERR("write-back of %s failed (err %d)", entry->name,
+				rc);
+			break;
+		}
+	}
+
+	wb_count -= i;
+	if (wb_count > 0) {
+		memmove(&wb_entries[0], &wb_entries[i],
+			wb_count * sizeof(wb_entries[0]));
+	}
+
+	if (rc == 0) {
+		wb_retry_ms = 0;
+	}
+
+	return rc;
+}
+
+/* Called with settings_lock held */
+static int wb_save(struct settings_store *cs, const char *name,
+		   const void *value, size_t val_len)
+{
+	struct settings_wb_entry *entry = NULL;
+	size_t name_len = strlen(name);
+	int rc;
+
+	wb_stats.saves++;
+
+	if ((val_len > CONFIG_SETTINGS_WRITE_BACK_VALUE_MAX) ||
+	    (name_len > SETTINGS_MAX_NAME_LEN)) {
+		/* Write through, after any older value of the same key */
+		rc = wb_flush();
+		if (rc == 0) {
+			rc = wb_write(cs, name, value, val_len);
+		}
+		return rc;
+	}
+
+	for (size_t i = 0; i < wb_count; i++) {
+		if (strcmp(wb_entries[i].name, name) == 0) {
+			entry = &wb_entries[i];
+			break;
+		}
+	}
+
+	if (!entry) {
+		if (wb_count == ARRAY_SIZE(wb_entries)) {
+			rc = wb_flush();
+			if (rc) {
+				return rc;
+			}
+		}
+		entry = &wb_entries[wb_count++];
+		memcpy(entry->name, name, name_len + 1);
+	}
+
+	entry->deleted = (value == NULL);
+	entry->val_len = entry->deleted ? 0 : val_len;
+	if (entry->val_len) {
+		memcpy(entry->value, value, entry->val_len);
+	}
+
+	/* The deadline runs from the first save since the last flush */
+	(void)k_work_schedule(&wb_work,
+			      K_MSEC(CONFIG_SETTINGS_WRITE_BACK_DELAY_MS));
+
+	return 0;
+}
+
+static void wb_work_handler(struct k_work *work)
+{
+	int rc;
+
+	k_mutex_lock(&settings_lock, K_FOREVER);
+	rc = wb_flush();
+	if (rc && (wb_count > 0)) {
+		/* Keep the pending values and retry, backing off so that a
+		 * failing back-end is not hammered.
+		 */
+		if (wb_retry_ms == 0) {
+			wb_retry_ms = CONFIG_SETTINGS_WRITE_BACK_DELAY_MS;
+		} else {
+			wb_retry_ms = MIN(2 * wb_retry_ms,
+					  CONFIG_SETTINGS_WRITE_BACK_RETRY_MAX_MS);
+		}
+		(void)k_work_schedule(&wb_work, K_MSEC(wb_retry_ms));
+	}
+	k_mutex_unlock(&settings_lock);
+}
+
+void settings_save_stats_get(struct settings_save_stats *stats)
+{
+	k_mutex_lock(&settings_lock, K_FOREVER);
+	*stats = wb_stats;
+	k_mutex_unlock(&settings_lock);
+}
+#endif /* CONFIG_SETTINGS_WRITE_BACK */
+
 void settings_src_register(struct settings_store *cs)
 {
 	sys_slist_append(&settings_load_srcs, &cs->cs_next);
@@ -54,6 +207,9 @@ int settings_load_subtree(const char *subtree)
 	 *    commit all
 	 */
 	k_mutex_lock(&settings_lock, K_FOREVER);
+#if defined(CONFIG_SETTINGS_WRITE_BACK)
+	(void)wb_flush();
+#endif /* CONFIG_SETTINGS_WRITE_BACK */
 	SYS_SLIST_FOR_EACH_CONTAINER(&settings_load_srcs, cs, cs_next) {
 		cs->cs_itf->csi_load(cs, &arg);
 	}
@@ -81,6 +237,9 @@ int settings_load_subtree_direct(
 	 *    commit all
 	 */
 	k_mutex_lock(&settings_lock, K_FOREVER);
+#if defined(CONFIG_SETTINGS_WRITE_BACK)
+	(void)wb_flush();
+#endif /* CONFIG_SETTINGS_WRITE_BACK */
 	SYS_SLIST_FOR_EACH_CONTAINER(&settings_load_srcs, cs, cs_next) {
 		cs->cs_itf->csi_load(cs, &arg);
 	}
@@ -103,7 +262,11 @@ int settings_save_one(const char *name, const void *value, size_t val_len)
 
 	k_mutex_lock(&settings_lock, K_FOREVER);
 
+#if defined(CONFIG_SETTINGS_WRITE_BACK)
+	rc = wb_save(cs, name, value, val_len);
+#else
 	rc = cs->cs_itf->csi_save(cs, name, (char *)value, val_len);
+#endif /* CONFIG_SETTINGS_WRITE_BACK */
 
 	k_mutex_unlock(&settings_lock);
 
@@ -115,6 +278,22 @@ int settings_delete(const char *name)
 	return settings_save_one(name, NULL, 0);
 }
 
+int settings_save_flush(void)
+{
+	int rc = 0;
+
+#if defined(CONFIG_SETTINGS_WRITE_BACK)
+	k_mutex_lock(&settings_lock, K_FOREVER);
+	rc = wb_flush();
+	if (wb_count == 0) {
+		(void)k_work_cancel_delayable(&wb_work);
+	}
+	k_mutex_unlock(&settings_lock);
+#endif /* CONFIG_SETTINGS_WRITE_BACK */
+
+	return rc;
+}
+
 int settings_save(void)
 {
 	struct settings_store *cs;
@@ -152,6 +331,11 @@ int settings_save(void)
 	}
 #endif /* CONFIG_SETTINGS_DYNAMIC_HANDLERS */
 
+	rc2 = settings_save_flush();
+	if (!rc) {
+		rc = rc2;
+	}
+
 	if (cs->cs_itf->csi_save_end) {
 		cs->cs_itf->csi_save_end(cs);
 	}
@@ -176,4 +360,7 @@ int settings_storage_get(void **storage)
 void settings_store_init(void)
 {
 	sys_slist_init(&settings_load_srcs);
+#if defined(CONFIG_SETTINGS_WRITE_BACK)
+	k_work_init_delayable(&wb_work, wb_work_handler);
+#endif /* CONFIG_SETTINGS_WRITE_BACK */
 }
@@ -29,7 +29,7 @@ struct layout_data {
 };
 
 /*
- * Check if a flash_page_foreach() callback should exit early, due to
+ * Check if a flash_page_foreach_range() callback should exit early, due to
  * one of the following conditions:
  *
  * - The flash page described by "info" is before the area of interest
@@ -38,7 +38,7 @@ struct layout_data {
  * - There are too many flash pages on the device to fit in the array
  *   held in data->ret. In this case, data->status is set to -ENOMEM.
  *
- * The value to return to flash_page_foreach() is stored in
+ * The value to return to flash_page_foreach_range() is stored in
  * "bail_value" if the callback should exit early.
  */
 static bool should_bail(const struct flash_pages_info *info,
@@ -92,7 +92,8 @@ flash_page_cb cb, struct layout_data *cb_data)
 		return -ENODEV;
 	}
 
-	flash_page_foreach(flash_dev, cb, cb_data);
+	flash_page_foreach_range(flash_dev, cb_data->area_off,
+				 cb_data->area_len, cb, cb_data);
 
 	if (cb_data->status == 0) {
 		*cnt = cb_data->ret_idx;
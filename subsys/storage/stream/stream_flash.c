@@ -16,6 +16,15 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME, CONFIG_STREAM_FLASH_LOG_LEVEL);
 
 #include <zephyr/storage/stream_flash.h>
 
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+#include <zephyr/init.h>
+
+static int pipe_wait(struct stream_flash_ctx *ctx);
+#endif
+#ifdef CONFIG_STREAM_FLASH_PIPELINE_CRC
+#include <zephyr/sys/crc.h>
+#endif
+
 #ifdef CONFIG_STREAM_FLASH_PROGRESS
 #include <zephyr/settings/settings.h>
 
@@ -39,6 +48,9 @@ static int settings_direct_loader(const char *key, size_t len,
 		/* Check that loaded progress is not outdated. */
 		if (bytes_written >= ctx->bytes_written) {
 			ctx->bytes_written = bytes_written;
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+			ctx->pipe_submitted = bytes_written;
+#endif
 		} else {
 			LOG_WRN("Loaded outdated bytes_written %zu < %zu",
 				bytes_written, ctx->bytes_written);
@@ -74,7 +86,7 @@ static int settings_direct_loader(const char *key, size_t len,
 
 #ifdef CONFIG_STREAM_FLASH_ERASE
 
-int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off)
+static int erase_page(struct stream_flash_ctx *ctx, off_t off)
 {
 	int rc;
 	struct flash_pages_info page;
@@ -97,49 +109,90 @@ int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off)
 		LOG_ERR("Error %d while erasing page", rc);
 	} else {
 		ctx->last_erased_page_start_offset = page.start_offset;
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+		ctx->stats.erases++;
+#endif
 	}
 
 	return rc;
 }
 
-#endif /* CONFIG_STREAM_FLASH_ERASE */
-
-static int flash_sync(struct stream_flash_ctx *ctx)
+int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off)
 {
-	int rc = 0;
-	size_t write_addr = ctx->offset + ctx->bytes_written;
-	size_t buf_bytes_aligned;
-	size_t fill_length;
-	uint8_t filler;
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+	if (ctx->pipe_buf) {
+		int rc;
 
+		/* Keep the work queue from erasing ahead meanwhile */
+		(void)pipe_wait(ctx);
+		rc = erase_page(ctx, off);
+		k_sem_give(&ctx->pipe_idle);
 
-	if (ctx->buf_bytes == 0) {
-		return 0;
+		return rc;
 	}
+#endif
 
-	if (IS_ENABLED(CONFIG_STREAM_FLASH_ERASE)) {
+	return erase_page(ctx, off);
+}
+
+/* Erase the page holding off before writing to it */
+static int erase_for_write(struct stream_flash_ctx *ctx, off_t off)
+{
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+	if (ctx->pipe_buf) {
+		struct flash_pages_info page;
+		int rc;
 
-		rc = stream_flash_erase_page(ctx,
-					     write_addr + ctx->buf_bytes - 1);
-		if (rc < 0) {
-			LOG_ERR("stream_flash_erase_page err %d offset=0x%08zx",
-				rc, write_addr);
+		/* Writes are sequential: pages up to the last one erased
+		 * have either been written to or erased ahead.
+		 */
+		rc = flash_get_page_info_by_offs(ctx->fdev, off, &page);
+		if (rc != 0) {
+			LOG_ERR("Error %d while getting page info", rc);
 			return rc;
 		}
+
+		if (page.start_offset <= ctx->last_erased_page_start_offset) {
+			return 0;
+		}
 	}
+#endif
+
+	return erase_page(ctx, off);
+}
+
+#endif /* CONFIG_STREAM_FLASH_ERASE */
+
+/* Erase if needed, program buf to write_addr and read it back */
+static int flash_program(struct stream_flash_ctx *ctx, uint8_t *buf,
+			 size_t buf_bytes, size_t write_addr)
+{
+	int rc = 0;
+	size_t buf_bytes_aligned;
+	size_t fill_length;
+	uint8_t filler;
+
+#ifdef CONFIG_STREAM_FLASH_ERASE
+	rc = erase_for_write(ctx, write_addr + buf_bytes - 1);
+	if (rc < 0) {
+		LOG_ERR("stream_flash_erase_page err %d offset=0x%08zx",
+			rc, write_addr);
+		return rc;
+	}
+#endif
 
 	fill_length = flash_get_write_block_size(ctx->fdev);
-	if (ctx->buf_bytes % fill_length) {
-		fill_length -= ctx->buf_bytes % fill_length;
+	if (buf_bytes % fill_length) {
+		fill_length -= buf_bytes % fill_length;
 		filler = flash_get_parameters(ctx->fdev)->erase_value;
 
-		memset(ctx->buf + ctx->buf_bytes, filler, fill_length);
+		memset(buf + buf_bytes, filler, fill_length);
 	} else {
 		fill_length = 0;
 	}
 
-	buf_bytes_aligned = ctx->buf_bytes + fill_length;
-	rc = flash_write(ctx->fdev, write_addr, ctx->buf, buf_bytes_aligned);
+	buf_bytes_aligned = buf_bytes + fill_length;
+	rc = flash_write(ctx->fdev, write_addr, buf, buf_bytes_aligned);
 
 	if (rc != 0) {
 		LOG_ERR("flash_write error %d offset=0x%08zx", rc,
@@ -147,28 +200,224 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 		return rc;
 	}
 
-	if (ctx->callback) {
+	if (ctx->callback || IS_ENABLED(CONFIG_STREAM_FLASH_PIPELINE_CRC)) {
 		/* Invert to ensure that caller is able to discover a faulty
 		 * flash_read() even if no error code is returned.
 		 */
-		for (int i = 0; i < ctx->buf_bytes; i++) {
-			ctx->buf[i] = ~ctx->buf[i];
+		for (int i = 0; i < buf_bytes; i++) {
+			buf[i] = ~buf[i];
 		}
 
-		rc = flash_read(ctx->fdev, write_addr, ctx->buf,
-				ctx->buf_bytes);
+		rc = flash_read(ctx->fdev, write_addr, buf, buf_bytes);
 		if (rc != 0) {
 			LOG_ERR("flash read failed: %d", rc);
 			return rc;
 		}
+	}
+
+#ifdef CONFIG_STREAM_FLASH_PIPELINE_CRC
+	ctx->crc = crc32_ieee_update(ctx->crc, buf, buf_bytes);
+#endif
 
-		rc = ctx->callback(ctx->buf, ctx->buf_bytes, write_addr);
+	if (ctx->callback) {
+		rc = ctx->callback(buf, buf_bytes, write_addr);
 		if (rc != 0) {
 			LOG_ERR("callback failed: %d", rc);
 			return rc;
 		}
 	}
 
+	return rc;
+}
+
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+
+static K_THREAD_STACK_DEFINE(pipe_stack, CONFIG_STREAM_FLASH_PIPELINE_STACK_SIZE);
+static struct k_work_q pipe_queue;
+
+static void pipe_handler(struct k_work *work)
+{
+	struct stream_flash_ctx *ctx =
+		CONTAINER_OF(work, struct stream_flash_ctx, pipe_work);
+	int64_t start = k_uptime_ticks();
+	int rc;
+
+	/* bytes_written is left to pipe_wait(), it belongs to the writer */
+	rc = flash_program(ctx, ctx->pipe_buf, ctx->pipe_bytes, ctx->pipe_addr);
+	if (rc == 0) {
+		ctx->stats.bytes += ctx->pipe_bytes;
+		ctx->stats.buffers++;
+
+#ifdef CONFIG_STREAM_FLASH_ERASE
+		size_t next_addr = ctx->pipe_addr + ctx->pipe_bytes;
+		size_t end = ctx->offset + ctx->available;
+
+		/* Erase ahead the page the next buffer ends in. A failure is
+		 * reported when writing the next buffer.
+		 */
+		if (next_addr < end) {
+			(void)erase_for_write(ctx,
+					      MIN(next_addr + ctx->buf_len, end) - 1);
+		}
+#endif
+	} else {
+		ctx->pipe_error = rc;
+	}
+
+	ctx->stats.flash_us += k_ticks_to_us_floor32(k_uptime_ticks() - start);
+
+	k_sem_give(&ctx->pipe_idle);
+}
+
+/* Wait for the buffer being programmed, leaving pipe_idle taken, and
+ * account for it once programmed
+ */
+static int pipe_wait(struct stream_flash_ctx *ctx)
+{
+	int64_t start = k_uptime_ticks();
+
+	(void)k_sem_take(&ctx->pipe_idle, K_FOREVER);
+	ctx->stats.wait_us += k_ticks_to_us_floor32(k_uptime_ticks() - start);
+
+	if (ctx->pipe_error == 0) {
+		ctx->bytes_written += ctx->pipe_bytes;
+		ctx->pipe_bytes = 0U;
+	}
+
+	return ctx->pipe_error;
+}
+
+static int pipe_sync(struct stream_flash_ctx *ctx)
+{
+	int rc = pipe_wait(ctx);
+
+	k_sem_give(&ctx->pipe_idle);
+
+	return rc;
+}
+
+/* Hand the write buffer over to the work queue and continue in the other */
+static int pipe_submit(struct stream_flash_ctx *ctx)
+{
+	uint8_t *buf = ctx->pipe_buf;
+	int rc;
+
+	rc = pipe_wait(ctx);
+	if (rc != 0) {
+		k_sem_give(&ctx->pipe_idle);
+		return rc;
+	}
+
+	ctx->pipe_buf = ctx->buf;
+	ctx->pipe_bytes = ctx->buf_bytes;
+	ctx->pipe_addr = ctx->offset + ctx->bytes_written;
+	ctx->pipe_submitted = ctx->bytes_written + ctx->buf_bytes;
+	ctx->buf = buf;
+	ctx->buf_bytes = 0U;
+
+	(void)k_work_submit_to_queue(&pipe_queue, &ctx->pipe_work);
+
+	return 0;
+}
+
+int stream_flash_pipeline_init(struct stream_flash_ctx *ctx, uint8_t *buf2)
+{
+	if (!ctx || !buf2 || !ctx->buf) {
+		return -EFAULT;
+	}
+
+	ctx->pipe_buf = buf2;
+	ctx->pipe_bytes = 0U;
+	ctx->pipe_submitted = ctx->bytes_written;
+	ctx->pipe_error = 0;
+	memset(&ctx->stats, 0, sizeof(ctx->stats));
+#ifdef CONFIG_STREAM_FLASH_PIPELINE_CRC
+	ctx->crc = 0U;
+#endif
+	k_work_init(&ctx->pipe_work, pipe_handler);
+	k_sem_init(&ctx->pipe_idle, 1, 1);
+
+	return 0;
+}
+
+void stream_flash_stats_get(struct stream_flash_ctx *ctx,
+			    struct stream_flash_stats *stats)
+{
+	if (ctx->pipe_buf) {
+		(void)pipe_sync(ctx);
+	}
+
+	*stats = ctx->stats;
+}
+
+#ifdef CONFIG_STREAM_FLASH_PIPELINE_CRC
+int stream_flash_crc32(struct stream_flash_ctx *ctx, uint32_t *crc)
+{
+	int rc = 0;
+
+	if (!ctx || !crc) {
+		return -EFAULT;
+	}
+
+	if (ctx->pipe_buf) {
+		rc = pipe_sync(ctx);
+	}
+
+	*crc = ctx->crc;
+
+	return rc;
+}
+#endif /* CONFIG_STREAM_FLASH_PIPELINE_CRC */
+
+static int stream_flash_pipeline_start(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	k_work_queue_start(&pipe_queue, pipe_stack,
+			   K_THREAD_STACK_SIZEOF(pipe_stack),
+			   CONFIG_STREAM_FLASH_PIPELINE_PRIORITY, NULL);
+	k_thread_name_set(&pipe_queue.thread, "stream_flash");
+
+	return 0;
+}
+
+SYS_INIT(stream_flash_pipeline_start, POST_KERNEL,
+	 CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+
+#endif /* CONFIG_STREAM_FLASH_PIPELINE */
+
+/* Bytes written to flash or being written */
+static size_t bytes_submitted(struct stream_flash_ctx *ctx)
+{
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+	if (ctx->pipe_buf) {
+		return ctx->pipe_submitted;
+	}
+#endif
+
+	return ctx->bytes_written;
+}
+
+static int flash_sync(struct stream_flash_ctx *ctx)
+{
+	int rc = 0;
+	size_t write_addr = ctx->offset + ctx->bytes_written;
+
+	if (ctx->buf_bytes == 0) {
+		return 0;
+	}
+
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+	if (ctx->pipe_buf) {
+		return pipe_submit(ctx);
+	}
+#endif
+
+	rc = flash_program(ctx, ctx->buf, ctx->buf_bytes, write_addr);
+	if (rc != 0) {
+		return rc;
+	}
+
 	ctx->bytes_written += ctx->buf_bytes;
 	ctx->buf_bytes = 0U;
 
@@ -186,7 +435,7 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		return -EFAULT;
 	}
 
-	if (ctx->bytes_written + ctx->buf_bytes + len > ctx->available) {
+	if (bytes_submitted(ctx) + ctx->buf_bytes + len > ctx->available) {
 		return -ENOMEM;
 	}
 
@@ -216,6 +465,12 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		rc = flash_sync(ctx);
 	}
 
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+	if (flush && rc == 0 && ctx->pipe_buf) {
+		rc = pipe_sync(ctx);
+	}
+#endif
+
 	return rc;
 }
 
@@ -299,6 +554,11 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 #ifdef CONFIG_STREAM_FLASH_ERASE
 	ctx->last_erased_page_start_offset = -1;
 #endif
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+	ctx->pipe_buf = NULL;
+	/* Erases are counted whether or not the context is pipelined */
+	memset(&ctx->stats, 0, sizeof(ctx->stats));
+#endif
 
 	return 0;
 }
@@ -499,6 +499,12 @@ void sys_trace_thread_info(struct k_thread *thread);
 #define sys_port_trace_k_msgq_get_enter(msgq, timeout)
 #define sys_port_trace_k_msgq_get_blocking(msgq, timeout)
 #define sys_port_trace_k_msgq_get_exit(msgq, timeout, ret)
+#define sys_port_trace_k_msgq_put_batch_enter(msgq, timeout)
+#define sys_port_trace_k_msgq_put_batch_blocking(msgq, timeout)
+#define sys_port_trace_k_msgq_put_batch_exit(msgq, timeout, ret)
+#define sys_port_trace_k_msgq_get_batch_enter(msgq, timeout)
+#define sys_port_trace_k_msgq_get_batch_blocking(msgq, timeout)
+#define sys_port_trace_k_msgq_get_batch_exit(msgq, timeout, ret)
 #define sys_port_trace_k_msgq_peek(msgq, ret)
 #define sys_port_trace_k_msgq_purge(msgq)
 
@@ -315,6 +315,18 @@
 	sys_trace_k_msgq_get_blocking(msgq, data, timeout)
 #define sys_port_trace_k_msgq_get_exit(msgq, timeout, ret)                                         \
 	sys_trace_k_msgq_get_exit(msgq, data, timeout, ret)
+#define sys_port_trace_k_msgq_put_batch_enter(msgq, timeout)                                       \
+	sys_trace_k_msgq_put_batch_enter(msgq, data, num_msgs, timeout)
+#define sys_port_trace_k_msgq_put_batch_blocking(msgq, timeout)                                    \
+	sys_trace_k_msgq_put_batch_blocking(msgq, data, num_msgs, timeout)
+#define sys_port_trace_k_msgq_put_batch_exit(msgq, timeout, ret)                                   \
+	sys_trace_k_msgq_put_batch_exit(msgq, data, num_msgs, timeout, ret)
+#define sys_port_trace_k_msgq_get_batch_enter(msgq, timeout)                                       \
+	sys_trace_k_msgq_get_batch_enter(msgq, data, num_msgs, timeout)
+#define sys_port_trace_k_msgq_get_batch_blocking(msgq, timeout)                                    \
+	sys_trace_k_msgq_get_batch_blocking(msgq, data, num_msgs, timeout)
+#define sys_port_trace_k_msgq_get_batch_exit(msgq, timeout, ret)                                   \
+	sys_trace_k_msgq_get_batch_exit(msgq, data, num_msgs, timeout, ret)
 #define sys_port_trace_k_msgq_peek(msgq, ret) sys_trace_k_msgq_peek(msgq, data, ret)
 #define sys_port_trace_k_msgq_purge(msgq) sys_trace_k_msgq_purge(msgq)
 
@@ -651,6 +663,18 @@ void sys_trace_k_msgq_put_exit(struct k_msgq *msgq, const void *data, k_timeout_
 void sys_trace_k_msgq_get_enter(struct k_msgq *msgq, const void *data, k_timeout_t timeout);
 void sys_trace_k_msgq_get_blocking(struct k_msgq *msgq, const void *data, k_timeout_t timeout);
 void sys_trace_k_msgq_get_exit(struct k_msgq *msgq, const void *data, k_timeout_t timeout, int ret);
+void sys_trace_k_msgq_put_batch_enter(struct k_msgq *msgq, const void *data, uint32_t num_msgs,
+				      k_timeout_t timeout);
+void sys_trace_k_msgq_put_batch_blocking(struct k_msgq *msgq, const void *data, uint32_t num_msgs,
+					 k_timeout_t timeout);
+void sys_trace_k_msgq_put_batch_exit(struct k_msgq *msgq, const void *data, uint32_t num_msgs,
+				     k_timeout_t timeout, int ret);
+void sys_trace_k_msgq_get_batch_enter(struct k_msgq *msgq, const void *data, uint32_t num_msgs,
+				      k_timeout_t timeout);
+void sys_trace_k_msgq_get_batch_blocking(struct k_msgq *msgq, const void *data, uint32_t num_msgs,
+					 k_timeout_t timeout);
+void sys_trace_k_msgq_get_batch_exit(struct k_msgq *msgq, const void *data, uint32_t num_msgs,
+				     k_timeout_t timeout, int ret);
 void sys_trace_k_msgq_peek(struct k_msgq *msgq, void *data, int ret);
 void sys_trace_k_msgq_purge(struct k_msgq *msgq);
 
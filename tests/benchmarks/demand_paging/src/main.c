@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/mem_manage.h>
+
+/* This is a page fault rate benchmark for the demand paging eviction
+ * algorithms. An anonymous memory arena larger than free physical memory
+ * is mapped, and one byte per page is read or written following two access
+ * patterns:
+ *
+ * - "loop" sweeps the whole arena in order, which is the worst case for
+ *   algorithms approximating least recently used ordering.
+ * - "hot" sends nine in ten accesses to a hot set of pages half the size of
+ *   free physical memory, and the rest anywhere in the arena.
+ *
+ * For each pattern the number of page faults per thousand accesses, the
+ * average number of page frames the eviction algorithm examined per
+ * eviction, and the average number of cycles per access are reported.
+ *
+ * Every page holds a byte derived from its number, and every access
+ * checks it, so a page that was paged out or in wrongly fails the test.
+ */
+
+#define EXTRA_PAGES (CONFIG_BACKING_STORE_RAM_PAGES / 2)
+#define N_ACCESSES  20000
+
+static uint8_t *arena;
+static size_t arena_pages;
+static size_t hot_pages;
+static uint32_t seed = 2463534242U;
+
+static uint32_t xorshift32(void)
+{
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+
+	return seed;
+}
+
+static uint8_t page_tag(size_t page)
+{
+	return (uint8_t)(page ^ 0x5aU);
+}
+
+static void access_page(size_t page, unsigned int i)
+{
+	uint8_t *p = &arena[page * CONFIG_MMU_PAGE_SIZE];
+
+	zassert_equal(*p, page_tag(page), "page %zu corrupted", page);
+
+	/* One access in four dirties the page */
+	if ((i % 4U) == 0U) {
+		*p = page_tag(page);
+	}
+}
+
+static size_t loop_next(unsigned int i)
+{
+	return i % arena_pages;
+}
+
+static size_t hot_next(unsigned int i)
+{
+	uint32_t r = xorshift32();
+
+	ARG_UNUSED(i);
+
+	if ((r % 10U) != 0U) {
+		return (r / 10U) % hot_pages;
+	}
+
+	return (r / 10U) % arena_pages;
+}
+
+static void run(const char *name, size_t (*next)(unsigned int i))
+{
+	struct k_mem_paging_stats_t before, after;
+	unsigned long faults, evictions, scanned;
+	uint32_t cycles;
+
+	zassert_not_null(arena, "failed to map anonymous memory arena");
+
+	k_mem_paging_stats_get(&before);
+
+	cycles = k_cycle_get_32();
+	for (unsigned int i = 0; i < N_ACCESSES; i++) {
+		access_page(next(i), i);
+	}
+	cycles = k_cycle_get_32() - cycles;
+
+	k_mem_paging_stats_get(&after);
+
+	faults = after.pagefaults.cnt - before.pagefaults.cnt;
+	evictions = (after.eviction.clean + after.eviction.dirty) -
+		    (before.eviction.clean + before.eviction.dirty);
+	scanned = after.eviction.scanned - before.eviction.scanned;
+
+	TC_PRINT("%s faults/1k %lu scanned/eviction %lu cycles/access %u\n",
+		 name, (faults * 1000UL) / N_ACCESSES,
+		 (evictions != 0UL) ? (scanned / evictions) : 0UL,
+		 cycles / N_ACCESSES);
+
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+	TC_PRINT("%s read ahead %lu faults avoided %lu\n", name,
+		 after.read_ahead.pages - before.read_ahead.pages,
+		 after.read_ahead.hits - before.read_ahead.hits);
+#endif
+
+	zassert_true(evictions > 0UL, "%s did not page anything out", name);
+}
+
+ZTEST(demand_paging_bench, test_loop)
+{
+	run("loop", loop_next);
+}
+
+ZTEST(demand_paging_bench, test_hot)
+{
+	run("hot", hot_next);
+}
+
+static void *demand_paging_bench_setup(void)
+{
+	size_t arena_size;
+
+	arena_size = k_mem_free_get() + (EXTRA_PAGES * CONFIG_MMU_PAGE_SIZE);
+	arena = k_mem_map(arena_size, K_MEM_PERM_RW);
+	if (arena == NULL) {
+		return NULL;
+	}
+
+	arena_pages = arena_size / CONFIG_MMU_PAGE_SIZE;
+	hot_pages = MAX((arena_pages - EXTRA_PAGES) / 2U, 1U);
+
+	TC_PRINT("demand paging benchmark: %zu arena pages, %zu hot pages\n",
+		 arena_pages, hot_pages);
+
+	/* Tag every page, which also fills physical memory */
+	for (size_t page = 0; page < arena_pages; page++) {
+		arena[page * CONFIG_MMU_PAGE_SIZE] = page_tag(page);
+	}
+
+	return NULL;
+}
+
+static void demand_paging_bench_teardown(void *fixture)
+{
+	struct k_mem_paging_stats_t stats;
+
+	ARG_UNUSED(fixture);
+
+	k_mem_paging_stats_get(&stats);
+	TC_PRINT("max scanned/eviction %lu\n", stats.eviction.scanned_max);
+}
+
+ZTEST_SUITE(demand_paging_bench, NULL, demand_paging_bench_setup, NULL, NULL,
+	    demand_paging_bench_teardown);
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/fs/fcb.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/ztest.h>
+
+/* This is a Flash Circular Buffer benchmark. Elements are appended to an
+ * FCB on the flash simulator, which is then initialized again and walked
+ * forwards and backwards. Settings are saved to and loaded from the
+ * settings FCB back-end. The time taken by each step is reported.
+ *
+ * Both walks must visit every element once, in order, and the elements
+ * must read back as written. Loading the settings must return each key
+ * once with the value saved last.
+ */
+
+#define BENCH_AREA_ID  FIXED_PARTITION_ID(bench_partition)
+#define N_SECTORS      64
+#define N_ELEMS        1500
+#define ELEM_LEN       24
+#define INDEX_SIZE     32
+#define N_KEYS         64
+#define N_SAVES        4
+
+static struct flash_sector sectors[N_SECTORS];
+#ifdef CONFIG_FCB_INDEX
+static struct fcb_index_entry fcb_index[N_SECTORS * INDEX_SIZE];
+#endif
+static struct fcb fcb;
+static uint8_t elem[ELEM_LEN];
+static struct fcb_entry locs[N_ELEMS];
+static int n_loaded;
+static int n_bad;
+static uint8_t seen[N_KEYS];
+
+static int bench_set(const char *name, size_t len, settings_read_cb read_cb,
+		     void *cb_arg)
+{
+	uint32_t value;
+	long key = -1;
+
+	if (strncmp(name, "key", 3) == 0) {
+		key = strtol(&name[3], NULL, 10);
+	}
+
+	if ((key < 0) || (key >= N_KEYS) || (seen[key]++ != 0U) ||
+	    (read_cb(cb_arg, &value, sizeof(value)) != sizeof(value)) ||
+	    (value != ((N_SAVES - 1) * N_KEYS + key))) {
+		n_bad++;
+		return 0;
+	}
+
+	n_loaded++;
+
+	return 0;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(bench, "bench", NULL, bench_set, NULL, NULL);
+
+static void report(const char *name, int count, const char *unit,
+		   uint32_t cycles)
+{
+	TC_PRINT("%-14s %5d %-8s us %8u\n", name, count, unit,
+		 k_cyc_to_us_floor32(cycles));
+}
+
+static int bench_fcb_init(void)
+{
+	uint32_t cnt = N_SECTORS;
+	int rc;
+
+	rc = flash_area_get_sectors(BENCH_AREA_ID, &cnt, sectors);
+	if (rc) {
+		return rc;
+	}
+
+	(void)memset(&fcb, 0, sizeof(fcb));
+	fcb.f_sector_cnt = cnt;
+	fcb.f_sectors = sectors;
+#ifdef CONFIG_FCB_INDEX
+	fcb.f_index = fcb_index;
+	fcb.f_index_size = INDEX_SIZE;
+#endif
+
+	return fcb_init(BENCH_AREA_ID, &fcb);
+}
+
+static int fill(void)
+{
+	struct fcb_entry loc;
+	int rc;
+
+	for (int i = 0; i < N_ELEMS; i++) {
+		memset(elem, (uint8_t)i, sizeof(elem));
+		rc = fcb_append(&fcb, sizeof(elem), &loc);
+		if (rc) {
+			return rc;
+		}
+		rc = flash_area_write(fcb.fap, FCB_ENTRY_FA_DATA_OFF(loc), elem,
+				      sizeof(elem));
+		if (rc) {
+			return rc;
+		}
+		rc = fcb_append_finish(&fcb, &loc);
+		if (rc) {
+			return rc;
+		}
+	}
+
+	return 0;
+}
+
+static bool same_entry(const struct fcb_entry *a, const struct fcb_entry *b)
+{
+	return (a->fe_sector == b->fe_sector) &&
+	       (a->fe_elem_off == b->fe_elem_off);
+}
+
+static int record_cb(struct fcb_entry_ctx *entry_ctx, void *arg)
+{
+	int *count = arg;
+
+	if (*count < N_ELEMS) {
+		locs[*count] = entry_ctx->loc;
+	}
+	(*count)++;
+
+	return 0;
+}
+
+static void bench_fcb_erase(void)
+{
+	const struct flash_area *fap;
+	int rc;
+
+	rc = flash_area_open(BENCH_AREA_ID, &fap);
+	zassert_equal(rc, 0, "opening area failed %d", rc);
+	rc = flash_area_erase(fap, 0, fap->fa_size);
+	flash_area_close(fap);
+	zassert_equal(rc, 0, "erasing area failed %d", rc);
+}
+
+ZTEST(fcb_bench, test_fcb)
+{
+	struct fcb_entry loc;
+	uint32_t cycles;
+	int count;
+	int rc;
+
+	bench_fcb_erase();
+
+	rc = bench_fcb_init();
+	zassert_equal(rc, 0, "fcb init failed %d", rc);
+	rc = fill();
+	zassert_equal(rc, 0, "fcb fill failed %d", rc);
+
+	cycles = k_cycle_get_32();
+	rc = bench_fcb_init();
+	cycles = k_cycle_get_32() - cycles;
+	zassert_equal(rc, 0, "fcb init failed %d", rc);
+	report("init", N_ELEMS, "elements", cycles);
+
+	count = 0;
+	cycles = k_cycle_get_32();
+	rc = fcb_walk(&fcb, NULL, record_cb, &count);
+	cycles = k_cycle_get_32() - cycles;
+	zassert_equal(rc, 0, "fcb walk failed %d", rc);
+	zassert_equal(count, N_ELEMS, "walked %d elements", count);
+	report("forward walk", count, "elements", cycles);
+
+	count = 0;
+	loc.fe_sector = NULL;
+	cycles = k_cycle_get_32();
+	while ((count < N_ELEMS) && (fcb_getprev(&fcb, &loc) == 0) &&
+	       same_entry(&loc, &locs[N_ELEMS - 1 - count])) {
+		count++;
+	}
+	cycles = k_cycle_get_32() - cycles;
+	zassert_equal(count, N_ELEMS, "reverse walk diverged after %d elements",
+		      count);
+	zassert_equal(fcb_getprev(&fcb, &loc), -ENOTSUP,
+		      "reverse walk went past the oldest element");
+	report("reverse walk", count, "elements", cycles);
+
+	for (int i = 0; i < N_ELEMS; i++) {
+		zassert_equal(locs[i].fe_data_len, ELEM_LEN,
+			      "element %d has length %u", i,
+			      locs[i].fe_data_len);
+		rc = flash_area_read(fcb.fap, FCB_ENTRY_FA_DATA_OFF(locs[i]),
+				     elem, sizeof(elem));
+		zassert_equal(rc, 0, "reading element %d failed %d", i, rc);
+		for (int j = 0; j < ELEM_LEN; j++) {
+			zassert_equal(elem[j], (uint8_t)i,
+				      "element %d corrupted", i);
+		}
+	}
+}
+
+ZTEST(fcb_bench, test_settings)
+{
+	char name[SETTINGS_MAX_NAME_LEN];
+	uint32_t cycles;
+	uint32_t value;
+	int rc;
+
+	rc = settings_subsys_init();
+	zassert_equal(rc, 0, "settings init failed %d", rc);
+
+	cycles = k_cycle_get_32();
+	for (int i = 0; i < N_SAVES; i++) {
+		for (int j = 0; j < N_KEYS; j++) {
+			snprintf(name, sizeof(name), "bench/key%02d", j);
+			value = i * N_KEYS + j;
+			rc = settings_save_one(name, &value, sizeof(value));
+			zassert_equal(rc, 0, "saving %s failed %d", name, rc);
+		}
+	}
+	cycles = k_cycle_get_32() - cycles;
+	report("settings save", N_SAVES * N_KEYS, "entries", cycles);
+
+	n_loaded = 0;
+	n_bad = 0;
+	memset(seen, 0, sizeof(seen));
+	cycles = k_cycle_get_32();
+	rc = settings_load_subtree("bench");
+	cycles = k_cycle_get_32() - cycles;
+	zassert_equal(rc, 0, "settings load failed %d", rc);
+	zassert_equal(n_bad, 0, "%d settings duplicated or stale", n_bad);
+	zassert_equal(n_loaded, N_KEYS, "loaded %d of %d settings", n_loaded,
+		      N_KEYS);
+	report("settings load", n_loaded, "entries", cycles);
+}
+
+static void *fcb_bench_setup(void)
+{
+	TC_PRINT("fcb benchmark: element index %s\n",
+		 IS_ENABLED(CONFIG_FCB_INDEX) ? "on" : "off");
+
+	return NULL;
+}
+
+ZTEST_SUITE(fcb_bench, NULL, fcb_bench_setup, NULL, NULL, NULL);
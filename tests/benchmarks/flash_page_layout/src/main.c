@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/ztest.h>
+
+/* This is a flash page query benchmark. A flash device with a large
+ * non-uniform page layout and the flash simulator are queried for pages at
+ * pseudo-random offsets and indexes, and the average number of cycles per
+ * query is reported.
+ *
+ * The answers are checked against a walk of the layout first, and every
+ * timed query must return the page holding the offset or index asked for.
+ */
+
+#define N_RUNS    256
+#define N_QUERIES 10000
+#define N_SECTORS 128
+
+static struct flash_pages_layout big_layout[N_RUNS];
+static size_t big_size;
+static size_t big_count;
+
+static void big_page_layout(const struct device *dev,
+			    const struct flash_pages_layout **layout,
+			    size_t *layout_size)
+{
+	*layout = big_layout;
+	*layout_size = ARRAY_SIZE(big_layout);
+}
+
+static const struct flash_driver_api big_api = {
+	.page_layout = big_page_layout,
+};
+
+DEVICE_DEFINE(big_flash, "big_flash", NULL, NULL, NULL, NULL, POST_KERNEL,
+	      CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &big_api);
+
+static const struct device *const sim_dev =
+	DEVICE_DT_GET(DT_CHOSEN(zephyr_flash_controller));
+
+static struct flash_sector sectors[N_SECTORS];
+static uint32_t seed;
+
+static uint32_t next_random(void)
+{
+	seed = seed * 1103515245U + 12345U;
+
+	return seed >> 8;
+}
+
+static void big_layout_init(void)
+{
+	for (int i = 0; i < N_RUNS; i++) {
+		big_layout[i].pages_count = 1 + (i % 4);
+		big_layout[i].pages_size = 1024 << (i % 3);
+		big_size += big_layout[i].pages_count * big_layout[i].pages_size;
+		big_count += big_layout[i].pages_count;
+	}
+}
+
+static bool check_failed;
+
+static bool check_page_cb(const struct flash_pages_info *info, void *data)
+{
+	const struct device *dev = data;
+	struct flash_pages_info by_offs, by_idx;
+	off_t last = info->start_offset + info->size - 1;
+
+	if (flash_get_page_info_by_offs(dev, last, &by_offs) ||
+	    flash_get_page_info_by_idx(dev, info->index, &by_idx) ||
+	    by_offs.start_offset != info->start_offset ||
+	    by_offs.size != info->size || by_offs.index != info->index ||
+	    by_idx.start_offset != info->start_offset ||
+	    by_idx.size != info->size) {
+		check_failed = true;
+		return false;
+	}
+
+	return true;
+}
+
+/* Check the queries against a walk of the layout */
+static void check(const char *name, const struct device *dev, off_t size,
+		  size_t count)
+{
+	struct flash_pages_info info;
+
+	check_failed = false;
+	flash_page_foreach(dev, check_page_cb, (void *)dev);
+
+	zassert_false(check_failed, "%s: queries do not match the layout",
+		      name);
+	zassert_equal(flash_get_page_count(dev), count, "%s: wrong page count",
+		      name);
+	zassert_equal(flash_get_page_info_by_offs(dev, size, &info), -EINVAL,
+		      "%s: found a page past the end", name);
+	zassert_equal(flash_get_page_info_by_idx(dev, count, &info), -EINVAL,
+		      "%s: found a page past the end", name);
+}
+
+static void run_queries(const char *name, const struct device *dev,
+			off_t size, size_t count)
+{
+	struct flash_pages_info info;
+	uint32_t cycles;
+	uint32_t misses;
+	off_t offs;
+	uint32_t idx;
+
+	check(name, dev, size, count);
+
+	misses = 0;
+	seed = 1U;
+	cycles = k_cycle_get_32();
+	for (int i = 0; i < N_QUERIES; i++) {
+		offs = next_random() % size;
+		if (flash_get_page_info_by_offs(dev, offs, &info) ||
+		    (offs < info.start_offset) ||
+		    (offs >= info.start_offset + info.size)) {
+			misses++;
+		}
+	}
+	cycles = k_cycle_get_32() - cycles;
+	zassert_equal(misses, 0, "%s: %u offsets not found", name, misses);
+	TC_PRINT("%s by offset cycles/op %u\n", name, cycles / N_QUERIES);
+
+	misses = 0;
+	seed = 1U;
+	cycles = k_cycle_get_32();
+	for (int i = 0; i < N_QUERIES; i++) {
+		idx = next_random() % count;
+		if (flash_get_page_info_by_idx(dev, idx, &info) ||
+		    (info.index != idx)) {
+			misses++;
+		}
+	}
+	cycles = k_cycle_get_32() - cycles;
+	zassert_equal(misses, 0, "%s: %u indexes not found", name, misses);
+	TC_PRINT("%s by index cycles/op %u\n", name, cycles / N_QUERIES);
+}
+
+ZTEST(flash_page_layout_bench, test_non_uniform)
+{
+	run_queries("non-uniform", DEVICE_GET(big_flash), big_size, big_count);
+}
+
+ZTEST(flash_page_layout_bench, test_simulator)
+{
+	struct flash_pages_info info;
+	size_t sim_count;
+	off_t sim_size;
+
+	sim_count = flash_get_page_count(sim_dev);
+	zassert_equal(flash_get_page_info_by_idx(sim_dev, sim_count - 1, &info),
+		      0, "last page not found");
+	sim_size = info.start_offset + info.size;
+
+	run_queries("simulator", sim_dev, sim_size, sim_count);
+}
+
+ZTEST(flash_page_layout_bench, test_area_sectors)
+{
+	uint32_t cycles;
+	uint32_t cnt;
+	size_t total;
+	int rc;
+
+	cycles = k_cycle_get_32();
+	for (int i = 0; i < N_QUERIES / 100; i++) {
+		cnt = ARRAY_SIZE(sectors);
+		rc = flash_area_get_sectors(FIXED_PARTITION_ID(slot1_partition),
+					    &cnt, sectors);
+		zassert_equal(rc, 0, "area sectors failed %d", rc);
+	}
+	cycles = k_cycle_get_32() - cycles;
+
+	/* The sectors must tile the partition */
+	total = 0;
+	for (uint32_t i = 0; i < cnt; i++) {
+		zassert_equal(sectors[i].fs_off, total, "gap before sector %u",
+			      i);
+		total += sectors[i].fs_size;
+	}
+	zassert_equal(total, FIXED_PARTITION_SIZE(slot1_partition),
+		      "sectors do not cover the partition");
+
+	TC_PRINT("area sectors %u cycles/op %u\n", cnt,
+		 cycles / (N_QUERIES / 100));
+}
+
+static void *flash_page_layout_bench_setup(void)
+{
+	big_layout_init();
+
+	TC_PRINT("flash page layout benchmark: layout index %s\n",
+		 IS_ENABLED(CONFIG_FLASH_PAGE_LAYOUT_INDEX) ? "on" : "off");
+
+	return NULL;
+}
+
+ZTEST_SUITE(flash_page_layout_bench, NULL, flash_page_layout_bench_setup, NULL,
+	    NULL, NULL);
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/stats/stats.h>
+#include <ff.h>
+
+/* This is a flash disk write benchmark. Files are written to a FAT file
+ * system on a flash disk backed by the flash simulator, and the write
+ * throughput and the number of flash page erases are reported for each
+ * run. Closing a file syncs the disk, so its cost is included.
+ *
+ * Every chunk is filled with a byte derived from its file and position.
+ * After each run the file system is remounted and the files are read back
+ * and checked, so a page the flash disk cache lost fails the test.
+ */
+
+#define MNT_POINT   "/NAND:"
+#define BIG_SIZE    (128 * 1024)
+#define BIG_CHUNK   4096
+#define N_FILES     32
+#define FILE_SIZE   2048
+#define FILE_CHUNK  512
+
+static FATFS fat_fs;
+static struct fs_mount_t mnt = {
+	.type = FS_FATFS,
+	.fs_data = &fat_fs,
+	.mnt_point = MNT_POINT,
+};
+
+static uint8_t buf[BIG_CHUNK];
+
+static int erase_count_cb(struct stats_hdr *hdr, void *arg, const char *name,
+			  uint16_t off)
+{
+	if (strcmp(name, "flash_erase_calls") == 0) {
+		*(uint32_t *)arg = *(uint32_t *)((uint8_t *)hdr + off);
+		return 1;
+	}
+
+	return 0;
+}
+
+static uint32_t erase_count(void)
+{
+	struct stats_hdr *hdr = stats_group_find("flash_sim_stats");
+	uint32_t count = 0;
+
+	if (hdr) {
+		(void)stats_walk(hdr, erase_count_cb, &count);
+	}
+
+	return count;
+}
+
+static uint8_t chunk_byte(int seed, size_t done, size_t chunk)
+{
+	return (uint8_t)(seed + (done / chunk));
+}
+
+static int write_file(const char *path, int seed, size_t size, size_t chunk)
+{
+	struct fs_file_t file;
+	int rc;
+
+	fs_file_t_init(&file);
+	rc = fs_open(&file, path, FS_O_CREATE | FS_O_WRITE);
+	if (rc) {
+		return rc;
+	}
+
+	for (size_t done = 0; done < size; done += chunk) {
+		memset(buf, chunk_byte(seed, done, chunk), chunk);
+		rc = fs_write(&file, buf, chunk);
+		if (rc != (int)chunk) {
+			(void)fs_close(&file);
+			return (rc < 0) ? rc : -ENOSPC;
+		}
+	}
+
+	return fs_close(&file);
+}
+
+static void check_file(const char *path, int seed, size_t size, size_t chunk)
+{
+	struct fs_file_t file;
+	int rc;
+
+	fs_file_t_init(&file);
+	rc = fs_open(&file, path, FS_O_READ);
+	zassert_equal(rc, 0, "opening %s failed %d", path, rc);
+
+	for (size_t done = 0; done < size; done += chunk) {
+		rc = fs_read(&file, buf, chunk);
+		zassert_equal(rc, (int)chunk, "reading %s failed %d", path, rc);
+		for (size_t i = 0; i < chunk; i++) {
+			zassert_equal(buf[i], chunk_byte(seed, done, chunk),
+				      "%s corrupted at %zu", path, done + i);
+		}
+	}
+
+	zassert_equal(fs_close(&file), 0, "closing %s failed", path);
+}
+
+static void remount(void)
+{
+	zassert_equal(fs_unmount(&mnt), 0, "unmount failed");
+	zassert_equal(fs_mount(&mnt), 0, "mount failed");
+}
+
+static void report(const char *name, size_t bytes, int64_t ticks,
+		   uint32_t erases)
+{
+	uint32_t us = (uint32_t)k_ticks_to_us_ceil64(ticks);
+
+	TC_PRINT("%-5s write KiB/s %6u erases %5u\n", name,
+		 (uint32_t)(((uint64_t)bytes * 1000000U / 1024U) / MAX(us, 1U)),
+		 erases);
+}
+
+ZTEST(flashdisk_bench, test_big)
+{
+	int64_t start, ticks;
+	uint32_t erases;
+	int rc;
+
+	erases = erase_count();
+	start = k_uptime_ticks();
+	rc = write_file(MNT_POINT "/big.bin", 0, BIG_SIZE, BIG_CHUNK);
+	ticks = k_uptime_ticks() - start;
+	zassert_equal(rc, 0, "write failed %d", rc);
+
+	report("big", BIG_SIZE, ticks, erase_count() - erases);
+
+	remount();
+	check_file(MNT_POINT "/big.bin", 0, BIG_SIZE, BIG_CHUNK);
+}
+
+ZTEST(flashdisk_bench, test_files)
+{
+	char path[32];
+	int64_t start, ticks;
+	uint32_t erases;
+	int rc;
+
+	erases = erase_count();
+	start = k_uptime_ticks();
+	for (int i = 0; i < N_FILES; i++) {
+		snprintf(path, sizeof(path), MNT_POINT "/file%02d.bin", i);
+		rc = write_file(path, i, FILE_SIZE, FILE_CHUNK);
+		zassert_equal(rc, 0, "writing %s failed %d", path, rc);
+	}
+	ticks = k_uptime_ticks() - start;
+
+	report("files", N_FILES * FILE_SIZE, ticks, erase_count() - erases);
+
+	remount();
+	for (int i = 0; i < N_FILES; i++) {
+		snprintf(path, sizeof(path), MNT_POINT "/file%02d.bin", i);
+		check_file(path, i, FILE_SIZE, FILE_CHUNK);
+	}
+}
+
+static void *flashdisk_bench_setup(void)
+{
+	zassume_equal(fs_mount(&mnt), 0, "mount failed");
+
+	TC_PRINT("flash disk benchmark: %u cached pages\n",
+		 CONFIG_FLASHDISK_CACHE_PAGES);
+
+	return NULL;
+}
+
+ZTEST_SUITE(flashdisk_bench, NULL, flashdisk_bench_setup, NULL, NULL, NULL);
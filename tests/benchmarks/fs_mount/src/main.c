@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/fs/littlefs.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/ztest.h>
+
+/* This is a file system path lookup benchmark. A littlefs file system is
+ * mounted on each of several flash partitions, and as many threads, time
+ * sliced, each stat and open a file on their own mount point. The number
+ * of operations per second of all threads is reported, as well as for
+ * paths that match no mount point, which only take the lookup of the
+ * mount point.
+ *
+ * The file on mount point n is 16 + n bytes of value n, so each stat and
+ * open checks that the path was resolved to the right file system.
+ */
+
+#define N_MOUNTS   4
+#define N_OPS      2000
+#define STACK_SIZE 2048
+#define PRIORITY   1
+
+#define LFS_MOUNT(n)							\
+	FS_LITTLEFS_DECLARE_DEFAULT_CONFIG(lfs_data##n);		\
+	static struct fs_mount_t lfs_mnt##n = {				\
+		.type = FS_LITTLEFS,					\
+		.fs_data = &lfs_data##n,				\
+		.storage_dev = (void *)FIXED_PARTITION_ID(lfs##n##_partition), \
+		.mnt_point = "/lfs" #n,					\
+	}
+
+LFS_MOUNT(0);
+LFS_MOUNT(1);
+LFS_MOUNT(2);
+LFS_MOUNT(3);
+
+static struct fs_mount_t *const mounts[N_MOUNTS] = {
+	&lfs_mnt0, &lfs_mnt1, &lfs_mnt2, &lfs_mnt3,
+};
+
+enum op {
+	OP_STAT,
+	OP_OPEN,
+	OP_LOOKUP,
+};
+
+static const char *const op_names[] = {
+	[OP_STAT] = "stat",
+	[OP_OPEN] = "open",
+	[OP_LOOKUP] = "lookup",
+};
+
+K_THREAD_STACK_ARRAY_DEFINE(stacks, N_MOUNTS, STACK_SIZE);
+static struct k_thread threads[N_MOUNTS];
+static int results[N_MOUNTS];
+
+static size_t file_size(int n)
+{
+	return 16 + n;
+}
+
+static int run_ops(int n, const char *path, enum op op)
+{
+	struct fs_dirent entry;
+	struct fs_file_t file;
+	uint8_t data;
+	int rc = 0;
+
+	for (int i = 0; (i < N_OPS) && (rc == 0); i++) {
+		switch (op) {
+		case OP_STAT:
+			rc = fs_stat(path, &entry);
+			if ((rc == 0) && (entry.size != file_size(n))) {
+				rc = -EXDEV;
+			}
+			break;
+		case OP_OPEN:
+			fs_file_t_init(&file);
+			rc = fs_open(&file, path, FS_O_READ);
+			if (rc == 0) {
+				if ((fs_read(&file, &data, 1) != 1) ||
+				    (data != n)) {
+					rc = -EXDEV;
+				}
+				(void)fs_close(&file);
+			}
+			break;
+		case OP_LOOKUP:
+			rc = (fs_stat(path, &entry) == -ENOENT) ? 0 : -EINVAL;
+			break;
+		}
+	}
+
+	return rc;
+}
+
+static void thread_entry(void *p1, void *p2, void *p3)
+{
+	int n = POINTER_TO_INT(p1);
+	enum op op = POINTER_TO_INT(p2);
+	char path[32];
+
+	snprintf(path, sizeof(path), "%s%s/file", (op == OP_LOOKUP) ? "/x" : "",
+		 mounts[n]->mnt_point);
+
+	results[n] = run_ops(n, path, op);
+}
+
+static void run(enum op op)
+{
+	int64_t start, ticks;
+	uint32_t us;
+
+	start = k_uptime_ticks();
+	for (int n = 0; n < N_MOUNTS; n++) {
+		k_thread_create(&threads[n], stacks[n], STACK_SIZE,
+				thread_entry, INT_TO_POINTER(n),
+				INT_TO_POINTER(op), NULL, PRIORITY, 0,
+				K_NO_WAIT);
+	}
+	for (int n = 0; n < N_MOUNTS; n++) {
+		(void)k_thread_join(&threads[n], K_FOREVER);
+	}
+	ticks = k_uptime_ticks() - start;
+	us = (uint32_t)k_ticks_to_us_ceil64(ticks);
+
+	for (int n = 0; n < N_MOUNTS; n++) {
+		zassert_equal(results[n], 0, "%s on %s failed %d", op_names[op],
+			      mounts[n]->mnt_point, results[n]);
+	}
+
+	TC_PRINT("threads %d mounts %d %s ops/s %u\n", N_MOUNTS, N_MOUNTS,
+		 op_names[op],
+		 (uint32_t)((uint64_t)N_MOUNTS * N_OPS * 1000000U / MAX(us, 1U)));
+}
+
+ZTEST(fs_mount_bench, test_stat)
+{
+	run(OP_STAT);
+}
+
+ZTEST(fs_mount_bench, test_open)
+{
+	run(OP_OPEN);
+}
+
+ZTEST(fs_mount_bench, test_lookup)
+{
+	run(OP_LOOKUP);
+}
+
+static void *fs_mount_bench_setup(void)
+{
+	struct fs_file_t file;
+	uint8_t data[16 + N_MOUNTS];
+	char path[32];
+	int rc;
+
+	for (int n = 0; n < N_MOUNTS; n++) {
+		rc = fs_mount(mounts[n]);
+		zassume_equal(rc, 0, "mounting %s failed %d",
+			      mounts[n]->mnt_point, rc);
+
+		snprintf(path, sizeof(path), "%s/file", mounts[n]->mnt_point);
+		memset(data, n, sizeof(data));
+		fs_file_t_init(&file);
+		rc = fs_open(&file, path, FS_O_CREATE | FS_O_WRITE);
+		zassume_equal(rc, 0, "creating %s failed %d", path, rc);
+		rc = fs_write(&file, data, file_size(n));
+		(void)fs_close(&file);
+		zassume_equal(rc, file_size(n), "writing %s failed %d", path,
+			      rc);
+	}
+
+	TC_PRINT("fs mount benchmark: mount index %s\n",
+		 IS_ENABLED(CONFIG_FILE_SYSTEM_MOUNT_INDEX) ? "on" : "off");
+
+	return NULL;
+}
+
+ZTEST_SUITE(fs_mount_bench, NULL, fs_mount_bench_setup, NULL, NULL, NULL);
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/fs/fs_rtio.h>
+#include <zephyr/fs/littlefs.h>
+#include <zephyr/rtio/rtio_executor_simple.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/ztest.h>
+
+/* This is a data logging benchmark. Small records are appended to a file
+ * on a littlefs file system, with fs_write(), then through a file I/O
+ * device without and with batching, and the write throughput of each run
+ * is reported, the final sync included.
+ *
+ * Each record holds its sequence number, and the file is read back after
+ * every run to check that all records were written once and in order.
+ */
+
+#define MNT_POINT  "/lfs"
+#define LOG_FILE   MNT_POINT "/log.bin"
+#define N_RECORDS  4096
+#define RECORD_LEN 32
+#define QUEUE_LEN  16
+#define BATCH_SIZE 4096
+
+FS_LITTLEFS_DECLARE_DEFAULT_CONFIG(lfs_data);
+static struct fs_mount_t lfs_mnt = {
+	.type = FS_LITTLEFS,
+	.fs_data = &lfs_data,
+	.storage_dev = (void *)FIXED_PARTITION_ID(bench_partition),
+	.mnt_point = MNT_POINT,
+};
+
+FS_RTIO_FILE_DEFINE(direct_file, QUEUE_LEN, 0);
+FS_RTIO_FILE_DEFINE(batched_file, QUEUE_LEN, BATCH_SIZE);
+
+RTIO_EXECUTOR_SIMPLE_DEFINE(simple_exec);
+RTIO_DEFINE(r, (struct rtio_executor *)&simple_exec, QUEUE_LEN, QUEUE_LEN);
+
+/* A record buffer is reused once the write of its previous record has
+ * completed.
+ */
+static uint8_t records[QUEUE_LEN][RECORD_LEN];
+
+static void record_fill(uint8_t *record, uint32_t seq)
+{
+	memset(record, (uint8_t)seq, RECORD_LEN);
+	memcpy(record, &seq, sizeof(seq));
+}
+
+static void report(const char *name, int64_t ticks)
+{
+	uint32_t us = (uint32_t)k_ticks_to_us_ceil64(ticks);
+
+	TC_PRINT("%-5s write KiB/s %6u\n", name,
+		 (uint32_t)(((uint64_t)N_RECORDS * RECORD_LEN * 1000000U /
+			     1024U) / MAX(us, 1U)));
+}
+
+static void check_log(void)
+{
+	uint8_t expected[RECORD_LEN];
+	uint8_t record[RECORD_LEN];
+	struct fs_file_t file;
+	ssize_t rd;
+	int rc;
+
+	fs_file_t_init(&file);
+	rc = fs_open(&file, LOG_FILE, FS_O_READ);
+	zassert_equal(rc, 0, "opening log failed %d", rc);
+
+	for (uint32_t i = 0; i < N_RECORDS; i++) {
+		rd = fs_read(&file, record, RECORD_LEN);
+		zassert_equal(rd, RECORD_LEN, "record %u missing", i);
+		record_fill(expected, i);
+		zassert_mem_equal(record, expected, RECORD_LEN,
+				  "record %u corrupted", i);
+	}
+
+	rd = fs_read(&file, record, RECORD_LEN);
+	zassert_equal(rd, 0, "log longer than %u records", N_RECORDS);
+
+	(void)fs_close(&file);
+}
+
+static int run_sync(void)
+{
+	struct fs_file_t file;
+	int64_t start;
+	ssize_t wr;
+	int rc;
+
+	(void)fs_unlink(LOG_FILE);
+	fs_file_t_init(&file);
+	rc = fs_open(&file, LOG_FILE, FS_O_CREATE | FS_O_WRITE);
+	if (rc) {
+		return rc;
+	}
+
+	start = k_uptime_ticks();
+	for (uint32_t i = 0; i < N_RECORDS; i++) {
+		record_fill(records[0], i);
+		wr = fs_write(&file, records[0], RECORD_LEN);
+		if (wr != RECORD_LEN) {
+			(void)fs_close(&file);
+			return (wr < 0) ? wr : -ENOSPC;
+		}
+	}
+	rc = fs_sync(&file);
+	report("sync", k_uptime_ticks() - start);
+
+	(void)fs_close(&file);
+
+	return rc;
+}
+
+static int wait_completion(void)
+{
+	struct rtio_cqe *cqe = rtio_cqe_consume_block(&r);
+	int rc = cqe->result;
+
+	rtio_cqe_release_all(&r);
+
+	return (rc < 0) ? rc : 0;
+}
+
+static int run_rtio(const char *name, const struct rtio_iodev *iodev)
+{
+	struct rtio_sqe *sqe;
+	int in_flight = 0;
+	int64_t start;
+	int rc;
+
+	(void)fs_unlink(LOG_FILE);
+	rc = fs_rtio_open(iodev, LOG_FILE, FS_O_CREATE | FS_O_WRITE);
+	if (rc) {
+		return rc;
+	}
+
+	start = k_uptime_ticks();
+	for (uint32_t i = 0; (i < N_RECORDS) && (rc == 0); i++) {
+		if (in_flight == QUEUE_LEN) {
+			rc = wait_completion();
+			in_flight--;
+		}
+
+		record_fill(records[i % QUEUE_LEN], i);
+		sqe = rtio_sqe_acquire(&r);
+		rtio_sqe_prep_write(sqe, iodev, RTIO_PRIO_NORM,
+				    records[i % QUEUE_LEN], RECORD_LEN, NULL);
+		(void)fs_rtio_submit(&r, 0);
+		in_flight++;
+	}
+
+	if (in_flight == QUEUE_LEN) {
+		int err = wait_completion();
+
+		rc = (rc == 0) ? err : rc;
+		in_flight--;
+	}
+
+	sqe = rtio_sqe_acquire(&r);
+	fs_rtio_sqe_prep_sync(sqe, iodev, NULL);
+	(void)fs_rtio_submit(&r, 0);
+	in_flight++;
+
+	while (in_flight-- > 0) {
+		int err = wait_completion();
+
+		rc = (rc == 0) ? err : rc;
+	}
+	report(name, k_uptime_ticks() - start);
+
+	(void)fs_rtio_close(iodev);
+
+	return rc;
+}
+
+ZTEST(fs_rtio_bench, test_sync)
+{
+	int rc = run_sync();
+
+	zassert_equal(rc, 0, "write failed %d", rc);
+	check_log();
+}
+
+ZTEST(fs_rtio_bench, test_rtio)
+{
+	int rc = run_rtio("rtio", &direct_file);
+
+	zassert_equal(rc, 0, "write failed %d", rc);
+	check_log();
+}
+
+ZTEST(fs_rtio_bench, test_rtio_batch)
+{
+	int rc = run_rtio("batch", &batched_file);
+
+	zassert_equal(rc, 0, "write failed %d", rc);
+	check_log();
+}
+
+static void *fs_rtio_bench_setup(void)
+{
+	int rc = fs_mount(&lfs_mnt);
+
+	zassume_equal(rc, 0, "mount failed %d", rc);
+
+	TC_PRINT("fs rtio benchmark: %u records of %u bytes\n", N_RECORDS,
+		 RECORD_LEN);
+
+	return NULL;
+}
+
+ZTEST_SUITE(fs_rtio_bench, NULL, fs_rtio_bench_setup, NULL, NULL, NULL);
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/mutex.h>
+#include <zephyr/sys/sem.h>
+
+/* This is a user mode synchronization benchmark. Each measurement runs one
+ * or two user threads doing N_RUNS operations, and the test thread reports
+ * the average number of cycles per operation around the whole run, since
+ * user threads cannot read the cycle counter on every platform.
+ *
+ * The user threads count the operations that failed, and the test fails
+ * unless all of them succeeded and the objects are left as they started.
+ */
+
+#define N_RUNS     10000
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define PRIORITY   K_PRIO_PREEMPT(1)
+
+ZTEST_BMEM SYS_MUTEX_DEFINE(sys_mutex);
+ZTEST_DMEM SYS_SEM_DEFINE(sys_sem, 0, 1);
+ZTEST_DMEM SYS_SEM_DEFINE(sys_ping, 0, 1);
+ZTEST_DMEM SYS_SEM_DEFINE(sys_pong, 0, 1);
+
+static K_MUTEX_DEFINE(kernel_mutex);
+static K_SEM_DEFINE(kernel_sem, 0, 1);
+static K_SEM_DEFINE(kernel_ping, 0, 1);
+static K_SEM_DEFINE(kernel_pong, 0, 1);
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, 2, STACK_SIZE);
+static struct k_thread threads[2];
+
+ZTEST_BMEM static atomic_t errors;
+
+static void check(int ret)
+{
+	if (ret != 0) {
+		atomic_inc(&errors);
+	}
+}
+
+static void sys_mutex_loop(void *p1, void *p2, void *p3)
+{
+	for (int i = 0; i < N_RUNS; i++) {
+		check(sys_mutex_lock(&sys_mutex, K_FOREVER));
+		check(sys_mutex_unlock(&sys_mutex));
+	}
+}
+
+static void k_mutex_loop(void *p1, void *p2, void *p3)
+{
+	for (int i = 0; i < N_RUNS; i++) {
+		check(k_mutex_lock(&kernel_mutex, K_FOREVER));
+		check(k_mutex_unlock(&kernel_mutex));
+	}
+}
+
+static void sys_sem_loop(void *p1, void *p2, void *p3)
+{
+	for (int i = 0; i < N_RUNS; i++) {
+		check(sys_sem_give(&sys_sem));
+		check(sys_sem_take(&sys_sem, K_FOREVER));
+	}
+}
+
+static void k_sem_loop(void *p1, void *p2, void *p3)
+{
+	for (int i = 0; i < N_RUNS; i++) {
+		k_sem_give(&kernel_sem);
+		check(k_sem_take(&kernel_sem, K_FOREVER));
+	}
+}
+
+static void sys_sem_ping(void *p1, void *p2, void *p3)
+{
+	for (int i = 0; i < N_RUNS; i++) {
+		check(sys_sem_give(&sys_ping));
+		check(sys_sem_take(&sys_pong, K_FOREVER));
+	}
+}
+
+static void sys_sem_pong(void *p1, void *p2, void *p3)
+{
+	for (int i = 0; i < N_RUNS; i++) {
+		check(sys_sem_take(&sys_ping, K_FOREVER));
+		check(sys_sem_give(&sys_pong));
+	}
+}
+
+static void k_sem_ping(void *p1, void *p2, void *p3)
+{
+	for (int i = 0; i < N_RUNS; i++) {
+		k_sem_give(&kernel_ping);
+		check(k_sem_take(&kernel_pong, K_FOREVER));
+	}
+}
+
+static void k_sem_pong(void *p1, void *p2, void *p3)
+{
+	for (int i = 0; i < N_RUNS; i++) {
+		check(k_sem_take(&kernel_ping, K_FOREVER));
+		k_sem_give(&kernel_pong);
+	}
+}
+
+static void run(const char *name, k_thread_entry_t first,
+		k_thread_entry_t second)
+{
+	int num_threads = (second != NULL) ? 2 : 1;
+	k_thread_entry_t entries[] = { first, second };
+	uint32_t cycles;
+
+	atomic_clear(&errors);
+
+	for (int i = 0; i < num_threads; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE,
+				entries[i], NULL, NULL, NULL, PRIORITY,
+				K_USER | K_INHERIT_PERMS, K_FOREVER);
+	}
+
+	cycles = k_cycle_get_32();
+	for (int i = 0; i < num_threads; i++) {
+		k_thread_start(&threads[i]);
+	}
+	for (int i = 0; i < num_threads; i++) {
+		zassert_equal(k_thread_join(&threads[i], K_SECONDS(60)), 0,
+			      "%s did not finish", name);
+	}
+	cycles = k_cycle_get_32() - cycles;
+
+	zassert_equal(atomic_get(&errors), 0, "%s: %ld operations failed",
+		      name, atomic_get(&errors));
+
+	TC_PRINT("%s cycles/op %u\n", name, cycles / N_RUNS);
+}
+
+ZTEST(futex_bench, test_mutex)
+{
+	run("sys_mutex lock/unlock", sys_mutex_loop, NULL);
+	zassert_equal(sys_mutex_lock(&sys_mutex, K_NO_WAIT), 0,
+		      "sys_mutex left locked");
+	zassert_equal(sys_mutex_unlock(&sys_mutex), 0, NULL);
+
+	run("k_mutex lock/unlock", k_mutex_loop, NULL);
+	zassert_is_null(kernel_mutex.owner, "k_mutex left locked");
+}
+
+ZTEST(futex_bench, test_sem)
+{
+	run("sys_sem give/take", sys_sem_loop, NULL);
+	zassert_equal(sys_sem_count_get(&sys_sem), 0, "sys_sem not empty");
+
+	run("k_sem give/take", k_sem_loop, NULL);
+	zassert_equal(k_sem_count_get(&kernel_sem), 0, "k_sem not empty");
+}
+
+ZTEST(futex_bench, test_ping_pong)
+{
+	run("sys_sem ping-pong", sys_sem_ping, sys_sem_pong);
+	zassert_equal(sys_sem_count_get(&sys_ping), 0, "sys_sem not empty");
+	zassert_equal(sys_sem_count_get(&sys_pong), 0, "sys_sem not empty");
+
+	run("k_sem ping-pong", k_sem_ping, k_sem_pong);
+	zassert_equal(k_sem_count_get(&kernel_ping), 0, "k_sem not empty");
+	zassert_equal(k_sem_count_get(&kernel_pong), 0, "k_sem not empty");
+}
+
+static void *futex_bench_setup(void)
+{
+	k_thread_access_grant(k_current_get(), &kernel_mutex, &kernel_sem,
+			      &kernel_ping, &kernel_pong);
+
+	TC_PRINT("futex benchmark: sys_mutex fast path %s\n",
+		 IS_ENABLED(CONFIG_SYS_MUTEX_FAST_PATH) ? "on" : "off");
+
+	return NULL;
+}
+
+ZTEST_SUITE(futex_bench, NULL, futex_bench_setup, NULL, NULL, NULL);
@@ -0,0 +1,399 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/data/json.h>
+#include <zephyr/ztest.h>
+
+/* This is a JSON parsing benchmark. Documents representative of hawkBit
+ * and LwM2M payloads, and a device configuration object, are parsed
+ * repeatedly, and the average number of cycles per parse is reported.
+ *
+ * Every parse must decode all fields of the document, and the values of
+ * the last parse are checked against the document.
+ */
+
+#define N_RUNS 1000
+
+struct href {
+	const char *href;
+};
+
+struct hashes {
+	const char *sha1;
+	const char *md5;
+	const char *sha256;
+};
+
+struct artifact_links {
+	struct href download_http;
+	struct href md5sum_http;
+};
+
+struct artifact {
+	const char *filename;
+	struct hashes hashes;
+	struct artifact_links _links;
+	int size;
+};
+
+struct chunk {
+	const char *part;
+	const char *name;
+	const char *version;
+	struct artifact artifacts[1];
+	size_t num_artifacts;
+};
+
+struct deployment {
+	const char *download;
+	const char *update;
+	struct chunk chunks[1];
+	size_t num_chunks;
+};
+
+struct deployment_base {
+	const char *id;
+	struct deployment deployment;
+};
+
+static const struct json_obj_descr href_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct href, href, JSON_TOK_STRING),
+};
+
+static const struct json_obj_descr hashes_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct hashes, sha1, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct hashes, md5, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct hashes, sha256, JSON_TOK_STRING),
+};
+
+static const struct json_obj_descr artifact_links_descr[] = {
+	JSON_OBJ_DESCR_OBJECT_NAMED(struct artifact_links, "download-http",
+				    download_http, href_descr),
+	JSON_OBJ_DESCR_OBJECT_NAMED(struct artifact_links, "md5sum-http",
+				    md5sum_http, href_descr),
+};
+
+static const struct json_obj_descr artifact_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct artifact, filename, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_OBJECT(struct artifact, hashes, hashes_descr),
+	JSON_OBJ_DESCR_OBJECT(struct artifact, _links, artifact_links_descr),
+	JSON_OBJ_DESCR_PRIM(struct artifact, size, JSON_TOK_NUMBER),
+};
+
+static const struct json_obj_descr chunk_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct chunk, part, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct chunk, name, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct chunk, version, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_OBJ_ARRAY(struct chunk, artifacts, 1, num_artifacts,
+				 artifact_descr, ARRAY_SIZE(artifact_descr)),
+};
+
+static const struct json_obj_descr deployment_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct deployment, download, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct deployment, update, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_OBJ_ARRAY(struct deployment, chunks, 1, num_chunks,
+				 chunk_descr, ARRAY_SIZE(chunk_descr)),
+};
+
+static const struct json_obj_descr deployment_base_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct deployment_base, id, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_OBJECT(struct deployment_base, deployment,
+			      deployment_descr),
+};
+
+static const char deployment_base_doc[] =
+	"{\"id\":\"17\",\"deployment\":{\"download\":\"forced\","
+	"\"update\":\"forced\",\"chunks\":[{\"part\":\"bApp\","
+	"\"version\":\"1.0.1\",\"name\":\"zephyr-app\",\"artifacts\":[{"
+	"\"filename\":\"zephyr.signed.bin\",\"hashes\":{"
+	"\"sha1\":\"a9993e364706816aba3e25717850c26c9cd0d89d\","
+	"\"md5\":\"900150983cd24fb0d6963f7d28e17f72\","
+	"\"sha256\":\"ba7816bf8f01cfea414140de5dae2223"
+	"b00361a396177a9cb410ff61f20015ad\"},"
+	"\"size\":229376,\"_links\":{\"download-http\":{\"href\":"
+	"\"https://hawkbit.example.com/DEFAULT/controller/v1/gateway-42/"
+	"softwaremodules/23/artifacts/zephyr.signed.bin\"},"
+	"\"md5sum-http\":{\"href\":"
+	"\"https://hawkbit.example.com/DEFAULT/controller/v1/gateway-42/"
+	"softwaremodules/23/artifacts/zephyr.signed.bin.MD5SUM\"}}}]}]}}";
+
+struct record {
+	const char *n;
+	int v;
+	const char *sv;
+	bool bv;
+};
+
+struct lwm2m_doc {
+	const char *bn;
+	struct record e[16];
+	size_t num_e;
+};
+
+static const struct json_obj_descr record_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct record, n, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct record, v, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct record, sv, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct record, bv, JSON_TOK_TRUE),
+};
+
+static const struct json_obj_descr lwm2m_doc_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct lwm2m_doc, bn, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_OBJ_ARRAY(struct lwm2m_doc, e, 16, num_e, record_descr,
+				 ARRAY_SIZE(record_descr)),
+};
+
+static const char lwm2m_doc[] =
+	"{\"bn\":\"/3/0/\",\"e\":["
+	"{\"n\":\"0\",\"sv\":\"Open Mobile Alliance\"},"
+	"{\"n\":\"1\",\"sv\":\"Lightweight M2M Client\"},"
+	"{\"n\":\"2\",\"sv\":\"345000123\"},"
+	"{\"n\":\"3\",\"sv\":\"1.0\"},"
+	"{\"n\":\"6/0\",\"v\":1},"
+	"{\"n\":\"6/1\",\"v\":5},"
+	"{\"n\":\"7/0\",\"v\":3800},"
+	"{\"n\":\"7/1\",\"v\":5000},"
+	"{\"n\":\"9\",\"v\":100},"
+	"{\"n\":\"13\",\"v\":1367491215},"
+	"{\"n\":\"15\",\"bv\":true},"
+	"{\"n\":\"16\",\"sv\":\"U\"}]}";
+
+struct config {
+	const char *device_name;
+	const char *serial;
+	const char *fw_version;
+	const char *hw_revision;
+	const char *location;
+	const char *timezone;
+	const char *server_url;
+	const char *apn;
+	int poll_interval;
+	int report_interval;
+	int retry_count;
+	int retry_delay;
+	int tx_power;
+	int log_level;
+	int max_payload;
+	int battery_low;
+	int temp_offset;
+	int sample_rate;
+	bool led_enabled;
+	bool gps_enabled;
+	bool ble_enabled;
+	bool low_power;
+	bool debug;
+	bool auto_update;
+};
+
+static const struct json_obj_descr config_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct config, device_name, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct config, serial, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct config, fw_version, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct config, hw_revision, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct config, location, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct config, timezone, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct config, server_url, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct config, apn, JSON_TOK_STRING),
+	JSON_OBJ_DESCR_PRIM(struct config, poll_interval, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct config, report_interval, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct config, retry_count, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct config, retry_delay, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct config, tx_power, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct config, log_level, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct config, max_payload, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct config, battery_low, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct config, temp_offset, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct config, sample_rate, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct config, led_enabled, JSON_TOK_TRUE),
+	JSON_OBJ_DESCR_PRIM(struct config, gps_enabled, JSON_TOK_TRUE),
+	JSON_OBJ_DESCR_PRIM(struct config, ble_enabled, JSON_TOK_TRUE),
+	JSON_OBJ_DESCR_PRIM(struct config, low_power, JSON_TOK_TRUE),
+	JSON_OBJ_DESCR_PRIM(struct config, debug, JSON_TOK_TRUE),
+	JSON_OBJ_DESCR_PRIM(struct config, auto_update, JSON_TOK_TRUE),
+};
+
+/* Keys in the reverse order of the fields */
+static const char config_doc[] =
+	"{"
+	"\"auto_update\":true,"
+	"\"debug\":false,"
+	"\"low_power\":false,"
+	"\"ble_enabled\":true,"
+	"\"gps_enabled\":false,"
+	"\"led_enabled\":true,"
+	"\"sample_rate\":50,"
+	"\"temp_offset\":-12,"
+	"\"battery_low\":3300,"
+	"\"max_payload\":1024,"
+	"\"log_level\":3,"
+	"\"tx_power\":-4,"
+	"\"retry_delay\":30,"
+	"\"retry_count\":5,"
+	"\"report_interval\":3600,"
+	"\"poll_interval\":300,"
+	"\"apn\":\"iot.example\","
+	"\"server_url\":\"coaps://leshan.example.com:5684\","
+	"\"timezone\":\"Europe/Berlin\","
+	"\"location\":\"building 7, floor 2\","
+	"\"hw_revision\":\"rev-c\","
+	"\"fw_version\":\"3.2.99\","
+	"\"serial\":\"SN-000123456\","
+	"\"device_name\":\"gateway-42\"}";
+
+JSON_OBJ_KEY_TABLE_DEFINE(config_table, config_descr, 64);
+
+static char buf[1024];
+
+static union {
+	struct deployment_base deployment_base;
+	struct lwm2m_doc lwm2m;
+	struct config config;
+} out;
+
+static int parse(const char *doc, size_t len, const struct json_obj_descr *descr,
+		 size_t descr_len, const struct json_obj_key_table *table,
+		 uint32_t *cycles)
+{
+	uint32_t decoded[JSON_OBJ_DECODED_LEN(ARRAY_SIZE(config_descr))];
+	uint32_t start;
+	int ret;
+
+	/* Parsing writes to the document */
+	memcpy(buf, doc, len);
+
+	start = k_cycle_get_32();
+	if (table) {
+		ret = json_obj_parse_table(buf, len, table, &out, decoded);
+	} else {
+		ret = json_obj_parse(buf, len, descr, descr_len, &out);
+	}
+	*cycles += k_cycle_get_32() - start;
+
+	return ret;
+}
+
+static void run(const char *name, const char *doc, size_t len,
+		const struct json_obj_descr *descr, size_t descr_len,
+		const struct json_obj_key_table *table, int expected)
+{
+	uint32_t cycles = 0;
+	int ret;
+
+	BUILD_ASSERT(sizeof(config_doc) <= sizeof(buf));
+	BUILD_ASSERT(sizeof(deployment_base_doc) <= sizeof(buf));
+	BUILD_ASSERT(sizeof(lwm2m_doc) <= sizeof(buf));
+
+	for (int i = 0; i < N_RUNS; i++) {
+		memset(&out, 0, sizeof(out));
+		ret = parse(doc, len, descr, descr_len, table, &cycles);
+		zassert_equal(ret, expected, "%s parse returned %d", name, ret);
+	}
+
+	TC_PRINT("%-16s cycles/parse %u\n", name, cycles / N_RUNS);
+}
+
+static void check_config(const struct config *config)
+{
+	zassert_equal(strcmp(config->device_name, "gateway-42"), 0, NULL);
+	zassert_equal(strcmp(config->serial, "SN-000123456"), 0, NULL);
+	zassert_equal(strcmp(config->fw_version, "3.2.99"), 0, NULL);
+	zassert_equal(strcmp(config->hw_revision, "rev-c"), 0, NULL);
+	zassert_equal(strcmp(config->location, "building 7, floor 2"), 0, NULL);
+	zassert_equal(strcmp(config->timezone, "Europe/Berlin"), 0, NULL);
+	zassert_equal(strcmp(config->server_url,
+			     "coaps://leshan.example.com:5684"), 0, NULL);
+	zassert_equal(strcmp(config->apn, "iot.example"), 0, NULL);
+	zassert_equal(config->poll_interval, 300, NULL);
+	zassert_equal(config->report_interval, 3600, NULL);
+	zassert_equal(config->retry_count, 5, NULL);
+	zassert_equal(config->retry_delay, 30, NULL);
+	zassert_equal(config->tx_power, -4, NULL);
+	zassert_equal(config->log_level, 3, NULL);
+	zassert_equal(config->max_payload, 1024, NULL);
+	zassert_equal(config->battery_low, 3300, NULL);
+	zassert_equal(config->temp_offset, -12, NULL);
+	zassert_equal(config->sample_rate, 50, NULL);
+	zassert_true(config->led_enabled, NULL);
+	zassert_false(config->gps_enabled, NULL);
+	zassert_true(config->ble_enabled, NULL);
+	zassert_false(config->low_power, NULL);
+	zassert_false(config->debug, NULL);
+	zassert_true(config->auto_update, NULL);
+}
+
+ZTEST(json_bench, test_hawkbit)
+{
+	const struct deployment *deployment = &out.deployment_base.deployment;
+	const struct artifact *artifact;
+
+	run("hawkbit", deployment_base_doc, sizeof(deployment_base_doc) - 1,
+	    deployment_base_descr, ARRAY_SIZE(deployment_base_descr), NULL,
+	    BIT_MASK(ARRAY_SIZE(deployment_base_descr)));
+
+	zassert_equal(strcmp(out.deployment_base.id, "17"), 0, NULL);
+	zassert_equal(strcmp(deployment->download, "forced"), 0, NULL);
+	zassert_equal(deployment->num_chunks, 1, NULL);
+	zassert_equal(strcmp(deployment->chunks[0].version, "1.0.1"), 0, NULL);
+	zassert_equal(deployment->chunks[0].num_artifacts, 1, NULL);
+
+	artifact = &deployment->chunks[0].artifacts[0];
+	zassert_equal(strcmp(artifact->filename, "zephyr.signed.bin"), 0, NULL);
+	zassert_equal(strcmp(artifact->hashes.md5,
+			     "900150983cd24fb0d6963f7d28e17f72"), 0, NULL);
+	zassert_equal(artifact->size, 229376, NULL);
+	zassert_equal(strcmp(artifact->_links.md5sum_http.href,
+			     "https://hawkbit.example.com/DEFAULT/controller/v1/"
+			     "gateway-42/softwaremodules/23/artifacts/"
+			     "zephyr.signed.bin.MD5SUM"), 0, NULL);
+}
+
+ZTEST(json_bench, test_lwm2m)
+{
+	const struct lwm2m_doc *doc = &out.lwm2m;
+
+	run("lwm2m", lwm2m_doc, sizeof(lwm2m_doc) - 1, lwm2m_doc_descr,
+	    ARRAY_SIZE(lwm2m_doc_descr), NULL,
+	    BIT_MASK(ARRAY_SIZE(lwm2m_doc_descr)));
+
+	zassert_equal(strcmp(doc->bn, "/3/0/"), 0, NULL);
+	zassert_equal(doc->num_e, 12, NULL);
+	zassert_equal(strcmp(doc->e[0].sv, "Open Mobile Alliance"), 0, NULL);
+	zassert_equal(strcmp(doc->e[6].n, "7/0"), 0, NULL);
+	zassert_equal(doc->e[6].v, 3800, NULL);
+	zassert_equal(doc->e[9].v, 1367491215, NULL);
+	zassert_true(doc->e[10].bv, NULL);
+	zassert_equal(strcmp(doc->e[11].sv, "U"), 0, NULL);
+}
+
+ZTEST(json_bench, test_config)
+{
+	run("config", config_doc, sizeof(config_doc) - 1, config_descr,
+	    ARRAY_SIZE(config_descr), NULL,
+	    BIT_MASK(ARRAY_SIZE(config_descr)));
+
+	check_config(&out.config);
+}
+
+ZTEST(json_bench, test_config_table)
+{
+	run("config table", config_doc, sizeof(config_doc) - 1, config_descr,
+	    ARRAY_SIZE(config_descr), &config_table,
+	    ARRAY_SIZE(config_descr));
+
+	check_config(&out.config);
+}
+
+static void *json_bench_setup(void)
+{
+	zassume_equal(json_obj_key_table_init(&config_table), 0,
+		      "key table init failed");
+
+	return NULL;
+}
+
+ZTEST_SUITE(json_bench, NULL, json_bench_setup, NULL, NULL, NULL);
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/syscall_handler.h>
+
+/* Measures system call latency on a dynamically allocated semaphore, whose
+ * validation requires a dynamic kernel object lookup, as the number of live
+ * dynamic objects grows. A statically defined semaphore, found through the
+ * build time perfect hash, is measured alongside for reference.
+ *
+ * Every system call must find its semaphore, and every freed object must
+ * be gone from the lookup, otherwise the test fails.
+ */
+
+#define N_RUNS      1000
+#define STACK_SIZE  (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define MAX_OBJECTS 1024
+
+static const unsigned int object_counts[] = { 0, 16, 64, 256, MAX_OBJECTS };
+
+static K_THREAD_STACK_DEFINE(user_stack, STACK_SIZE);
+static struct k_thread user_thread;
+
+K_SEM_DEFINE(static_sem, 0, 1);
+
+static void *fillers[MAX_OBJECTS];
+static unsigned int filler_count;
+
+ZTEST_BMEM static uint32_t user_cycles;
+ZTEST_BMEM static uint32_t user_takes;
+
+/* One give and one take system call per run */
+static void user_fn(void *arg1, void *arg2, void *arg3)
+{
+	struct k_sem *sem = arg1;
+	uint32_t start;
+
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	user_takes = 0;
+
+	start = k_cycle_get_32();
+	for (int i = 0; i < N_RUNS; i++) {
+		k_sem_give(sem);
+		if (k_sem_take(sem, K_NO_WAIT) == 0) {
+			user_takes++;
+		}
+	}
+	user_cycles = k_cycle_get_32() - start;
+}
+
+static uint32_t syscall_cycles(struct k_sem *sem)
+{
+	k_thread_create(&user_thread, user_stack, STACK_SIZE, user_fn, sem,
+			NULL, NULL, K_PRIO_PREEMPT(1), K_USER,
+			K_FOREVER);
+	k_object_access_grant(sem, &user_thread);
+	k_thread_start(&user_thread);
+	k_thread_join(&user_thread, K_FOREVER);
+
+	zassert_equal(user_takes, N_RUNS, "%u of %u takes failed",
+		      N_RUNS - user_takes, N_RUNS);
+
+	return user_cycles / (2 * N_RUNS);
+}
+
+ZTEST(kobject_lookup, test_syscall_latency)
+{
+	k_thread_system_pool_assign(k_current_get());
+
+	TC_PRINT("objects  dynamic  static (cycles/syscall)\n");
+
+	for (int i = 0; i < ARRAY_SIZE(object_counts); i++) {
+		struct k_sem *sem;
+
+		while (filler_count < object_counts[i]) {
+			fillers[filler_count] = k_object_alloc(K_OBJ_SEM);
+			zassert_not_null(fillers[filler_count],
+					 "out of memory at %u objects",
+					 filler_count);
+			filler_count++;
+		}
+
+		sem = k_object_alloc(K_OBJ_SEM);
+		zassert_not_null(sem, "out of memory");
+		k_sem_init(sem, 0, 1);
+
+		TC_PRINT("%7u %8u %7u\n", object_counts[i],
+			 syscall_cycles(sem), syscall_cycles(&static_sem));
+
+		k_object_free(sem);
+		zassert_is_null(z_object_find(sem), "freed object found");
+	}
+
+	for (unsigned int i = 0; i < filler_count; i++) {
+		zassert_not_null(z_object_find(fillers[i]),
+				 "object %u not found", i);
+	}
+
+	while (filler_count > 0) {
+		k_object_free(fillers[--filler_count]);
+		zassert_is_null(z_object_find(fillers[filler_count]),
+				"freed object found");
+	}
+}
+
+ZTEST_SUITE(kobject_lookup, NULL, NULL, NULL, NULL, NULL);
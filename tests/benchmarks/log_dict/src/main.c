@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_ctrl.h>
+#include <zephyr/logging/log_output.h>
+#include <zephyr/logging/log_output_dict.h>
+#include <zephyr/ztest.h>
+
+/* This is a dictionary-based log output benchmark. A workload of log
+ * messages is processed by a backend counting the bytes output for it in
+ * the dictionary format, and the average number of bytes and cycles per
+ * message is reported.
+ *
+ * Each message output must start with the header of the format selected,
+ * carrying the level of the message, and must not be larger than in the
+ * default format.
+ */
+
+LOG_MODULE_REGISTER(app, LOG_LEVEL_DBG);
+
+#define N_ROUNDS 200
+
+/* Messages logged by workload() over N_ROUNDS */
+#define N_MSGS (4 * N_ROUNDS + N_ROUNDS / 4 + N_ROUNDS / 10 + N_ROUNDS / 16)
+
+void sensor_log(int round);
+
+static uint8_t output_buf[32];
+static uint8_t out[256];
+static size_t out_len;
+static uint32_t bytes;
+static uint32_t msgs;
+static uint32_t drops;
+static uint32_t bad;
+
+static int count(uint8_t *data, size_t length, void *ctx)
+{
+	size_t n = MIN(length, sizeof(out) - out_len);
+
+	memcpy(&out[out_len], data, n);
+	out_len += n;
+	bytes += length;
+
+	return length;
+}
+
+LOG_OUTPUT_DEFINE(bench_output, count, output_buf, sizeof(output_buf));
+
+static size_t varint_get(const uint8_t *buf, size_t *val)
+{
+	size_t len = 0;
+
+	*val = 0;
+	do {
+		*val |= (size_t)(buf[len] & 0x7f) << (7 * len);
+	} while ((buf[len++] & 0x80) != 0U);
+
+	return len;
+}
+
+static bool check_compact(const uint8_t *buf, uint8_t level, size_t data_len)
+{
+	uint8_t desc = buf[1];
+
+	if (buf[0] != MSG_NORMAL_COMPACT) {
+		return false;
+	}
+
+	return (((desc >> 3) & 0x7) == level) &&
+	       (((desc & LOG_DICT_COMPACT_HAS_DATA) != 0U) == (data_len > 0U));
+}
+
+static bool check_output(struct log_msg *msg, size_t len)
+{
+	struct log_dict_output_normal_msg_hdr_t *hdr = (void *)out;
+	uint8_t level = log_msg_get_level(msg);
+	size_t package_len;
+	size_t data_len;
+	size_t normal_len;
+	size_t compact_len;
+
+	(void)log_msg_get_package(msg, &package_len);
+	(void)log_msg_get_data(msg, &data_len);
+	normal_len = sizeof(*hdr) + package_len + data_len;
+
+	if (IS_ENABLED(CONFIG_LOG_DICTIONARY_COMPACT_COMPRESS) &&
+	    (out[0] == MSG_COMPRESSED)) {
+		/* Smaller than the compact message it holds */
+		(void)varint_get(&out[1], &compact_len);
+		return (len < compact_len) && (compact_len <= normal_len);
+	} else if (IS_ENABLED(CONFIG_LOG_DICTIONARY_COMPACT)) {
+		return check_compact(out, level, data_len) &&
+		       (len <= normal_len);
+	}
+
+	return (hdr->type == MSG_NORMAL) && (hdr->level == level) &&
+	       (len == normal_len);
+}
+
+static void process(struct log_backend const *const backend,
+		    union log_msg_generic *msg)
+{
+	uint32_t start = bytes;
+
+	msgs++;
+	out_len = 0;
+	log_dict_output_msg_process(&bench_output, &msg->log, 0);
+
+	if (!check_output(&msg->log, bytes - start)) {
+		bad++;
+	}
+}
+
+static void panic(struct log_backend const *const backend)
+{
+}
+
+static void dropped(struct log_backend const *const backend, uint32_t cnt)
+{
+	drops += cnt;
+	log_dict_output_dropped_process(&bench_output, cnt);
+}
+
+static const struct log_backend_api bench_api = {
+	.process = process,
+	.panic = panic,
+	.dropped = dropped,
+};
+
+LOG_BACKEND_DEFINE(bench_backend, bench_api, true);
+
+static void workload(int round)
+{
+	uint8_t frame[16];
+
+	for (size_t i = 0; i < sizeof(frame); i++) {
+		frame[i] = (uint8_t)(round + i * 3);
+	}
+
+	LOG_INF("rx frame %u, %u bytes, rssi %d", round, 40 + round % 20,
+		-40 - round % 30);
+	if ((round % 4) == 0) {
+		LOG_HEXDUMP_DBG(frame, sizeof(frame), "frame");
+	}
+
+	sensor_log(round);
+
+	if ((round % 16) == 15) {
+		LOG_ERR("tx timeout, retry %d", round / 16);
+	}
+
+	LOG_DBG("idle");
+}
+
+static const char *format_name(void)
+{
+	if (IS_ENABLED(CONFIG_LOG_DICTIONARY_COMPACT_COMPRESS)) {
+		return "compressed";
+	} else if (IS_ENABLED(CONFIG_LOG_DICTIONARY_COMPACT)) {
+		return "compact";
+	}
+
+	return "default";
+}
+
+ZTEST(log_dict_bench, test_workload)
+{
+	uint32_t cycles = 0;
+	uint32_t start;
+	uint32_t centi;
+
+	for (int round = 0; round < N_ROUNDS; round++) {
+		workload(round);
+
+		start = k_cycle_get_32();
+		while (log_process()) {
+		}
+		cycles += k_cycle_get_32() - start;
+
+		k_sleep(K_MSEC(1));
+	}
+
+	zassert_equal(drops, 0, "%u messages dropped", drops);
+	zassert_equal(msgs, N_MSGS, "%u messages processed", msgs);
+	zassert_equal(bad, 0, "%u messages output wrong", bad);
+
+	centi = bytes * 100U / msgs;
+	TC_PRINT("%s format: %u messages bytes/msg %u.%02u cycles/msg %u\n",
+		 format_name(), msgs, centi / 100U, centi % 100U,
+		 cycles / msgs);
+}
+
+static void *log_dict_bench_setup(void)
+{
+	const struct log_backend *uart;
+
+	/* The backend is only there for dictionary support */
+	uart = log_backend_get_by_name("log_backend_uart");
+	if (uart != NULL) {
+		log_backend_disable(uart);
+	}
+
+	/* Only count the messages of the workload */
+	while (log_process()) {
+	}
+	msgs = 0;
+	bytes = 0;
+	bad = 0;
+
+	return NULL;
+}
+
+ZTEST_SUITE(log_dict_bench, NULL, log_dict_bench_setup, NULL, NULL, NULL);
@@ -0,0 +1,24 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(sensor, LOG_LEVEL_DBG);
+
+void sensor_log(int round)
+{
+	int id = round % 4;
+
+	LOG_DBG("sensor %d: sample ready", id);
+	LOG_INF("sensor %d: temperature %d.%02d C, state %s", id,
+		20 + round % 5, (round * 7) % 100,
+		(round % 8) ? "running" : "calibrating");
+
+	if ((round % 10) == 0) {
+		LOG_WRN("sensor %d: humidity %u%% above threshold", id,
+			60U + round % 30);
+	}
+}
@@ -0,0 +1,185 @@
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_output.h>
+#include <zephyr/sys/cbprintf.h>
+#include <zephyr/ztest.h>
+
+/* This is a log formatting benchmark. Log messages are formatted by
+ * log_output to an output function that keeps the last message, and the
+ * average number of cycles and of output calls per message is reported.
+ * The last message formatted must match the expected text.
+ */
+
+#define N_MSGS 1000
+
+static uint8_t output_buf[64];
+static char msg[128];
+static size_t msg_len;
+static uint32_t writes;
+
+static int capture(uint8_t *data, size_t length, void *ctx)
+{
+	writes++;
+
+	length = MIN(length, sizeof(msg) - 1 - msg_len);
+	memcpy(&msg[msg_len], data, length);
+	msg_len += length;
+
+	return length;
+}
+
+LOG_OUTPUT_DEFINE(bench_output, capture, output_buf, sizeof(output_buf));
+
+static uint8_t package[256];
+
+static void run(const char *name, const char *source, uint8_t level,
+		uint32_t flags, const char *expected)
+{
+	const char *body;
+	uint32_t cycles;
+
+	writes = 0;
+	cycles = k_cycle_get_32();
+	for (int i = 0; i < N_MSGS; i++) {
+		msg_len = 0;
+		log_output_process(&bench_output, i, NULL, source, level,
+				   package, NULL, 0, flags);
+	}
+	cycles = k_cycle_get_32() - cycles;
+	msg[msg_len] = '\0';
+
+	TC_PRINT("%-8s cycles/msg %6u writes/msg %3u\n", name,
+		 cycles / N_MSGS, writes / N_MSGS);
+
+	/* Skip the timestamp, which depends on the timestamp frequency */
+	body = msg;
+	if (flags & LOG_OUTPUT_FLAG_TIMESTAMP) {
+		body = strstr(msg, "] ");
+		zassert_not_null(body, "no timestamp in \"%s\"", msg);
+		body += 2;
+	}
+
+	zassert_equal(strcmp(body, expected), 0, "%s output \"%s\"", name, msg);
+}
+
+#define BENCH_FLAGS (LOG_OUTPUT_FLAG_LEVEL | LOG_OUTPUT_FLAG_TIMESTAMP | \
+	       LOG_OUTPUT_FLAG_FORMAT_TIMESTAMP | LOG_OUTPUT_FLAG_CRLF_LFONLY)
+
+ZTEST(log_output_bench, test_text)
+{
+	int rc;
+
+	rc = cbprintf_package(package, sizeof(package), 0,
+			      "connection established with the server");
+	zassert_true(rc > 0, "package failed %d", rc);
+
+	run("text", "net_mgmt", LOG_LEVEL_INF, BENCH_FLAGS,
+	    "<inf> net_mgmt: connection established with the server\n");
+}
+
+ZTEST(log_output_bench, test_args)
+{
+	int rc;
+
+	rc = cbprintf_package(package, sizeof(package), 0,
+			      "sensor %d: temperature %d.%02d C, state %s",
+			      3, 23, 5, "running");
+	zassert_true(rc > 0, "package failed %d", rc);
+
+	run("args", "sensor", LOG_LEVEL_WRN, BENCH_FLAGS,
+	    "<wrn> sensor: sensor 3: temperature 23.05 C, state running\n");
+}
+
+ZTEST(log_output_bench, test_raw)
+{
+	int rc;
+
+	rc = cbprintf_package(package, sizeof(package), 0,
+			      "uptime %u ms\nthreads %d\nstacks ok\n",
+			      123456U, 7);
+	zassert_true(rc > 0, "package failed %d", rc);
+
+	run("raw", NULL, LOG_LEVEL_INTERNAL_RAW_STRING, 0,
+	    "uptime 123456 ms\r\nthreads 7\r\nstacks ok\r\n");
+}
+
+struct bench_buf {
+	char data[128];
+	size_t len;
+};
+
+static int buf_out(int c, void *ctx)
+{
+	struct bench_buf *b = ctx;
+
+	if (b->len < sizeof(b->data)) {
+		b->data[b->len++] = (char)c;
+	}
+
+	return c;
+}
+
+static int buf_span(const char *s, size_t len, void *ctx)
+{
+	struct bench_buf *b = ctx;
+
+	len = MIN(len, sizeof(b->data) - b->len);
+	memcpy(&b->data[b->len], s, len);
+	b->len += len;
+
+	return 0;
+}
+
+static int format(cbprintf_span_cb span, struct bench_buf *b,
+		  const char *fmt, ...)
+{
+	va_list ap;
+	int rc;
+
+	b->len = 0;
+	va_start(ap, fmt);
+	if (span) {
+		rc = cbvprintf_span(buf_out, span, b, fmt, ap);
+	} else {
+		rc = cbvprintf(buf_out, b, fmt, ap);
+	}
+	va_end(ap);
+
+	return rc;
+}
+
+static void run_cbprintf(const char *name, cbprintf_span_cb span)
+{
+	static const char expected[] = "[00000999] <inf> sensor: sensor 3: "
+				       "temperature 23.05 C, state running\n";
+	struct bench_buf b;
+	uint32_t cycles;
+	int rc = 0;
+
+	cycles = k_cycle_get_32();
+	for (int i = 0; i < N_MSGS; i++) {
+		rc = format(span, &b, "[%08u] <inf> sensor: sensor %d: "
+			    "temperature %d.%02d C, state %s\n",
+			    i, 3, 23, 5, "running");
+	}
+	cycles = k_cycle_get_32() - cycles;
+
+	TC_PRINT("%-8s cycles/msg %6u\n", name, cycles / N_MSGS);
+
+	zassert_equal(rc, sizeof(expected) - 1, "%s returned %d", name, rc);
+	zassert_equal(b.len, sizeof(expected) - 1, NULL);
+	zassert_equal(memcmp(b.data, expected, b.len), 0, NULL);
+}
+
+ZTEST(log_output_bench, test_cbprintf)
+{
+	run_cbprintf("per char", NULL);
+}
+
+ZTEST(log_output_bench, test_cbprintf_span)
+{
+	run_cbprintf("span", buf_span);
+}
+
+ZTEST_SUITE(log_output_bench, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/irq_offload.h>
+
+/* This is a memory slab contention benchmark. For each number of CPUs
+ * from one to all of them, one thread per CPU repeatedly allocates and
+ * frees a block from a slab shared by all threads, either directly
+ * ("thread") or from an offloaded interrupt ("isr"), and the average
+ * number of cycles per alloc/free pair is reported.
+ *
+ * Threads run at a lower priority than the test thread, which starts them
+ * all at once. The slab has enough blocks for every thread to hold a few,
+ * so an allocation that fails is an error. Each thread writes its id into
+ * the blocks it holds and checks it before freeing them, which catches a
+ * block handed out twice.
+ */
+
+#define N_RUNS     20000
+#define N_HELD     4
+#define N_BLOCKS   (CONFIG_MP_MAX_NUM_CPUS * N_HELD)
+#define STACK_SIZE 1024
+#define PRIORITY   K_PRIO_PREEMPT(5)
+
+K_MEM_SLAB_DEFINE_STATIC(slab, 64, N_BLOCKS, 8);
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, CONFIG_MP_MAX_NUM_CPUS, STACK_SIZE);
+static struct k_thread threads[CONFIG_MP_MAX_NUM_CPUS];
+
+static void *all_blocks[N_BLOCKS];
+
+static atomic_t ready;
+static atomic_t start;
+static atomic_t failures;
+static atomic_t corruptions;
+
+static void alloc_free_pairs(const void *arg)
+{
+	uintptr_t id = (uintptr_t)arg;
+	void *blocks[N_HELD];
+
+	for (int i = 0; i < N_RUNS / N_HELD; i++) {
+		for (int j = 0; j < N_HELD; j++) {
+			if (k_mem_slab_alloc(&slab, &blocks[j], K_NO_WAIT) != 0) {
+				atomic_inc(&failures);
+				blocks[j] = NULL;
+				continue;
+			}
+			*(uintptr_t *)blocks[j] = id;
+		}
+		for (int j = 0; j < N_HELD; j++) {
+			if (blocks[j] == NULL) {
+				continue;
+			}
+			if (*(uintptr_t *)blocks[j] != id) {
+				atomic_inc(&corruptions);
+			}
+			k_mem_slab_free(&slab, &blocks[j]);
+		}
+	}
+}
+
+static void worker(void *arg1, void *arg2, void *arg3)
+{
+	bool isr = (bool)POINTER_TO_UINT(arg1);
+
+	ARG_UNUSED(arg3);
+
+	atomic_inc(&ready);
+	while (!atomic_get(&start)) {
+	}
+
+	if (isr) {
+		irq_offload(alloc_free_pairs, arg2);
+	} else {
+		alloc_free_pairs(arg2);
+	}
+}
+
+static uint32_t run(unsigned int num_cpus, bool isr)
+{
+	uint32_t cycles;
+
+	atomic_clear(&ready);
+	atomic_clear(&start);
+	atomic_clear(&failures);
+	atomic_clear(&corruptions);
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, worker,
+				UINT_TO_POINTER(isr), UINT_TO_POINTER(i + 1),
+				NULL, PRIORITY, 0, K_NO_WAIT);
+	}
+
+	while (atomic_get(&ready) < num_cpus) {
+		k_sleep(K_MSEC(1));
+	}
+
+	cycles = k_cycle_get_32();
+	atomic_set(&start, 1);
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+
+	cycles = k_cycle_get_32() - cycles;
+
+	zassert_equal(atomic_get(&failures), 0, "%ld allocations failed",
+		      atomic_get(&failures));
+	zassert_equal(atomic_get(&corruptions), 0,
+		      "%ld blocks were handed out twice",
+		      atomic_get(&corruptions));
+	zassert_equal(k_mem_slab_num_used_get(&slab), 0, "blocks leaked");
+
+	/* Every block must still be on the free list */
+	for (int i = 0; i < N_BLOCKS; i++) {
+		zassert_equal(k_mem_slab_alloc(&slab, &all_blocks[i], K_NO_WAIT),
+			      0, "free list lost block %d", i);
+	}
+	for (int i = 0; i < N_BLOCKS; i++) {
+		k_mem_slab_free(&slab, &all_blocks[i]);
+	}
+
+	return cycles / (num_cpus * (N_RUNS / N_HELD) * N_HELD);
+}
+
+ZTEST(mem_slab_bench, test_thread)
+{
+	for (unsigned int num_cpus = 1; num_cpus <= arch_num_cpus(); num_cpus++) {
+		TC_PRINT("thread cpus %u cycles/pair %u\n", num_cpus,
+			 run(num_cpus, false));
+	}
+}
+
+ZTEST(mem_slab_bench, test_isr)
+{
+	for (unsigned int num_cpus = 1; num_cpus <= arch_num_cpus(); num_cpus++) {
+		TC_PRINT("isr cpus %u cycles/pair %u\n", num_cpus,
+			 run(num_cpus, true));
+	}
+}
+
+static void *mem_slab_bench_setup(void)
+{
+	TC_PRINT("mem slab benchmark: lock-free free list %s\n",
+		 IS_ENABLED(CONFIG_MEM_SLAB_LOCKLESS) ? "on" : "off");
+
+	return NULL;
+}
+
+ZTEST_SUITE(mem_slab_bench, NULL, mem_slab_bench_setup, NULL, NULL, NULL);
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+/* This is a mutex contention benchmark. For each number of CPUs from one
+ * to all of them, one thread per CPU repeatedly locks and unlocks either
+ * its own mutex ("private") or a mutex shared by all threads ("shared"),
+ * and the average number of cycles per lock/unlock pair is reported.
+ *
+ * Every thread increments a counter protected by its mutex, so a lost
+ * update or a mutex left locked fails the test.
+ *
+ * Threads run at a lower priority than the test thread, which starts them
+ * all at once, so that at most one worker is briefly preempted.
+ */
+
+#define N_RUNS     20000
+#define STACK_SIZE 1024
+#define PRIORITY   K_PRIO_PREEMPT(5)
+
+/* Keep the private mutexes and their counters on separate cache lines */
+struct bench_mutex {
+	struct k_mutex mutex;
+	uint32_t counter;
+} __aligned(64);
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, CONFIG_MP_MAX_NUM_CPUS, STACK_SIZE);
+static struct k_thread threads[CONFIG_MP_MAX_NUM_CPUS];
+static struct bench_mutex mutexes[CONFIG_MP_MAX_NUM_CPUS];
+
+static atomic_t ready;
+static atomic_t start;
+
+static void worker(void *arg1, void *arg2, void *arg3)
+{
+	struct bench_mutex *bm = arg1;
+
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	atomic_inc(&ready);
+	while (!atomic_get(&start)) {
+	}
+
+	for (int i = 0; i < N_RUNS; i++) {
+		k_mutex_lock(&bm->mutex, K_FOREVER);
+		bm->counter++;
+		k_mutex_unlock(&bm->mutex);
+	}
+}
+
+static void check_mutex(struct bench_mutex *bm, uint32_t expected)
+{
+	zassert_equal(bm->counter, expected, "counter %u, expected %u",
+		      bm->counter, expected);
+	zassert_is_null(bm->mutex.owner, "mutex left locked");
+	zassert_equal(bm->mutex.lock_count, 0, "mutex left locked");
+}
+
+static uint32_t run(unsigned int num_cpus, bool shared)
+{
+	uint32_t cycles;
+
+	atomic_clear(&ready);
+	atomic_clear(&start);
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		struct bench_mutex *bm = &mutexes[shared ? 0 : i];
+
+		k_mutex_init(&bm->mutex);
+		bm->counter = 0;
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, worker,
+				bm, NULL, NULL, PRIORITY, 0, K_NO_WAIT);
+	}
+
+	while (atomic_get(&ready) < num_cpus) {
+		k_sleep(K_MSEC(1));
+	}
+
+	cycles = k_cycle_get_32();
+	atomic_set(&start, 1);
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+
+	cycles = k_cycle_get_32() - cycles;
+
+	if (shared) {
+		check_mutex(&mutexes[0], num_cpus * N_RUNS);
+	} else {
+		for (unsigned int i = 0; i < num_cpus; i++) {
+			check_mutex(&mutexes[i], N_RUNS);
+		}
+	}
+
+	return cycles / (num_cpus * N_RUNS);
+}
+
+ZTEST(mutex_bench, test_private)
+{
+	for (unsigned int num_cpus = 1; num_cpus <= arch_num_cpus(); num_cpus++) {
+		TC_PRINT("private cpus %u cycles/op %u\n", num_cpus,
+			 run(num_cpus, false));
+	}
+}
+
+ZTEST(mutex_bench, test_shared)
+{
+	for (unsigned int num_cpus = 1; num_cpus <= arch_num_cpus(); num_cpus++) {
+		TC_PRINT("shared cpus %u cycles/op %u\n", num_cpus,
+			 run(num_cpus, true));
+	}
+}
+
+static void *mutex_bench_setup(void)
+{
+	TC_PRINT("mutex benchmark: fast path %s\n",
+		 IS_ENABLED(CONFIG_MUTEX_FAST_PATH) ? "on" : "off");
+
+	return NULL;
+}
+
+ZTEST_SUITE(mutex_bench, NULL, mutex_bench_setup, NULL, NULL, NULL);
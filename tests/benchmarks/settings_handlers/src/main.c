@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/settings/settings.h>
+
+/* This is a settings handler lookup benchmark. 64 static handlers named
+ * "bench/<n>" and 64 dynamic handlers named "dyn/<n>" are registered, and
+ * a settings source in RAM loads keys spread evenly over all of them. The
+ * average number of cycles per loaded key is reported.
+ *
+ * Key i belongs to the static handlers if i is even and to the dynamic
+ * ones if it is odd, and the handlers check that they are given each of
+ * their keys once, with their own name stripped off.
+ */
+
+#define N_HANDLERS 64
+#define N_KEYS     2000
+#define NAME_LEN   24
+
+static unsigned int hits;
+static unsigned int bad;
+static uint8_t seen[N_KEYS];
+
+static void check_key(const char *key, int parity)
+{
+	char *end;
+	unsigned long i;
+
+	if (strncmp(key, "key", 3) != 0) {
+		bad++;
+		return;
+	}
+
+	i = strtoul(&key[3], &end, 10);
+	if ((*end != '\0') || (i >= N_KEYS) || ((i % 2) != parity) ||
+	    (seen[i]++ != 0U)) {
+		bad++;
+		return;
+	}
+
+	hits++;
+}
+
+static int bench_set(const char *key, size_t len, settings_read_cb read_cb,
+		     void *cb_arg)
+{
+	check_key(key, 0);
+
+	return 0;
+}
+
+static int dyn_set(const char *key, size_t len, settings_read_cb read_cb,
+		   void *cb_arg)
+{
+	check_key(key, 1);
+
+	return 0;
+}
+
+#define BENCH_HANDLER(n, _) \
+	SETTINGS_STATIC_HANDLER_DEFINE(bench_##n, "bench/" #n, NULL, \
+				       bench_set, NULL, NULL);
+
+LISTIFY(N_HANDLERS, BENCH_HANDLER, ())
+
+static char dyn_names[N_HANDLERS][NAME_LEN];
+static struct settings_handler dyn_handlers[N_HANDLERS];
+
+static char keys[N_KEYS][NAME_LEN];
+
+static ssize_t ram_read(void *cb_arg, void *data, size_t len)
+{
+	return 0;
+}
+
+static int ram_load(struct settings_store *cs,
+		    const struct settings_load_arg *arg)
+{
+	for (int i = 0; i < N_KEYS; i++) {
+		(void)settings_call_set_handler(keys[i], 0, ram_read, NULL,
+						arg);
+	}
+
+	return 0;
+}
+
+static const struct settings_store_itf ram_itf = {
+	.csi_load = ram_load,
+};
+
+static struct settings_store ram_store = {
+	.cs_itf = &ram_itf,
+};
+
+ZTEST(settings_handlers_bench, test_load)
+{
+	uint32_t cycles;
+	int rc;
+
+	cycles = k_cycle_get_32();
+	rc = settings_load();
+	cycles = k_cycle_get_32() - cycles;
+
+	zassert_equal(rc, 0, "load failed %d", rc);
+	zassert_equal(bad, 0, "%u keys given to the wrong handler or twice",
+		      bad);
+	zassert_equal(hits, N_KEYS, "%u of %u keys handled", hits, N_KEYS);
+
+	TC_PRINT("handlers %3u keys %4u cycles/key %u\n", 2 * N_HANDLERS,
+		 N_KEYS, cycles / N_KEYS);
+}
+
+static void *settings_handlers_bench_setup(void)
+{
+	zassume_equal(settings_subsys_init(), 0, "settings init failed");
+
+	for (int i = 0; i < N_HANDLERS; i++) {
+		snprintf(dyn_names[i], NAME_LEN, "dyn/%d", i);
+		dyn_handlers[i].name = dyn_names[i];
+		dyn_handlers[i].h_set = dyn_set;
+		zassume_equal(settings_register(&dyn_handlers[i]), 0,
+			      "registering %s failed", dyn_names[i]);
+	}
+
+	/* Alternate static and dynamic handlers */
+	for (int i = 0; i < N_KEYS; i++) {
+		int h = (i / 2) % N_HANDLERS;
+
+		snprintf(keys[i], NAME_LEN, "%s/%d/key%d",
+			 (i % 2) ? "dyn" : "bench", h, i);
+	}
+
+	settings_src_register(&ram_store);
+
+	TC_PRINT("settings handler benchmark: handler trie %s\n",
+		 IS_ENABLED(CONFIG_SETTINGS_HANDLER_TRIE) ? "on" : "off");
+
+	return NULL;
+}
+
+ZTEST_SUITE(settings_handlers_bench, NULL, settings_handlers_bench_setup, NULL,
+	    NULL, NULL);
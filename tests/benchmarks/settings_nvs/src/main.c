@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/storage/flash_map.h>
+#include "settings/settings_nvs.h"
+
+/* This is a settings load benchmark for the NVS back-end. For each number
+ * of settings, a dedicated NVS instance is cleared and filled with settings
+ * in the layout of the settings NVS back-end, one value in four being
+ * written twice, and the time taken by settings_load() is reported.
+ *
+ * The handler checks that every setting is loaded once, with the value
+ * written last.
+ */
+
+#define SECTOR_SIZE  (32 * 1024)
+#define SECTOR_COUNT (FIXED_PARTITION_SIZE(bench_partition) / SECTOR_SIZE)
+
+#define MAX_ENTRIES  2000
+
+static const unsigned int entry_counts[] = { 100, 500, MAX_ENTRIES };
+
+static struct settings_nvs bench_nvs;
+static unsigned int loaded;
+static unsigned int bad;
+static uint8_t seen[MAX_ENTRIES];
+
+static uint32_t expected_value(uint32_t i)
+{
+	/* One value in four was rewritten, see fill() */
+	return ((i % 4U) == 0U) ? ~i : i;
+}
+
+static int bench_set(const char *name, size_t len, settings_read_cb read_cb,
+		     void *cb_arg)
+{
+	unsigned long i = strtoul(name, NULL, 10);
+	uint32_t value;
+
+	if ((i >= MAX_ENTRIES) || (seen[i]++ != 0U) ||
+	    (read_cb(cb_arg, &value, sizeof(value)) != sizeof(value)) ||
+	    (value != expected_value(i))) {
+		bad++;
+		return 0;
+	}
+
+	loaded++;
+
+	return 0;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(bench, "bench", NULL, bench_set, NULL, NULL);
+
+static int fill(unsigned int num_entries)
+{
+	uint16_t last_name_id = NVS_NAMECNT_ID + num_entries;
+	char name[16];
+	int rc;
+
+	for (uint32_t i = 0; i < num_entries; i++) {
+		uint16_t name_id = NVS_NAMECNT_ID + 1 + i;
+
+		snprintf(name, sizeof(name), "bench/%04u", i);
+
+		rc = nvs_write(&bench_nvs.cf_nvs, name_id + NVS_NAME_ID_OFFSET,
+			       &i, sizeof(i));
+		if (rc >= 0) {
+			rc = nvs_write(&bench_nvs.cf_nvs, name_id, name,
+				       strlen(name));
+		}
+		if (rc < 0) {
+			return rc;
+		}
+	}
+
+	for (uint32_t i = 0; i < num_entries; i += 4) {
+		uint32_t value = expected_value(i);
+
+		rc = nvs_write(&bench_nvs.cf_nvs,
+			       NVS_NAMECNT_ID + 1 + i + NVS_NAME_ID_OFFSET,
+			       &value, sizeof(value));
+		if (rc < 0) {
+			return rc;
+		}
+	}
+
+	rc = nvs_write(&bench_nvs.cf_nvs, NVS_NAMECNT_ID, &last_name_id,
+		       sizeof(last_name_id));
+
+	return (rc < 0) ? rc : 0;
+}
+
+static void run(unsigned int num_entries)
+{
+	int64_t start, ticks;
+	int rc;
+
+	if (bench_nvs.cf_nvs.ready) {
+		rc = nvs_clear(&bench_nvs.cf_nvs);
+		zassert_equal(rc, 0, "nvs_clear failed %d", rc);
+	}
+
+	rc = settings_nvs_backend_init(&bench_nvs);
+	zassert_equal(rc, 0, "backend init failed %d", rc);
+	rc = fill(num_entries);
+	zassert_equal(rc, 0, "filling %u entries failed %d", num_entries, rc);
+
+	/* Remount to pick up the largest name id in use */
+	rc = settings_nvs_backend_init(&bench_nvs);
+	zassert_equal(rc, 0, "backend init failed %d", rc);
+
+	loaded = 0;
+	bad = 0;
+	memset(seen, 0, sizeof(seen));
+
+	start = k_uptime_ticks();
+	rc = settings_load();
+	ticks = k_uptime_ticks() - start;
+	zassert_equal(rc, 0, "settings_load failed %d", rc);
+
+	zassert_equal(bad, 0, "%u settings duplicated or with a stale value",
+		      bad);
+	zassert_equal(loaded, num_entries, "loaded %u of %u settings", loaded,
+		      num_entries);
+
+	TC_PRINT("entries %4u loaded %4u load us %u\n", num_entries, loaded,
+		 (uint32_t)k_ticks_to_us_floor64(ticks));
+}
+
+ZTEST(settings_nvs_bench, test_load)
+{
+	for (int i = 0; i < ARRAY_SIZE(entry_counts); i++) {
+		run(entry_counts[i]);
+	}
+}
+
+static void *settings_nvs_bench_setup(void)
+{
+	zassume_equal(settings_subsys_init(), 0, "settings init failed");
+
+	bench_nvs.flash_dev = FIXED_PARTITION_DEVICE(bench_partition);
+	bench_nvs.cf_nvs.offset = FIXED_PARTITION_OFFSET(bench_partition);
+	bench_nvs.cf_nvs.sector_size = SECTOR_SIZE;
+	bench_nvs.cf_nvs.sector_count = SECTOR_COUNT;
+
+	settings_nvs_src(&bench_nvs);
+
+	TC_PRINT("settings nvs benchmark: streaming load %s\n",
+		 IS_ENABLED(CONFIG_SETTINGS_NVS_STREAMING_LOAD) ? "on" : "off");
+
+	return NULL;
+}
+
+ZTEST_SUITE(settings_nvs_bench, NULL, settings_nvs_bench_setup, NULL, NULL,
+	    NULL);
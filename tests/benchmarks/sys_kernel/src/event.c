@@ -0,0 +1,150 @@
+/* event.c */
+
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "syskernel.h"
+
+/* Threads waiting on other event bits than the posted one */
+#define IDLE_WAITERS       8
+#define IDLE_STACK_SIZE    (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+struct k_event event1;
+
+static K_THREAD_STACK_ARRAY_DEFINE(idle_stacks, IDLE_WAITERS, IDLE_STACK_SIZE);
+static struct k_thread idle_threads[IDLE_WAITERS];
+static int idle_wakeups;
+
+/**
+ *
+ * @brief Event test thread
+ *
+ * @param par1   Address of the counter.
+ * @param par2   Number of test loops.
+ * @param par3   Unused
+ *
+ */
+void event_thread1(void *par1, void *par2, void *par3)
+{
+	int i;
+	int *pcounter = (int *)par1;
+	int num_loops = POINTER_TO_INT(par2);
+
+	ARG_UNUSED(par3);
+
+	for (i = 0; i < num_loops; i++) {
+		k_event_wait(&event1, BIT(0), true, K_FOREVER);
+		(*pcounter)++;
+	}
+}
+
+/**
+ *
+ * @brief Idle event waiter, must never wake up
+ *
+ * @param par1   Event bit to wait for.
+ * @param par2   Unused
+ * @param par3   Unused
+ *
+ */
+void event_idle_thread(void *par1, void *par2, void *par3)
+{
+	ARG_UNUSED(par2);
+	ARG_UNUSED(par3);
+
+	k_event_wait(&event1, BIT(POINTER_TO_INT(par1)), false, K_FOREVER);
+	idle_wakeups++;
+}
+
+/**
+ *
+ * @brief Post event bit 0 to a waiting thread
+ *
+ * @param pcounter   Address of the counter.
+ *
+ * @return time in ticks for the whole test
+ */
+static uint32_t event_post_test(int *pcounter)
+{
+	uint32_t t;
+	int i;
+
+	t = BENCH_START();
+
+	k_thread_create(&thread_data1, thread_stack1, STACK_SIZE, event_thread1,
+			 (void *) pcounter, INT_TO_POINTER(number_of_loops),
+			 NULL, K_PRIO_COOP(3), 0, K_NO_WAIT);
+	for (i = 0; i < number_of_loops; i++) {
+		k_event_post(&event1, BIT(0));
+	}
+
+	t = TIME_STAMP_DELTA_GET(t);
+
+	return t;
+}
+
+/**
+ *
+ * @brief The main test entry
+ *
+ * @return number of successful test cases
+ */
+int event_test(void)
+{
+	uint32_t t;
+	int i = 0;
+	int j;
+	int return_value = 0;
+
+	fprintf(output_file, sz_test_case_fmt,
+			"Event #1");
+	fprintf(output_file, sz_description,
+			"\n\tk_event_init"
+			"\n\tk_event_wait(K_FOREVER)"
+			"\n\tk_event_post");
+	printf(sz_test_start_fmt);
+
+	k_event_init(&event1);
+
+	t = event_post_test(&i);
+
+	return_value += check_result(i, t);
+
+	fprintf(output_file, sz_test_case_fmt,
+			"Event #2");
+	fprintf(output_file, sz_description,
+			"\n\tk_event_init"
+			"\n\tk_event_wait(K_FOREVER)"
+			"\n\tk_event_post"
+			"\n\twith idle waiters on other events");
+	printf(sz_test_start_fmt);
+
+	k_event_init(&event1);
+	idle_wakeups = 0;
+
+	for (j = 0; j < IDLE_WAITERS; j++) {
+		k_thread_create(&idle_threads[j], idle_stacks[j],
+				 IDLE_STACK_SIZE, event_idle_thread,
+				 INT_TO_POINTER(1 + j), NULL, NULL,
+				 K_PRIO_COOP(3), 0, K_NO_WAIT);
+	}
+
+	i = 0;
+	t = event_post_test(&i);
+
+	/* Posting must only have woken the thread waiting for event 0 */
+	if (idle_wakeups != 0) {
+		i = 0;
+	}
+
+	for (j = 0; j < IDLE_WAITERS; j++) {
+		k_thread_abort(&idle_threads[j]);
+	}
+
+	return_value += check_result(i, t);
+
+	return return_value;
+}
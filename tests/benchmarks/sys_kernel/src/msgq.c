@@ -0,0 +1,182 @@
+/* msgq.c */
+
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "syskernel.h"
+
+#define MSGQ_LEN   16
+#define MSGQ_BATCH 8
+
+/* Sized like a typical sensor sample */
+struct msgq_msg {
+	uint32_t seq;
+	int16_t value[2];
+};
+
+struct k_msgq msgq1;
+
+static char __aligned(4) msgq1_buf[MSGQ_LEN * sizeof(struct msgq_msg)];
+static struct msgq_msg msgq_tx[MSGQ_BATCH];
+static struct msgq_msg msgq_rx[MSGQ_BATCH];
+
+/**
+ *
+ * @brief Initialize the message queue for the test
+ *
+ */
+void msgq_test_init(void)
+{
+	k_msgq_init(&msgq1, msgq1_buf, sizeof(struct msgq_msg), MSGQ_LEN);
+}
+
+/**
+ *
+ * @brief Message queue test thread, sends a batch of messages per loop
+ *
+ * @param par1   Number of messages per loop.
+ * @param par2   Number of test loops.
+ * @param par3   Unused
+ *
+ */
+void msgq_thread1(void *par1, void *par2, void *par3)
+{
+	int batch = POINTER_TO_INT(par1);
+	int num_loops = POINTER_TO_INT(par2);
+	uint32_t seq = 0;
+	int sent;
+	int ret;
+	int i;
+	int j;
+
+	ARG_UNUSED(par3);
+
+	for (i = 0; i < num_loops; i++) {
+		for (j = 0; j < batch; j++) {
+			msgq_tx[j].seq = seq++;
+		}
+
+		if (batch == 1) {
+			k_msgq_put(&msgq1, &msgq_tx[0], K_FOREVER);
+			continue;
+		}
+
+		for (sent = 0; sent < batch; sent += ret) {
+			ret = k_msgq_put_batch(&msgq1, &msgq_tx[sent],
+					       batch - sent, K_FOREVER);
+			if (ret < 0) {
+				return;
+			}
+		}
+	}
+}
+
+/**
+ *
+ * @brief Receive a batch of messages per loop and check their order
+ *
+ * @param batch       Number of messages per loop.
+ * @param num_loops   Number of test loops.
+ *
+ * @return number of batches received in order
+ */
+static int msgq_read_loops(int batch, int num_loops)
+{
+	uint32_t seq = 0;
+	int received;
+	int ret;
+	int i;
+	int j;
+
+	for (i = 0; i < num_loops; i++) {
+		if (batch == 1) {
+			if (k_msgq_get(&msgq1, &msgq_rx[0], K_FOREVER) != 0) {
+				return i;
+			}
+		} else {
+			for (received = 0; received < batch; received += ret) {
+				ret = k_msgq_get_batch(&msgq1,
+						       &msgq_rx[received],
+						       batch - received,
+						       K_FOREVER);
+				if (ret < 0) {
+					return i;
+				}
+			}
+		}
+
+		for (j = 0; j < batch; j++) {
+			if (msgq_rx[j].seq != seq++) {
+				return i;
+			}
+		}
+	}
+
+	return i;
+}
+
+/**
+ *
+ * @brief Run one batch size
+ *
+ * @param batch   Number of messages per loop.
+ *
+ * @return 1 if success and 0 on failure
+ */
+static int msgq_batch_test(int batch)
+{
+	uint32_t t;
+	int i;
+
+	msgq_test_init();
+
+	t = BENCH_START();
+
+	k_thread_create(&thread_data1, thread_stack1, STACK_SIZE, msgq_thread1,
+			 INT_TO_POINTER(batch), INT_TO_POINTER(number_of_loops),
+			 NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	i = msgq_read_loops(batch, number_of_loops);
+
+	t = TIME_STAMP_DELTA_GET(t);
+
+	/* The sender is left waiting if the receiver gave up */
+	k_thread_abort(&thread_data1);
+
+	return check_result(i, t);
+}
+
+/**
+ *
+ * @brief The main test entry
+ *
+ * @return number of successful test cases
+ */
+int msgq_test(void)
+{
+	int return_value = 0;
+
+	fprintf(output_file, sz_test_case_fmt,
+			"Message queue #1");
+	fprintf(output_file, sz_description,
+			"\n\tk_msgq_init"
+			"\n\tk_msgq_put(K_FOREVER)"
+			"\n\tk_msgq_get(K_FOREVER)");
+	printf(sz_test_start_fmt);
+
+	return_value += msgq_batch_test(1);
+
+	fprintf(output_file, sz_test_case_fmt,
+			"Message queue #2");
+	fprintf(output_file, sz_description,
+			"\n\tk_msgq_init"
+			"\n\tk_msgq_put_batch(K_FOREVER), 8 messages"
+			"\n\tk_msgq_get_batch(K_FOREVER), 8 messages");
+	printf(sz_test_start_fmt);
+
+	return_value += msgq_batch_test(MSGQ_BATCH);
+
+	return return_value;
+}
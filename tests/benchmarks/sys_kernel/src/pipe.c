@@ -0,0 +1,229 @@
+/* pipe.c */
+
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "syskernel.h"
+
+#include <string.h>
+
+#define PIPE_SIZE 256
+#define PIPE_XFER 64
+#define PIPE_SEGS 4
+
+enum pipe_mode {
+	PIPE_COPY,
+	PIPE_CLAIM,
+	PIPE_VEC,
+};
+
+struct k_pipe pipe1;
+
+static unsigned char __aligned(4) pipe1_buf[PIPE_SIZE];
+static uint8_t pipe_tx[PIPE_XFER];
+static uint8_t pipe_rx[PIPE_XFER];
+
+/**
+ *
+ * @brief Initialize the pipe for the test
+ *
+ */
+void pipe_test_init(void)
+{
+	k_pipe_init(&pipe1, pipe1_buf, PIPE_SIZE);
+}
+
+static inline uint8_t pipe_byte(int loop, size_t offset)
+{
+	return (uint8_t)(loop + offset);
+}
+
+static void pipe_make_vec(struct k_pipe_vec *vec, uint8_t *data)
+{
+	int i;
+
+	for (i = 0; i < PIPE_SEGS; i++) {
+		vec[i].data = &data[i * (PIPE_XFER / PIPE_SEGS)];
+		vec[i].len = PIPE_XFER / PIPE_SEGS;
+	}
+}
+
+/**
+ *
+ * @brief Pipe test thread, writes one transfer per loop
+ *
+ * @param par1   Transfer mode.
+ * @param par2   Number of test loops.
+ * @param par3   Unused
+ *
+ */
+void pipe_thread1(void *par1, void *par2, void *par3)
+{
+	enum pipe_mode mode = POINTER_TO_INT(par1);
+	int num_loops = POINTER_TO_INT(par2);
+	struct k_pipe_vec vec[PIPE_SEGS];
+	size_t written;
+	size_t done;
+	size_t j;
+	uint8_t *data;
+	int i;
+
+	ARG_UNUSED(par3);
+
+	for (i = 0; i < num_loops; i++) {
+		if (mode == PIPE_CLAIM) {
+			for (done = 0; done < PIPE_XFER; done += written) {
+				written = k_pipe_put_claim(&pipe1, &data,
+							   PIPE_XFER - done);
+				for (j = 0; j < written; j++) {
+					data[j] = pipe_byte(i, done + j);
+				}
+				k_pipe_put_finish(&pipe1, written);
+				if (written == 0) {
+					k_yield();
+				}
+			}
+			continue;
+		}
+
+		for (j = 0; j < PIPE_XFER; j++) {
+			pipe_tx[j] = pipe_byte(i, j);
+		}
+
+		if (mode == PIPE_COPY) {
+			k_pipe_put(&pipe1, pipe_tx, PIPE_XFER, &written,
+				   PIPE_XFER, K_FOREVER);
+		} else {
+			pipe_make_vec(vec, pipe_tx);
+			k_pipe_put_vec(&pipe1, vec, PIPE_SEGS, &written,
+				       PIPE_XFER, K_FOREVER);
+		}
+	}
+}
+
+/**
+ *
+ * @brief Read one transfer per loop and check its contents
+ *
+ * @param mode        Transfer mode.
+ * @param num_loops   Number of test loops.
+ *
+ * @return number of transfers read back intact
+ */
+static int pipe_read_loops(enum pipe_mode mode, int num_loops)
+{
+	struct k_pipe_vec vec[PIPE_SEGS];
+	size_t read;
+	size_t done;
+	size_t j;
+	uint8_t *data;
+	int i;
+
+	for (i = 0; i < num_loops; i++) {
+		if (mode == PIPE_CLAIM) {
+			for (done = 0; done < PIPE_XFER; done += read) {
+				read = k_pipe_get_claim(&pipe1, &data,
+							PIPE_XFER - done);
+				memcpy(&pipe_rx[done], data, read);
+				k_pipe_get_finish(&pipe1, read);
+				if (read == 0) {
+					k_yield();
+				}
+			}
+		} else if (mode == PIPE_COPY) {
+			k_pipe_get(&pipe1, pipe_rx, PIPE_XFER, &read,
+				   PIPE_XFER, K_FOREVER);
+		} else {
+			pipe_make_vec(vec, pipe_rx);
+			k_pipe_get_vec(&pipe1, vec, PIPE_SEGS, &read,
+				       PIPE_XFER, K_FOREVER);
+		}
+
+		for (j = 0; j < PIPE_XFER; j++) {
+			if (pipe_rx[j] != pipe_byte(i, j)) {
+				return i;
+			}
+		}
+	}
+
+	return i;
+}
+
+/**
+ *
+ * @brief Run one transfer mode
+ *
+ * @param mode   Transfer mode.
+ *
+ * @return 1 if success and 0 on failure
+ */
+static int pipe_mode_test(enum pipe_mode mode)
+{
+	uint32_t t;
+	int i;
+
+	pipe_test_init();
+
+	t = BENCH_START();
+
+	k_thread_create(&thread_data1, thread_stack1, STACK_SIZE, pipe_thread1,
+			 INT_TO_POINTER(mode), INT_TO_POINTER(number_of_loops),
+			 NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	i = pipe_read_loops(mode, number_of_loops);
+
+	t = TIME_STAMP_DELTA_GET(t);
+
+	/* The writer is left waiting if the reader gave up */
+	k_thread_abort(&thread_data1);
+
+	return check_result(i, t);
+}
+
+/**
+ *
+ * @brief The main test entry
+ *
+ * @return number of successful test cases
+ */
+int pipe_test(void)
+{
+	int return_value = 0;
+
+	fprintf(output_file, sz_test_case_fmt,
+			"Pipe #1");
+	fprintf(output_file, sz_description,
+			"\n\tk_pipe_init"
+			"\n\tk_pipe_put(K_FOREVER)"
+			"\n\tk_pipe_get(K_FOREVER)");
+	printf(sz_test_start_fmt);
+
+	return_value += pipe_mode_test(PIPE_COPY);
+
+	fprintf(output_file, sz_test_case_fmt,
+			"Pipe #2");
+	fprintf(output_file, sz_description,
+			"\n\tk_pipe_init"
+			"\n\tk_pipe_put_claim"
+			"\n\tk_pipe_put_finish"
+			"\n\tk_pipe_get_claim"
+			"\n\tk_pipe_get_finish"
+			"\n\tk_yield");
+	printf(sz_test_start_fmt);
+
+	return_value += pipe_mode_test(PIPE_CLAIM);
+
+	fprintf(output_file, sz_test_case_fmt,
+			"Pipe #3");
+	fprintf(output_file, sz_description,
+			"\n\tk_pipe_init"
+			"\n\tk_pipe_put_vec(K_FOREVER)"
+			"\n\tk_pipe_get_vec(K_FOREVER)");
+	printf(sz_test_start_fmt);
+
+	return_value += pipe_mode_test(PIPE_VEC);
+
+	return return_value;
+}
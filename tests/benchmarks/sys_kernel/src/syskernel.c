@@ -162,10 +162,13 @@ void main(void)
 		test_result += fifo_test();
 		test_result += stack_test();
 		test_result += mem_slab_test();
+		test_result += event_test();
+		test_result += pipe_test();
+		test_result += msgq_test();
 
 		if (test_result) {
-			/* sema/lifo/fifo/stack/mem_slab account for 14 tests in total */
-			if (test_result == 14) {
+			/* sema/lifo/fifo/stack/mem_slab/event/pipe/msgq account for 21 tests in total */
+			if (test_result == 21) {
 				fprintf(output_file, sz_module_result_fmt,
 					sz_success);
 			} else {
@@ -57,6 +57,9 @@ int lifo_test(void);
 int fifo_test(void);
 int stack_test(void);
 int mem_slab_test(void);
+int event_test(void);
+int pipe_test(void);
+int msgq_test(void);
 void begin_test(void);
 
 static inline uint32_t BENCH_START(void)
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/p4wq.h>
+#include <zephyr/sys/wsq.h>
+
+/* This is a work queue throughput benchmark. The test thread submits
+ * N_ITEMS work items, each spinning for WORK_LOOPS iterations, and waits
+ * until the last handler has returned. The total number of cycles divided
+ * by the number of work items is reported for a k_work_q, a P4 work queue
+ * and a work-stealing queue, all running their threads at the same
+ * priority, below the test thread.
+ *
+ * Every handler counts the runs of its item, and a test fails unless each
+ * item ran exactly once.
+ */
+
+#define N_ITEMS    512
+#define WORK_LOOPS 2000
+#define STACK_SIZE 1024
+#define PRIORITY   K_PRIO_PREEMPT(1)
+
+static K_THREAD_STACK_DEFINE(work_q_stack, STACK_SIZE);
+static struct k_work_q work_q;
+static struct k_work works[N_ITEMS];
+
+K_P4WQ_DEFINE(p4wq, CONFIG_MP_MAX_NUM_CPUS, STACK_SIZE);
+static struct k_p4wq_work p4works[N_ITEMS];
+
+K_WSQ_DEFINE(wsq, STACK_SIZE);
+static struct k_wsq_work wsqworks[N_ITEMS];
+
+static atomic_t runs[N_ITEMS];
+static atomic_t remaining;
+static K_SEM_DEFINE(done, 0, 1);
+static volatile uint32_t sink;
+
+static void work_item(int i)
+{
+	uint32_t x = 0;
+
+	for (int j = 0; j < WORK_LOOPS; j++) {
+		x = (x * 1103515245U) + 12345U;
+	}
+	sink = x;
+
+	atomic_inc(&runs[i]);
+
+	if (atomic_dec(&remaining) == 1) {
+		k_sem_give(&done);
+	}
+}
+
+static void work_handler(struct k_work *work)
+{
+	work_item(work - works);
+}
+
+static void p4wq_handler(struct k_p4wq_work *work)
+{
+	work_item(work - p4works);
+}
+
+static void wsq_handler(struct k_wsq_work *work)
+{
+	work_item(work - wsqworks);
+}
+
+static void submit_work_q(int i)
+{
+	zassert_equal(k_work_submit_to_queue(&work_q, &works[i]), 1,
+		      "item %d not queued", i);
+}
+
+static void submit_p4wq(int i)
+{
+	k_p4wq_submit(&p4wq, &p4works[i]);
+}
+
+static void submit_wsq(int i)
+{
+	zassert_equal(k_wsq_submit(&wsq, &wsqworks[i]), 1,
+		      "item %d not queued", i);
+}
+
+static void run(const char *name, void (*submit)(int i))
+{
+	uint32_t cycles;
+
+	for (int i = 0; i < N_ITEMS; i++) {
+		atomic_clear(&runs[i]);
+	}
+	atomic_set(&remaining, N_ITEMS);
+
+	cycles = k_cycle_get_32();
+	for (int i = 0; i < N_ITEMS; i++) {
+		submit(i);
+	}
+	zassert_equal(k_sem_take(&done, K_SECONDS(60)), 0,
+		      "%ld items did not run", atomic_get(&remaining));
+	cycles = k_cycle_get_32() - cycles;
+
+	for (int i = 0; i < N_ITEMS; i++) {
+		zassert_equal(atomic_get(&runs[i]), 1, "item %d ran %ld times",
+			      i, atomic_get(&runs[i]));
+	}
+
+	TC_PRINT("%s cycles/item %u\n", name, cycles / N_ITEMS);
+}
+
+ZTEST(wsq_bench, test_work_q)
+{
+	run("k_work_q", submit_work_q);
+}
+
+ZTEST(wsq_bench, test_p4wq)
+{
+	run("p4wq", submit_p4wq);
+}
+
+ZTEST(wsq_bench, test_wsq)
+{
+	run("wsq", submit_wsq);
+}
+
+static void *wsq_bench_setup(void)
+{
+	TC_PRINT("work queue benchmark: %u CPUs, %d items\n", arch_num_cpus(),
+		 N_ITEMS);
+
+	k_work_queue_start(&work_q, work_q_stack, STACK_SIZE, PRIORITY, NULL);
+	k_wsq_start(&wsq, PRIORITY);
+
+	for (int i = 0; i < N_ITEMS; i++) {
+		k_work_init(&works[i], work_handler);
+
+		p4works[i].priority = PRIORITY;
+		p4works[i].deadline = 0;
+		p4works[i].handler = p4wq_handler;
+
+		k_wsq_work_init(&wsqworks[i], wsq_handler);
+	}
+
+	return NULL;
+}
+
+ZTEST_SUITE(wsq_bench, NULL, wsq_bench_setup, NULL, NULL, NULL);
@@ -22,6 +22,7 @@
 
 int init_central(uint8_t iterations);
 int init_peripheral(uint8_t iterations);
+void ticker_stats_report_start(void);
 
 #define FAIL(...)					\
 	do {						\
@@ -41,6 +42,10 @@ static void test_central_main(void)
 {
 	int err;
 
+#if defined(CONFIG_BT_TICKER_STATS)
+	ticker_stats_report_start();
+#endif /* CONFIG_BT_TICKER_STATS */
+
 	err = init_central(ITERATIONS);
 	if (err) {
 		goto exit;
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/types.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/bluetooth/conn.h>
+
+#include "ticker/ticker.h"
+
+#define REPORT_INTERVAL K_MSEC(500)
+
+static struct k_work_delayable report_work;
+static uint32_t expire_prev;
+static uint32_t skip_prev;
+static uint32_t job_count_prev;
+static uint32_t job_cycles_prev;
+
+static void conn_count(struct bt_conn *conn, void *data)
+{
+	uint32_t *count = data;
+
+	(*count)++;
+}
+
+static void report_handler(struct k_work *work)
+{
+	struct ticker_stats_job job;
+	uint32_t job_cycles;
+	uint32_t job_count;
+	uint32_t roles = 0U;
+	uint32_t expire = 0U;
+	uint32_t skip = 0U;
+	uint32_t total;
+
+	bt_conn_foreach(BT_CONN_TYPE_LE, conn_count, &roles);
+
+	for (uint16_t id = 0U; id < CONFIG_BT_TICKER_STATS_NODE_COUNT; id++) {
+		struct ticker_stats_node node;
+
+		(void)ticker_stats_node_get(id, &node);
+		expire += node.expire;
+		skip += node.skip;
+	}
+
+	ticker_stats_job_get(&job);
+
+	total = (expire - expire_prev) + (skip - skip_prev);
+	job_count = job.count - job_count_prev;
+	job_cycles = job.cycles_sum - job_cycles_prev;
+
+	/* Event ring is not consumed, only the counters are reported */
+	printk("ticker_stats: roles %u expire %u skip %u efficiency %u%% "
+	       "job %u avg %u us max %u us\n", roles, expire - expire_prev,
+	       skip - skip_prev,
+	       total ? (((expire - expire_prev) * 100U) / total) : 100U,
+	       job_count,
+	       job_count ? k_cyc_to_us_floor32(job_cycles / job_count) : 0U,
+	       k_cyc_to_us_floor32(job.cycles_max));
+
+	expire_prev = expire;
+	skip_prev = skip;
+	job_count_prev = job.count;
+	job_cycles_prev = job.cycles_sum;
+
+	k_work_reschedule(&report_work, REPORT_INTERVAL);
+}
+
+void ticker_stats_report_start(void)
+{
+	k_work_init_delayable(&report_work, report_handler);
+	k_work_reschedule(&report_work, REPORT_INTERVAL);
+}
@@ -36,6 +36,8 @@ app=tests/bluetooth/bsim_bt/bsim_test_app conf_file=prj_split_privacy.conf \
 app=tests/bluetooth/bsim_bt/bsim_test_app conf_file=prj_split_low_lat.conf \
   compile
 app=tests/bluetooth/bsim_bt/bsim_test_multiple compile
+app=tests/bluetooth/bsim_bt/bsim_test_multiple \
+  conf_file=prj_ticker_stats.conf compile
 app=tests/bluetooth/bsim_bt/bsim_test_advx compile
 app=tests/bluetooth/bsim_bt/bsim_test_adv_chain compile
 app=tests/bluetooth/bsim_bt/bsim_test_gatt compile
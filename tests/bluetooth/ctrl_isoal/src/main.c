@@ -31,6 +31,9 @@ DEFINE_FFF_GLOBALS;
 /* Include Test Subsets */
 #include "sub_sets/isoal_test_rx.c"
 #include "sub_sets/isoal_test_tx.c"
+#if defined(CONFIG_BT_CTLR_ISOAL_SG)
+#include "sub_sets/isoal_test_sg.c"
+#endif /* CONFIG_BT_CTLR_ISOAL_SG */
 
 
 ZTEST_SUITE(test_rx_basics, NULL, NULL, isoal_test_rx_common_before, NULL, NULL);
@@ -42,3 +45,8 @@ ZTEST_SUITE(test_tx_unframed, NULL, NULL, isoal_test_tx_common_before, NULL, NUL
 ZTEST_SUITE(test_tx_framed, NULL, NULL, isoal_test_tx_common_before, NULL, NULL);
 
 ZTEST_SUITE(test_tx_framed_ebq, NULL, NULL, isoal_test_tx_common_before, NULL, NULL);
+
+#if defined(CONFIG_BT_CTLR_ISOAL_SG)
+ZTEST_SUITE(test_tx_sg, NULL, NULL, NULL, NULL, NULL);
+ZTEST_SUITE(test_rx_sg, NULL, NULL, NULL, NULL, NULL);
+#endif /* CONFIG_BT_CTLR_ISOAL_SG */
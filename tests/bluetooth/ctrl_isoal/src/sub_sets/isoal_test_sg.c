@@ -0,0 +1,413 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ *  Run this test from zephyr directory as:
+ *
+ *     ./scripts/twister -p native_posix -v -T tests/bluetooth/ctrl_isoal/ \
+ *                       -s bluetooth.isoal.test.sg
+ *
+ */
+
+/* SDU spanning two unframed or three framed PDUs */
+#define SG_SDU_SIZE     (2 * TEST_TX_PDU_PAYLOAD_MAX)
+#define SG_PDU_POOL     (8)
+
+/* Framed RX SDU filling a single PDU along with its segmentation header */
+#define SG_RX_FRAMED_SDU_SIZE (TEST_RX_PDU_PAYLOAD_MAX - PDU_ISO_SEG_HDR_SIZE - \
+			       PDU_ISO_SEG_TIMEOFFSET_SIZE)
+
+struct sg_pdu_buffer {
+	struct node_tx_iso node_tx;
+	uint8_t pdu[sizeof(struct pdu_iso) + TEST_TX_PDU_PAYLOAD_MAX];
+};
+
+static struct {
+	struct sg_pdu_buffer pool[SG_PDU_POOL];
+	uint32_t alloc_cnt;
+	/* Emitted PDUs, captured up to the pool size */
+	uint32_t emit_cnt;
+	uint8_t emitted[SG_PDU_POOL][sizeof(struct pdu_iso) + TEST_TX_PDU_PAYLOAD_MAX];
+	uint8_t sdu_fragments[SG_PDU_POOL];
+} sg_tx;
+
+static struct {
+	/* Preallocated SDU buffers */
+	struct rx_sdu_frag_buffer slab[2];
+	uint32_t alloc_cnt;
+	/* Reassemble into the SDU storage, i.e. without write callback */
+	bool direct;
+	uint32_t emit_cnt;
+	isoal_sdu_len_t emit_size;
+	const uint8_t *emit_data;
+} sg_rx;
+
+static isoal_status_t sg_pdu_alloc(struct isoal_pdu_buffer *pdu_buffer)
+{
+	struct sg_pdu_buffer *buf = &sg_tx.pool[sg_tx.alloc_cnt++ % SG_PDU_POOL];
+
+	pdu_buffer->handle = (void *)&buf->node_tx;
+	pdu_buffer->pdu = (struct pdu_iso *)buf->node_tx.pdu;
+	pdu_buffer->size = TEST_TX_PDU_PAYLOAD_MAX;
+
+	return ISOAL_STATUS_OK;
+}
+
+/* Same as the HCI data path PDU writer */
+static isoal_status_t sg_pdu_write(struct isoal_pdu_buffer *pdu_buffer,
+				   const size_t pdu_offset,
+				   const uint8_t *sdu_payload,
+				   const size_t consume_len)
+{
+	if ((pdu_offset + consume_len) > pdu_buffer->size) {
+		return ISOAL_STATUS_ERR_UNSPECIFIED;
+	}
+
+	memcpy(&pdu_buffer->pdu->payload[pdu_offset], sdu_payload, consume_len);
+
+	return ISOAL_STATUS_OK;
+}
+
+static isoal_status_t sg_pdu_emit(struct node_tx_iso *node_tx,
+				  const uint16_t handle)
+{
+	ARG_UNUSED(handle);
+
+	if (sg_tx.emit_cnt < SG_PDU_POOL) {
+		memcpy(sg_tx.emitted[sg_tx.emit_cnt], node_tx->pdu,
+		       sizeof(sg_tx.emitted[0]));
+		sg_tx.sdu_fragments[sg_tx.emit_cnt] = node_tx->sdu_fragments;
+	}
+
+	sg_tx.emit_cnt++;
+
+	return ISOAL_STATUS_OK;
+}
+
+static isoal_status_t sg_pdu_release(struct node_tx_iso *node_tx,
+				     const uint16_t handle,
+				     const isoal_status_t status)
+{
+	ARG_UNUSED(node_tx);
+	ARG_UNUSED(handle);
+	ARG_UNUSED(status);
+
+	return ISOAL_STATUS_OK;
+}
+
+static isoal_status_t sg_sdu_alloc(const struct isoal_sink *sink_ctx,
+				   const struct isoal_pdu_rx *valid_pdu,
+				   struct isoal_sdu_buffer *sdu_buffer)
+{
+	struct rx_sdu_frag_buffer *buf;
+
+	ARG_UNUSED(sink_ctx);
+	ARG_UNUSED(valid_pdu);
+
+	buf = &sg_rx.slab[sg_rx.alloc_cnt++ % ARRAY_SIZE(sg_rx.slab)];
+	buf->write_loc = 0;
+
+	sdu_buffer->dbuf = buf;
+	sdu_buffer->size = SG_SDU_SIZE;
+	sdu_buffer->data = sg_rx.direct ? buf->sdu : NULL;
+
+	return ISOAL_STATUS_OK;
+}
+
+static isoal_status_t sg_sdu_emit(const struct isoal_sink *sink_ctx,
+				  const struct isoal_emitted_sdu_frag *sdu_frag,
+				  const struct isoal_emitted_sdu *sdu)
+{
+	struct rx_sdu_frag_buffer *buf = sdu_frag->sdu.contents.dbuf;
+
+	ARG_UNUSED(sink_ctx);
+	ARG_UNUSED(sdu);
+
+	sg_rx.emit_data = buf->sdu;
+	sg_rx.emit_size = sdu_frag->sdu_frag_size;
+	sg_rx.emit_cnt++;
+
+	return ISOAL_STATUS_OK;
+}
+
+/* Appends to the SDU buffer, like the HCI data path net_buf writer */
+static isoal_status_t sg_sdu_write(void *dbuf,
+				   const uint8_t *pdu_payload,
+				   const size_t consume_len)
+{
+	struct rx_sdu_frag_buffer *buf = dbuf;
+
+	memcpy(&buf->sdu[buf->write_loc], pdu_payload, consume_len);
+	buf->write_loc += consume_len;
+
+	return ISOAL_STATUS_OK;
+}
+
+/**
+ * Create and enable a source writing through the PDU write callback or, in
+ * direct mode, by the ISO-AL copying into the PDU itself.
+ */
+static isoal_source_handle_t sg_tx_setup(uint8_t framed, bool direct)
+{
+	isoal_source_handle_t source_hdl;
+	isoal_status_t err;
+
+	ztest_set_assert_valid(false);
+
+	memset(&sg_tx, 0, sizeof(sg_tx));
+
+	err = isoal_init();
+	zassert_equal(err, ISOAL_STATUS_OK, "err = 0x%02x", err);
+
+	err = isoal_reset();
+	zassert_equal(err, ISOAL_STATUS_OK, "err = 0x%02x", err);
+
+	/* Unframed: two PDUs per SDU. Framed: room for the segment headers */
+	err = isoal_source_create(0x1234, BT_CONN_ROLE_PERIPHERAL, framed,
+				  framed ? 3 : 2, 1, TEST_TX_PDU_PAYLOAD_MAX,
+				  CONN_INT_UNIT_US, 1,
+				  CONN_INT_UNIT_US - 200, CONN_INT_UNIT_US - 50,
+				  sg_pdu_alloc, direct ? NULL : sg_pdu_write,
+				  sg_pdu_emit, sg_pdu_release, &source_hdl);
+	zassert_equal(err, ISOAL_STATUS_OK, "err = 0x%02x", err);
+
+	isoal_source_enable(source_hdl);
+
+	return source_hdl;
+}
+
+/**
+ * Create and enable a sink reassembling through the SDU write callback or, in
+ * direct mode, by the ISO-AL copying into the storage of the SDU buffer.
+ */
+static isoal_sink_handle_t sg_rx_setup(uint8_t framed, bool direct)
+{
+	isoal_sink_handle_t sink_hdl;
+	isoal_status_t err;
+
+	ztest_set_assert_valid(false);
+
+	memset(&sg_rx, 0, sizeof(sg_rx));
+	sg_rx.direct = direct;
+
+	err = isoal_init();
+	zassert_equal(err, ISOAL_STATUS_OK, "err = 0x%02x", err);
+
+	err = isoal_reset();
+	zassert_equal(err, ISOAL_STATUS_OK, "err = 0x%02x", err);
+
+	err = isoal_sink_create(0x1234, BT_CONN_ROLE_PERIPHERAL, framed,
+				framed ? 1 : 2, 1, CONN_INT_UNIT_US, 1,
+				CONN_INT_UNIT_US - 200, CONN_INT_UNIT_US - 50,
+				sg_sdu_alloc, sg_sdu_emit,
+				direct ? NULL : sg_sdu_write, &sink_hdl);
+	zassert_equal(err, ISOAL_STATUS_OK, "err = 0x%02x", err);
+
+	isoal_sink_enable(sink_hdl);
+
+	return sink_hdl;
+}
+
+/* Timing of the SDU submitted for the given event */
+static void sg_sdu_tx_timing(uint32_t event, struct isoal_sdu_tx *sdu_tx)
+{
+	sdu_tx->sdu_state = BT_ISO_SINGLE;
+	sdu_tx->packet_sn = event;
+	sdu_tx->iso_sdu_length = SG_SDU_SIZE;
+	sdu_tx->target_event = event;
+	sdu_tx->grp_ref_point = 10000 + (event * CONN_INT_UNIT_US);
+	sdu_tx->time_stamp = sdu_tx->grp_ref_point - 300;
+}
+
+/**
+ * Produce a single SDU, once contiguous through the write callback and once
+ * from host segments with direct copy, and compare the emitted PDUs.
+ */
+static void sg_tx_compare(uint8_t framed)
+{
+	uint8_t ref[SG_PDU_POOL][sizeof(struct pdu_iso) + TEST_TX_PDU_PAYLOAD_MAX];
+	uint8_t ref_fragments[SG_PDU_POOL];
+	uint8_t testdata[SG_SDU_SIZE];
+	struct isoal_sdu_seg seg[4];
+	isoal_source_handle_t source_hdl;
+	struct isoal_sdu_tx sdu_tx;
+	uint32_t ref_cnt;
+	isoal_status_t err;
+
+	init_test_data_buffer(testdata, sizeof(testdata));
+
+	/* Reference: contiguous SDU through the write callback */
+	source_hdl = sg_tx_setup(framed, false);
+
+	sg_sdu_tx_timing(100, &sdu_tx);
+	sdu_tx.dbuf = testdata;
+	sdu_tx.size = sizeof(testdata);
+
+	err = isoal_tx_sdu_fragment(source_hdl, &sdu_tx);
+	zassert_equal(err, ISOAL_STATUS_OK, "err = 0x%02x", err);
+	isoal_tx_event_prepare(source_hdl, 101);
+
+	ref_cnt = sg_tx.emit_cnt;
+	zassert_true(ref_cnt > 1 && ref_cnt <= SG_PDU_POOL, "%u PDUs", ref_cnt);
+	memcpy(ref, sg_tx.emitted, sizeof(ref));
+	memcpy(ref_fragments, sg_tx.sdu_fragments, sizeof(ref_fragments));
+
+	/* Same SDU as host segments, including an empty one and a PDU
+	 * boundary falling inside a segment.
+	 */
+	source_hdl = sg_tx_setup(framed, true);
+
+	seg[0].dbuf = &testdata[0];
+	seg[0].size = 7;
+	seg[1].dbuf = &testdata[7];
+	seg[1].size = 0;
+	seg[2].dbuf = &testdata[7];
+	seg[2].size = 33;
+	seg[3].dbuf = &testdata[40];
+	seg[3].size = SG_SDU_SIZE - 40;
+
+	sg_sdu_tx_timing(100, &sdu_tx);
+
+	err = isoal_tx_sdu_fragment_sg(source_hdl, &sdu_tx, seg, ARRAY_SIZE(seg));
+	zassert_equal(err, ISOAL_STATUS_OK, "err = 0x%02x", err);
+	isoal_tx_event_prepare(source_hdl, 101);
+
+	zassert_equal(sg_tx.emit_cnt, ref_cnt, "%u != %u", sg_tx.emit_cnt, ref_cnt);
+
+	for (uint32_t i = 0; i < ref_cnt; i++) {
+		const struct pdu_iso *pdu = (const struct pdu_iso *)ref[i];
+
+		zassert_mem_equal(sg_tx.emitted[i], ref[i],
+				  sizeof(struct pdu_iso) + pdu->length,
+				  "PDU %u differs", i);
+		/* One upper layer fragment, however many segments */
+		zassert_equal(sg_tx.sdu_fragments[i], ref_fragments[i],
+			      "PDU %u: %u != %u", i, sg_tx.sdu_fragments[i],
+			      ref_fragments[i]);
+	}
+}
+
+/**
+ * Test Suite  :   TX scatter-gather
+ *
+ * An unframed SDU given as host segments produces the same PDUs as the
+ * contiguous SDU.
+ */
+ZTEST(test_tx_sg, test_tx_sg_unframed)
+{
+	sg_tx_compare(false);
+}
+
+/**
+ * Test Suite  :   TX scatter-gather
+ *
+ * A framed SDU given as host segments produces the same PDUs, segmentation
+ * headers included, as the contiguous SDU.
+ */
+ZTEST(test_tx_sg, test_tx_sg_framed)
+{
+	sg_tx_compare(true);
+}
+
+/**
+ * Test Suite  :   TX scatter-gather
+ *
+ * A zero length SDU given as a single empty segment produces a zero length
+ * PDU completing one SDU fragment.
+ */
+ZTEST(test_tx_sg, test_tx_sg_zero_length)
+{
+	isoal_source_handle_t source_hdl;
+	struct isoal_sdu_tx sdu_tx;
+	struct isoal_sdu_seg seg;
+	isoal_status_t err;
+	uint8_t dummy;
+
+	source_hdl = sg_tx_setup(false, true);
+
+	seg.dbuf = &dummy;
+	seg.size = 0;
+
+	sg_sdu_tx_timing(100, &sdu_tx);
+	sdu_tx.iso_sdu_length = 0;
+
+	err = isoal_tx_sdu_fragment_sg(source_hdl, &sdu_tx, &seg, 1);
+	zassert_equal(err, ISOAL_STATUS_OK, "err = 0x%02x", err);
+
+	/* Zero length PDU followed by padding */
+	zassert_equal(sg_tx.emit_cnt, 2, "%u", sg_tx.emit_cnt);
+	zassert_equal(((struct pdu_iso *)sg_tx.emitted[0])->length, 0);
+	zassert_equal(((struct pdu_iso *)sg_tx.emitted[0])->ll_id,
+		      PDU_BIS_LLID_COMPLETE_END);
+	zassert_equal(sg_tx.sdu_fragments[0], 1);
+}
+
+/**
+ * Test Suite  :   RX scatter-gather
+ *
+ * An unframed SDU received in two PDUs is reassembled directly into the
+ * preallocated SDU buffer.
+ */
+ZTEST(test_rx_sg, test_rx_sg_unframed_direct)
+{
+	struct rx_pdu_meta_buffer rx_pdu_meta_buf;
+	uint8_t testdata[SG_SDU_SIZE];
+	isoal_sink_handle_t sink_hdl;
+	isoal_status_t err;
+
+	init_test_data_buffer(testdata, sizeof(testdata));
+	isoal_test_init_rx_pdu_buffer(&rx_pdu_meta_buf);
+
+	sink_hdl = sg_rx_setup(false, true);
+
+	isoal_test_create_unframed_pdu(PDU_BIS_LLID_START_CONTINUE,
+				       &testdata[0], TEST_RX_PDU_PAYLOAD_MAX,
+				       2000, 10000, ISOAL_PDU_STATUS_VALID,
+				       &rx_pdu_meta_buf.pdu_meta);
+	err = isoal_rx_pdu_recombine(sink_hdl, &rx_pdu_meta_buf.pdu_meta);
+	zassert_equal(err, ISOAL_STATUS_OK, "err = 0x%02x", err);
+
+	isoal_test_create_unframed_pdu(PDU_BIS_LLID_COMPLETE_END,
+				       &testdata[TEST_RX_PDU_PAYLOAD_MAX],
+				       SG_SDU_SIZE - TEST_RX_PDU_PAYLOAD_MAX,
+				       2001, 10000, ISOAL_PDU_STATUS_VALID,
+				       &rx_pdu_meta_buf.pdu_meta);
+	err = isoal_rx_pdu_recombine(sink_hdl, &rx_pdu_meta_buf.pdu_meta);
+	zassert_equal(err, ISOAL_STATUS_OK, "err = 0x%02x", err);
+
+	zassert_equal(sg_rx.alloc_cnt, 1, "%u", sg_rx.alloc_cnt);
+	zassert_equal(sg_rx.emit_cnt, 1, "%u", sg_rx.emit_cnt);
+	zassert_equal(sg_rx.emit_size, SG_SDU_SIZE, "%u", sg_rx.emit_size);
+	zassert_equal_ptr(sg_rx.emit_data, sg_rx.slab[0].sdu);
+	zassert_mem_equal(sg_rx.emit_data, testdata, SG_SDU_SIZE);
+}
+
+/**
+ * Test Suite  :   RX scatter-gather
+ *
+ * A framed SDU is reassembled directly into the preallocated SDU buffer.
+ */
+ZTEST(test_rx_sg, test_rx_sg_framed_direct)
+{
+	struct rx_pdu_meta_buffer rx_pdu_meta_buf;
+	uint8_t testdata[SG_RX_FRAMED_SDU_SIZE];
+	isoal_sink_handle_t sink_hdl;
+	isoal_status_t err;
+
+	init_test_data_buffer(testdata, sizeof(testdata));
+	isoal_test_init_rx_pdu_buffer(&rx_pdu_meta_buf);
+
+	sink_hdl = sg_rx_setup(true, true);
+
+	isoal_test_create_framed_pdu_base(2000, 10000, ISOAL_PDU_STATUS_VALID,
+					  &rx_pdu_meta_buf.pdu_meta);
+	isoal_test_add_framed_pdu_single(testdata, sizeof(testdata), 100,
+					 &rx_pdu_meta_buf.pdu_meta);
+	err = isoal_rx_pdu_recombine(sink_hdl, &rx_pdu_meta_buf.pdu_meta);
+	zassert_equal(err, ISOAL_STATUS_OK, "err = 0x%02x", err);
+
+	zassert_equal(sg_rx.emit_cnt, 1, "%u", sg_rx.emit_cnt);
+	zassert_equal(sg_rx.emit_size, sizeof(testdata), "%u", sg_rx.emit_size);
+	zassert_mem_equal(sg_rx.emit_data, testdata, sizeof(testdata));
+}
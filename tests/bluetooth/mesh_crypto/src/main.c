@@ -0,0 +1,187 @@
+/* Copyright (c) 2022 The Zephyr Project Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/buf.h>
+#include <tinycrypt/aes.h>
+
+#include "crypto.h"
+#include "subnet.h"
+
+#define IV_INDEX   0x12345678
+#define PDU_LEN    29
+#define CRED_COUNT 8
+
+static const uint8_t net_key[16] = {
+	0x7d, 0xd7, 0x36, 0x4c, 0xd8, 0x42, 0xad, 0x18,
+	0xc1, 0x7c, 0x2b, 0x82, 0x0c, 0x84, 0xc3, 0xd6,
+};
+
+static struct bt_mesh_net_cred creds[CRED_COUNT];
+
+static void pdu_create(struct net_buf_simple *buf, uint8_t nid, bool ctl)
+{
+	net_buf_simple_reset(buf);
+
+	net_buf_simple_add_u8(buf, nid | ((IV_INDEX & 1) << 7));
+	net_buf_simple_add_u8(buf, (ctl ? 0x80 : 0x00) | 0x0b);
+	net_buf_simple_add_be24(buf, 0x000006);
+	net_buf_simple_add_be16(buf, 0x1201);
+	net_buf_simple_add_be16(buf, 0xfffd);
+
+	while (buf->len < PDU_LEN - (ctl ? 8 : 4)) {
+		net_buf_simple_add_u8(buf, buf->len);
+	}
+}
+
+static void *setup(void)
+{
+	for (int i = 0; i < CRED_COUNT; i++) {
+		uint8_t key[16];
+		uint8_t p = 0;
+
+		memcpy(key, net_key, sizeof(key));
+		key[15] ^= i;
+
+		zassert_ok(bt_mesh_k2(key, &p, 1, &creds[i].nid, creds[i].enc,
+				      creds[i].privacy));
+		zassert_ok(bt_mesh_key_sched_set(&creds[i].enc_sched,
+						 creds[i].enc));
+		zassert_ok(bt_mesh_key_sched_set(&creds[i].privacy_sched,
+						 creds[i].privacy));
+	}
+
+	return NULL;
+}
+
+ZTEST_SUITE(mesh_crypto, NULL, setup, NULL, NULL, NULL);
+
+/* Network PDUs processed with cached key schedules shall be identical to
+ * those processed by expanding the key on every block operation.
+ */
+ZTEST(mesh_crypto, test_net_sched_equivalence)
+{
+	NET_BUF_SIMPLE_DEFINE(ref, PDU_LEN);
+	NET_BUF_SIMPLE_DEFINE(buf, PDU_LEN);
+	const struct bt_mesh_net_cred *cred = &creds[0];
+
+	for (int ctl = 0; ctl < 2; ctl++) {
+		pdu_create(&ref, cred->nid, ctl);
+		pdu_create(&buf, cred->nid, ctl);
+
+		zassert_ok(bt_mesh_net_encrypt(cred->enc, &ref, IV_INDEX,
+					       false));
+		zassert_ok(bt_mesh_net_obfuscate(ref.data, IV_INDEX,
+						 cred->privacy));
+
+		zassert_ok(bt_mesh_net_encrypt_sched(&cred->enc_sched, &buf,
+						     IV_INDEX, false));
+		zassert_ok(bt_mesh_net_obfuscate_sched(buf.data, IV_INDEX,
+						       &cred->privacy_sched));
+
+		zassert_equal(ref.len, PDU_LEN);
+		zassert_equal(buf.len, ref.len);
+		zassert_mem_equal(buf.data, ref.data, ref.len);
+
+		/* Decrypt with the cached schedule */
+		zassert_ok(bt_mesh_net_obfuscate_sched(buf.data, IV_INDEX,
+						       &cred->privacy_sched));
+		zassert_ok(bt_mesh_net_decrypt_sched(&cred->enc_sched, &buf,
+						     IV_INDEX, false));
+
+		pdu_create(&ref, cred->nid, ctl);
+		zassert_equal(buf.len, ref.len);
+		zassert_mem_equal(buf.data, ref.data, ref.len);
+	}
+}
+
+ZTEST(mesh_crypto, test_net_sched_wrong_key)
+{
+	NET_BUF_SIMPLE_DEFINE(buf, PDU_LEN);
+
+	pdu_create(&buf, creds[0].nid, false);
+
+	zassert_ok(bt_mesh_net_encrypt_sched(&creds[0].enc_sched, &buf,
+					     IV_INDEX, false));
+	zassert_equal(bt_mesh_net_decrypt_sched(&creds[1].enc_sched, &buf,
+						IV_INDEX, false), -EBADMSG);
+}
+
+#if defined(CONFIG_BT_MESH_CRYPTO_BENCHMARK)
+#define ITERATIONS 100
+
+/* Trial decrypt the PDU with every candidate credential until one matches,
+ * like bt_mesh_net_cred_find() does when NIDs collide.
+ */
+static int trial_decrypt(const struct net_buf_simple *in,
+			 struct net_buf_simple *out, int count, bool sched)
+{
+	for (int i = 0; i < count; i++) {
+		const struct bt_mesh_net_cred *cred = &creds[i];
+		int err;
+
+		net_buf_simple_reset(out);
+		net_buf_simple_add_mem(out, in->data, in->len);
+
+		if (sched) {
+			bt_mesh_net_obfuscate_sched(out->data, IV_INDEX,
+						    &cred->privacy_sched);
+			err = bt_mesh_net_decrypt_sched(&cred->enc_sched, out,
+							IV_INDEX, false);
+		} else {
+			bt_mesh_net_obfuscate(out->data, IV_INDEX,
+					      cred->privacy);
+			err = bt_mesh_net_decrypt(cred->enc, out, IV_INDEX,
+						  false);
+		}
+
+		if (!err) {
+			return i;
+		}
+	}
+
+	return -ENOENT;
+}
+
+static uint32_t decrypt_rate(const struct net_buf_simple *in, int count,
+			     bool sched)
+{
+	NET_BUF_SIMPLE_DEFINE(out, PDU_LEN);
+	uint32_t cycles;
+	uint32_t start;
+
+	start = k_cycle_get_32();
+	for (int i = 0; i < ITERATIONS; i++) {
+		zassert_equal(trial_decrypt(in, &out, count, sched), count - 1);
+	}
+	cycles = k_cycle_get_32() - start;
+
+	return (uint32_t)(((uint64_t)ITERATIONS *
+			   sys_clock_hw_cycles_per_sec()) / MAX(cycles, 1U));
+}
+
+ZTEST(mesh_crypto, test_net_decrypt_rate)
+{
+	NET_BUF_SIMPLE_DEFINE(buf, PDU_LEN);
+
+	TC_PRINT("candidates  expand/s  sched/s\n");
+
+	for (int count = 1; count <= CRED_COUNT; count *= 2) {
+		const struct bt_mesh_net_cred *cred = &creds[count - 1];
+
+		/* Only the last candidate decrypts the PDU */
+		pdu_create(&buf, cred->nid, false);
+		bt_mesh_net_encrypt(cred->enc, &buf, IV_INDEX, false);
+		bt_mesh_net_obfuscate(buf.data, IV_INDEX, cred->privacy);
+
+		TC_PRINT("%10d %9u %8u\n", count,
+			 decrypt_rate(&buf, count, false),
+			 decrypt_rate(&buf, count, true));
+	}
+}
+#endif /* CONFIG_BT_MESH_CRYPTO_BENCHMARK */
@@ -111,6 +111,14 @@ static void print_paging_stats(struct k_mem_paging_stats_t *stats, const char *s
 	       stats->eviction.clean);
 	printk("    - Dirty pages evicted: %lu\n",
 	       stats->eviction.dirty);
+	printk("    - Page frames scanned: %lu (max %lu)\n",
+	       stats->eviction.scanned, stats->eviction.scanned_max);
+
+#ifdef CONFIG_DEMAND_PAGING_READ_AHEAD
+	printk("* Read ahead (%s):\n", scope);
+	printk("    - Pages read ahead: %lu\n", stats->read_ahead.pages);
+	printk("    - Page faults avoided: %lu\n", stats->read_ahead.hits);
+#endif
 }
 
 ZTEST(demand_paging, test_touch_anon_pages)
@@ -38,6 +38,8 @@ ZTEST_BMEM int timeout;
 ZTEST_BMEM int index[TOTAL_THREADS_WAITING];
 ZTEST_BMEM struct k_futex simple_futex;
 ZTEST_BMEM struct k_futex multiple_futex[TOTAL_THREADS_WAITING];
+ZTEST_BMEM struct k_futex requeue_futex;
+ZTEST_BMEM atomic_t requeue_woken;
 struct k_futex no_access_futex;
 ZTEST_BMEM atomic_t not_a_futex;
 ZTEST_BMEM struct sys_mutex also_not_a_futex;
@@ -420,6 +422,56 @@ ZTEST(futex, test_multiple_futex_wait_wake)
 	}
 }
 
+static void futex_requeue_wait_task(void *p1, void *p2, void *p3)
+{
+	int ret;
+
+	ret = k_futex_wait(&simple_futex, 1, K_FOREVER);
+	zassert_equal(ret, 0, "futex wait failed");
+
+	atomic_inc(&requeue_woken);
+}
+
+ZTEST(futex, test_futex_requeue)
+{
+	int ret;
+
+	atomic_set(&simple_futex.val, 1);
+	atomic_clear(&requeue_futex.val);
+	atomic_clear(&requeue_woken);
+
+	for (int i = 0; i < TOTAL_THREADS_WAITING; i++) {
+		k_thread_create(&multiple_tid[i], multiple_stack[i],
+				STACK_SIZE, futex_requeue_wait_task,
+				NULL, NULL, NULL, PRIO_WAIT,
+				K_USER | K_INHERIT_PERMS, K_NO_WAIT);
+	}
+
+	/* giving time for the other threads to execute */
+	k_yield();
+
+	ret = k_futex_requeue(&simple_futex, 0, 1, &requeue_futex, UINT_MAX);
+	zassert_equal(ret, -EAGAIN, "requeued when values did not match");
+
+	/* Wake one thread, move the others */
+	ret = k_futex_requeue(&simple_futex, 1, 1, &requeue_futex, UINT_MAX);
+	zassert_equal(ret, TOTAL_THREADS_WAITING, "not all threads handled");
+	zassert_equal(atomic_get(&requeue_woken), 1, "woke more than one");
+
+	ret = k_futex_wake(&simple_futex, true);
+	zassert_equal(ret, 0, "threads left on the futex");
+
+	ret = k_futex_wake(&requeue_futex, true);
+	zassert_equal(ret, TOTAL_THREADS_WAITING - 1,
+		      "threads not moved to the target futex");
+	zassert_equal(atomic_get(&requeue_woken), TOTAL_THREADS_WAITING,
+		      "moved threads not woken");
+
+	for (int i = 0; i < TOTAL_THREADS_WAITING; i++) {
+		k_thread_abort(&multiple_tid[i]);
+	}
+}
+
 ZTEST_USER(futex, test_user_futex_bad)
 {
 	int ret;
@@ -429,12 +481,17 @@ ZTEST_USER(futex, test_user_futex_bad)
 	zassert_equal(ret, -EACCES, "shouldn't have been able to access");
 	ret = k_futex_wake(&no_access_futex, false);
 	zassert_equal(ret, -EACCES, "shouldn't have been able to access");
+	ret = k_futex_requeue(&simple_futex, 0, 1, &no_access_futex, 1);
+	zassert_equal(ret, -EACCES, "shouldn't have been able to access");
 
 	/* Access to memory, but not a kernel object */
 	ret = k_futex_wait((struct k_futex *)&not_a_futex, 0, K_NO_WAIT);
 	zassert_equal(ret, -EINVAL, "waited on non-futex");
 	ret = k_futex_wake((struct k_futex *)&not_a_futex, false);
 	zassert_equal(ret, -EINVAL, "woke non-futex");
+	ret = k_futex_requeue(&simple_futex, 0, 1,
+			      (struct k_futex *)&not_a_futex, 1);
+	zassert_equal(ret, -EINVAL, "requeued to non-futex");
 
 	/* Access to memory, but wrong object type */
 	ret = k_futex_wait((struct k_futex *)&also_not_a_futex, 0, K_NO_WAIT);
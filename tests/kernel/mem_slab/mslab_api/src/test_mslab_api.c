@@ -338,3 +338,61 @@ ZTEST(mslab_api, test_mslab_pending)
 	/* Free memory block */
 	k_mem_slab_free(&kmslab, &b);
 }
+
+static void *waiter_block;
+
+static void waiter_thread(void *p0, void *p1, void *p2)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+
+	zassert_ok(k_mem_slab_alloc((struct k_mem_slab *)p0, &waiter_block,
+				    K_FOREVER));
+}
+
+/**
+ * @brief Verify that a freed block goes to a waiting thread first
+ *
+ * @details A lower priority thread waits on an exhausted memory slab.
+ * Once a block is freed, allocating without waiting must fail even though
+ * the waiter has not run yet, and the waiter must get the freed block.
+ *
+ * @ingroup kernel_memory_slab_tests
+ */
+ZTEST(mslab_api, test_mslab_free_to_waiter)
+{
+	if (!IS_ENABLED(CONFIG_MULTITHREADING)) {
+		ztest_test_skip();
+		return;
+	}
+
+	void *block[BLK_NUM];
+	void *b;
+
+	for (int i = 0; i < BLK_NUM; i++) {
+		zassert_ok(k_mem_slab_alloc(&mslab, &block[i], K_NO_WAIT));
+	}
+
+	waiter_block = NULL;
+	(void)k_thread_create(&HELPER, stack, STACKSIZE,
+			waiter_thread, &mslab, NULL, NULL,
+			K_LOWEST_APPLICATION_THREAD_PRIO, 0, K_NO_WAIT);
+
+	/* Let the waiter pend on the slab */
+	k_msleep(10);
+
+	k_mem_slab_free(&mslab, &block[0]);
+
+	zassert_equal(k_mem_slab_alloc(&mslab, &b, K_NO_WAIT), -ENOMEM,
+		      "freed block not handed to the waiting thread");
+
+	k_thread_join(&HELPER, K_FOREVER);
+
+	zassert_equal(waiter_block, block[0]);
+	zassert_equal(k_mem_slab_num_used_get(&mslab), BLK_NUM);
+
+	k_mem_slab_free(&mslab, &waiter_block);
+	for (int i = 1; i < BLK_NUM; i++) {
+		k_mem_slab_free(&mslab, &block[i]);
+	}
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_msgq.h"
+
+#define BATCH_LEN 4
+
+K_THREAD_STACK_DECLARE(tstack, STACK_SIZE);
+extern struct k_thread tdata;
+extern struct k_msgq msgq;
+static ZTEST_BMEM char __aligned(4) bbuffer[MSG_SIZE * BATCH_LEN];
+static ZTEST_DMEM uint32_t bdata[] = { 1, 2, 3, 4, 5, 6 };
+static ZTEST_BMEM uint32_t brecv[ARRAY_SIZE(bdata)];
+static ZTEST_BMEM int bresult;
+
+static void batch_put_get(struct k_msgq *q)
+{
+	memset(brecv, 0, sizeof(brecv));
+
+	zassert_equal(k_msgq_put_batch(q, bdata, 0, K_NO_WAIT), -EINVAL);
+
+	/**TESTPOINT: put as many messages as fit */
+	zassert_equal(k_msgq_put_batch(q, bdata, ARRAY_SIZE(bdata), K_NO_WAIT),
+		      BATCH_LEN);
+	zassert_equal(k_msgq_num_used_get(q), BATCH_LEN);
+	zassert_equal(k_msgq_put_batch(q, bdata, 1, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_put_batch(q, bdata, 1, TIMEOUT), -EAGAIN);
+
+	/**TESTPOINT: get fewer and more messages than queued */
+	zassert_equal(k_msgq_get_batch(q, brecv, 3, K_NO_WAIT), 3);
+	zassert_mem_equal(brecv, bdata, 3 * MSG_SIZE);
+	zassert_equal(k_msgq_get_batch(q, brecv, ARRAY_SIZE(brecv), K_NO_WAIT),
+		      1);
+	zassert_equal(brecv[0], bdata[3]);
+	zassert_equal(k_msgq_get_batch(q, brecv, 1, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_get_batch(q, brecv, 1, TIMEOUT), -EAGAIN);
+
+	/**TESTPOINT: batches wrap around the end of the ring buffer */
+	zassert_equal(k_msgq_put_batch(q, bdata, 3, K_NO_WAIT), 3);
+	zassert_equal(k_msgq_get_batch(q, brecv, ARRAY_SIZE(brecv), K_NO_WAIT),
+		      3);
+	zassert_mem_equal(brecv, bdata, 3 * MSG_SIZE);
+	zassert_equal(k_msgq_num_used_get(q), 0);
+}
+
+static void tThread_get_batch(void *p1, void *p2, void *p3)
+{
+	bresult = k_msgq_get_batch((struct k_msgq *)p1, brecv, 2, K_FOREVER);
+}
+
+/**
+ * @addtogroup kernel_message_queue_tests
+ * @{
+ */
+
+/**
+ * @brief Test sending and receiving batches of messages
+ * @see k_msgq_put_batch(), k_msgq_get_batch()
+ */
+ZTEST(msgq_api, test_msgq_batch)
+{
+	k_msgq_init(&msgq, bbuffer, MSG_SIZE, BATCH_LEN);
+
+	batch_put_get(&msgq);
+}
+
+/**
+ * @brief Test sending a batch of messages to a waiting receiver
+ * @see k_msgq_put_batch(), k_msgq_get_batch()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_batch_waiting_receiver)
+{
+	k_msgq_init(&msgq, bbuffer, MSG_SIZE, BATCH_LEN);
+	memset(brecv, 0, sizeof(brecv));
+
+	k_thread_create(&tdata, tstack, STACK_SIZE,
+			tThread_get_batch, &msgq, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+
+	/**TESTPOINT: the first message goes to the receiver, the rest is queued */
+	zassert_equal(k_msgq_put_batch(&msgq, bdata, 3, K_NO_WAIT), 3);
+	k_thread_join(&tdata, K_FOREVER);
+
+	zassert_equal(bresult, 1);
+	zassert_equal(brecv[0], bdata[0]);
+	zassert_equal(k_msgq_num_used_get(&msgq), 2);
+
+	k_msgq_purge(&msgq);
+}
+
+#ifdef CONFIG_USERSPACE
+/**
+ * @brief Test sending and receiving batches of messages from user mode
+ * @see k_msgq_put_batch(), k_msgq_get_batch()
+ */
+ZTEST_USER(msgq_api, test_msgq_user_batch)
+{
+	struct k_msgq *q;
+
+	q = k_object_alloc(K_OBJ_MSGQ);
+	zassert_not_null(q, "couldn't alloc message queue");
+	zassert_false(k_msgq_alloc_init(q, MSG_SIZE, BATCH_LEN));
+
+	batch_put_get(q);
+}
+#endif
+
+/**
+ * @}
+ */
@@ -18,6 +18,7 @@ static ZTEST_DMEM int thread_ret = TC_FAIL;
 /**TESTPOINT: init via K_MUTEX_DEFINE*/
 K_MUTEX_DEFINE(kmutex);
 static struct k_mutex mutex;
+static struct k_mutex mutex2;
 
 static K_THREAD_STACK_DEFINE(tstack, STACK_SIZE);
 static K_THREAD_STACK_DEFINE(tstack2, STACK_SIZE);
@@ -449,6 +450,77 @@ ZTEST(mutex_api_1cpu, test_mutex_timeout_race_during_priority_inversion)
 	k_mutex_unlock(&mutex);
 }
 
+static void tThread_lock_timeout_expired(void *p1, void *p2, void *p3)
+{
+	zassert_equal(k_mutex_lock((struct k_mutex *)p1,
+				   K_MSEC((uintptr_t)p2)), -EAGAIN,
+		      "waiter should time out");
+}
+
+/**
+ * @brief Test priority inheritance when waiters on nested mutexes time out
+ *
+ * - The current thread, running at low priority, locks mutex A.
+ * - A mid priority thread waits on mutex A, boosting the owner to mid.
+ * - The owner then locks mutex B.
+ * - A high priority thread waits on mutex B, boosting the owner to high.
+ * - The high priority thread times out first: the owner must drop back to
+ *   mid, as mutex A is still wanted by the mid priority thread.
+ * - The mid priority thread times out: the owner must drop back to low.
+ *
+ * @ingroup kernel_mutex_tests
+ *
+ * @see k_mutex_lock(), k_mutex_unlock()
+ */
+ZTEST(mutex_api_1cpu, test_mutex_priority_inheritance_timeout)
+{
+	k_tid_t self = k_current_get();
+	int old_prio = k_thread_priority_get(self);
+
+	k_mutex_init(&mutex);
+	k_mutex_init(&mutex2);
+
+	k_thread_priority_set(self, K_PRIO_PREEMPT(THREAD_LOW_PRIORITY));
+
+	zassert_ok(k_mutex_lock(&mutex, K_FOREVER));
+
+	k_thread_create(&tdata, tstack, STACK_SIZE,
+			tThread_lock_timeout_expired, &mutex,
+			(void *)(uintptr_t)(4 * TIMEOUT), NULL,
+			K_PRIO_PREEMPT(THREAD_MID_PRIORITY), 0, K_NO_WAIT);
+
+	zassert_equal(k_thread_priority_get(self), THREAD_MID_PRIORITY,
+		      "owner not boosted by the mid priority waiter");
+
+	zassert_ok(k_mutex_lock(&mutex2, K_FOREVER));
+
+	k_thread_create(&tdata2, tstack2, STACK_SIZE,
+			tThread_lock_timeout_expired, &mutex2,
+			(void *)(uintptr_t)(TIMEOUT / 5), NULL,
+			K_PRIO_PREEMPT(THREAD_HIGH_PRIORITY), 0, K_NO_WAIT);
+
+	zassert_equal(k_thread_priority_get(self), THREAD_HIGH_PRIORITY,
+		      "owner not boosted by the high priority waiter");
+
+	k_thread_join(&tdata2, K_FOREVER);
+
+	zassert_equal(k_thread_priority_get(self), THREAD_MID_PRIORITY,
+		      "owner lost the boost of the remaining waiter");
+
+	k_thread_join(&tdata, K_FOREVER);
+
+	zassert_equal(k_thread_priority_get(self), THREAD_LOW_PRIORITY,
+		      "owner kept a boost after all waiters timed out");
+
+	zassert_ok(k_mutex_unlock(&mutex2));
+	zassert_ok(k_mutex_unlock(&mutex));
+
+	zassert_equal(k_thread_priority_get(self), THREAD_LOW_PRIORITY,
+		      "owner priority changed by unlocking");
+
+	k_thread_priority_set(self, old_prio);
+}
+
 static void *mutex_api_tests_setup(void)
 {
 #ifdef CONFIG_USERSPACE
@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @brief Tests for the pipe claim and vectored transfer APIs
+ * @ingroup kernel_pipe_tests
+ * @{
+ */
+
+#include <zephyr/ztest.h>
+
+#ifdef CONFIG_PIPES_ZERO_COPY
+
+#define ZC_PIPE_LEN   8
+#define ZC_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+K_PIPE_DEFINE(zc_pipe, ZC_PIPE_LEN, 4);
+
+static K_THREAD_STACK_DEFINE(zc_stack, ZC_STACK_SIZE);
+static struct k_thread zc_thread;
+static unsigned char zc_read_buf[ZC_PIPE_LEN];
+static size_t zc_bytes_read;
+
+static void zc_reader(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	zassert_ok(k_pipe_get(&zc_pipe, zc_read_buf, 4, &zc_bytes_read, 4,
+			      K_FOREVER));
+}
+
+/**
+ * @brief Test writing and reading the pipe buffer in place
+ *
+ * @see k_pipe_put_claim(), k_pipe_put_finish(), k_pipe_get_claim(),
+ * k_pipe_get_finish()
+ */
+ZTEST(pipe_api, test_pipe_claim)
+{
+	uint8_t *data;
+
+	k_pipe_flush(&zc_pipe);
+
+	zassert_equal(k_pipe_put_claim(&zc_pipe, &data, 5), 5);
+	memcpy(data, "abcde", 5);
+	zassert_ok(k_pipe_put_finish(&zc_pipe, 5));
+	zassert_equal(k_pipe_read_avail(&zc_pipe), 5);
+
+	zassert_equal(k_pipe_get_claim(&zc_pipe, &data, ZC_PIPE_LEN), 5);
+	zassert_mem_equal(data, "abcde", 5);
+	zassert_ok(k_pipe_get_finish(&zc_pipe, 3));
+
+	zassert_equal(k_pipe_get_claim(&zc_pipe, &data, ZC_PIPE_LEN), 2);
+	zassert_mem_equal(data, "de", 2);
+	zassert_ok(k_pipe_get_finish(&zc_pipe, 2));
+	zassert_equal(k_pipe_read_avail(&zc_pipe), 0);
+
+	/* Claims stop at the end of the pipe buffer */
+	zassert_equal(k_pipe_put_claim(&zc_pipe, &data, ZC_PIPE_LEN), 3);
+	zassert_ok(k_pipe_put_finish(&zc_pipe, 3));
+	zassert_equal(k_pipe_put_claim(&zc_pipe, &data, ZC_PIPE_LEN), 5);
+	zassert_equal(k_pipe_put_finish(&zc_pipe, 6), -EINVAL);
+	zassert_ok(k_pipe_put_finish(&zc_pipe, 5));
+
+	zassert_equal(k_pipe_put_claim(&zc_pipe, &data, ZC_PIPE_LEN), 0);
+	zassert_ok(k_pipe_put_finish(&zc_pipe, 0));
+
+	k_pipe_flush(&zc_pipe);
+}
+
+/**
+ * @brief Test that data written in place is handed to a waiting reader
+ *
+ * @see k_pipe_put_claim(), k_pipe_put_finish()
+ */
+ZTEST(pipe_api, test_pipe_claim_waiting_reader)
+{
+	uint8_t *data;
+
+	k_pipe_flush(&zc_pipe);
+
+	k_thread_create(&zc_thread, zc_stack, ZC_STACK_SIZE, zc_reader,
+			NULL, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_sleep(K_MSEC(10));
+
+	zassert_equal(k_pipe_put_claim(&zc_pipe, &data, 4), 4);
+	memcpy(data, "wxyz", 4);
+	zassert_ok(k_pipe_put_finish(&zc_pipe, 4));
+
+	k_thread_join(&zc_thread, K_FOREVER);
+
+	zassert_equal(zc_bytes_read, 4);
+	zassert_mem_equal(zc_read_buf, "wxyz", 4);
+	zassert_equal(k_pipe_read_avail(&zc_pipe), 0);
+}
+
+/**
+ * @brief Test vectored writes and reads
+ *
+ * @see k_pipe_put_vec(), k_pipe_get_vec()
+ */
+ZTEST(pipe_api, test_pipe_vec)
+{
+	unsigned char out[ZC_PIPE_LEN];
+	struct k_pipe_vec put_vec[] = {
+		{ .data = "ab", .len = 2 },
+		{ .data = "cde", .len = 3 },
+		{ .data = "fgh", .len = 3 },
+	};
+	struct k_pipe_vec get_vec[] = {
+		{ .data = &out[0], .len = 3 },
+		{ .data = &out[3], .len = 5 },
+	};
+	size_t bytes;
+
+	k_pipe_flush(&zc_pipe);
+
+	zassert_ok(k_pipe_put_vec(&zc_pipe, put_vec, ARRAY_SIZE(put_vec),
+				  &bytes, ZC_PIPE_LEN, K_NO_WAIT));
+	zassert_equal(bytes, ZC_PIPE_LEN);
+
+	/* The pipe is full */
+	zassert_equal(k_pipe_put_vec(&zc_pipe, put_vec, ARRAY_SIZE(put_vec),
+				     &bytes, 1, K_NO_WAIT), -EIO);
+	zassert_equal(k_pipe_put_vec(&zc_pipe, put_vec, ARRAY_SIZE(put_vec),
+				     &bytes, 1, K_MSEC(10)), -EAGAIN);
+	zassert_equal(bytes, 0);
+
+	zassert_ok(k_pipe_get_vec(&zc_pipe, get_vec, ARRAY_SIZE(get_vec),
+				  &bytes, ZC_PIPE_LEN, K_NO_WAIT));
+	zassert_equal(bytes, ZC_PIPE_LEN);
+	zassert_mem_equal(out, "abcdefgh", ZC_PIPE_LEN);
+
+	zassert_equal(k_pipe_get_vec(&zc_pipe, get_vec, ARRAY_SIZE(get_vec),
+				     &bytes, 1, K_MSEC(10)), -EAGAIN);
+	zassert_equal(bytes, 0);
+}
+
+static unsigned char zc_vec_buf[2 * ZC_PIPE_LEN];
+static size_t zc_vec_bytes;
+static int zc_vec_rc;
+
+/* Reads twice the pipe size in one vectored read, waiting forever */
+static void zc_vec_reader(void *p1, void *p2, void *p3)
+{
+	struct k_pipe_vec get_vec[] = {
+		{ .data = &zc_vec_buf[0], .len = 5 },
+		{ .data = &zc_vec_buf[5], .len = sizeof(zc_vec_buf) - 5 },
+	};
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	zc_vec_rc = k_pipe_get_vec(&zc_pipe, get_vec, ARRAY_SIZE(get_vec),
+				   &zc_vec_bytes, sizeof(zc_vec_buf),
+				   K_FOREVER);
+}
+
+/* Drains the pipe in two halves, late enough for the writer to block */
+static void zc_vec_drainer(void *p1, void *p2, void *p3)
+{
+	size_t bytes;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_sleep(K_MSEC(100));
+	zassert_ok(k_pipe_get(&zc_pipe, &zc_vec_buf[0], ZC_PIPE_LEN, &bytes,
+			      ZC_PIPE_LEN, K_FOREVER));
+	k_sleep(K_MSEC(100));
+	zassert_ok(k_pipe_get(&zc_pipe, &zc_vec_buf[ZC_PIPE_LEN], ZC_PIPE_LEN,
+			      &bytes, ZC_PIPE_LEN, K_FOREVER));
+}
+
+/**
+ * @brief Test that a vectored read waiting forever blocks until all data
+ * has been written
+ *
+ * @see k_pipe_get_vec()
+ */
+ZTEST(pipe_api, test_pipe_get_vec_forever)
+{
+	size_t bytes;
+
+	k_pipe_flush(&zc_pipe);
+	memset(zc_vec_buf, 0, sizeof(zc_vec_buf));
+	zc_vec_rc = -1;
+
+	k_thread_create(&zc_thread, zc_stack, ZC_STACK_SIZE, zc_vec_reader,
+			NULL, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	k_sleep(K_MSEC(100));
+	zassert_ok(k_pipe_put(&zc_pipe, "abcdefgh", ZC_PIPE_LEN, &bytes,
+			      ZC_PIPE_LEN, K_NO_WAIT));
+
+	/* The reader still waits for the second half */
+	k_sleep(K_MSEC(100));
+	zassert_equal(zc_vec_rc, -1, "reader returned before all data");
+
+	zassert_ok(k_pipe_put(&zc_pipe, "ijklmnop", ZC_PIPE_LEN, &bytes,
+			      ZC_PIPE_LEN, K_NO_WAIT));
+
+	k_thread_join(&zc_thread, K_FOREVER);
+
+	zassert_ok(zc_vec_rc);
+	zassert_equal(zc_vec_bytes, sizeof(zc_vec_buf));
+	zassert_mem_equal(zc_vec_buf, "abcdefghijklmnop", sizeof(zc_vec_buf));
+}
+
+/**
+ * @brief Test that a vectored write waiting forever blocks until all data
+ * has been read
+ *
+ * @see k_pipe_put_vec()
+ */
+ZTEST(pipe_api, test_pipe_put_vec_forever)
+{
+	struct k_pipe_vec put_vec[] = {
+		{ .data = "abcdefghij", .len = 10 },
+		{ .data = "klmnop", .len = 6 },
+	};
+	size_t bytes;
+
+	k_pipe_flush(&zc_pipe);
+	memset(zc_vec_buf, 0, sizeof(zc_vec_buf));
+
+	k_thread_create(&zc_thread, zc_stack, ZC_STACK_SIZE, zc_vec_drainer,
+			NULL, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	zassert_ok(k_pipe_put_vec(&zc_pipe, put_vec, ARRAY_SIZE(put_vec),
+				  &bytes, 2 * ZC_PIPE_LEN, K_FOREVER));
+	zassert_equal(bytes, 2 * ZC_PIPE_LEN);
+
+	k_thread_join(&zc_thread, K_FOREVER);
+
+	zassert_mem_equal(zc_vec_buf, "abcdefghijklmnop", sizeof(zc_vec_buf));
+	zassert_equal(k_pipe_read_avail(&zc_pipe), 0);
+}
+
+#endif /* CONFIG_PIPES_ZERO_COPY */
+
+/**
+ * @}
+ */
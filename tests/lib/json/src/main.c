@@ -557,6 +557,216 @@ ZTEST(lib_json_test, test_json_key_not_in_descr)
 	zassert_equal(ret, 0, "No items should be decoded");
 }
 
+struct test_many {
+	int f00;
+	int f01;
+	int f02;
+	int f03;
+	int f04;
+	int f05;
+	int f06;
+	int f07;
+	int f08;
+	int f09;
+	int f10;
+	int f11;
+	int f12;
+	int f13;
+	int f14;
+	int f15;
+	int f16;
+	int f17;
+	int f18;
+	int f19;
+	int f20;
+	int f21;
+	int f22;
+	int f23;
+	int f24;
+	int f25;
+	int f26;
+	int f27;
+	int f28;
+	int f29;
+	int f30;
+	int f31;
+	int f32;
+	int f33;
+	int f34;
+	int f35;
+	int f36;
+	int f37;
+	int f38;
+	int f39;
+};
+
+static const struct json_obj_descr many_descr[] = {
+	JSON_OBJ_DESCR_PRIM(struct test_many, f00, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f01, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f02, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f03, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f04, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f05, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f06, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f07, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f08, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f09, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f10, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f11, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f12, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f13, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f14, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f15, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f16, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f17, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f18, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f19, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f20, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f21, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f22, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f23, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f24, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f25, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f26, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f27, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f28, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f29, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f30, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f31, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f32, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f33, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f34, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f35, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f36, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f37, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f38, JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM(struct test_many, f39, JSON_TOK_NUMBER),
+};
+
+struct test_dup {
+	int first;
+	int second;
+};
+
+static const struct json_obj_descr dup_descr[] = {
+	JSON_OBJ_DESCR_PRIM_NAMED(struct test_dup, "same", first,
+				  JSON_TOK_NUMBER),
+	JSON_OBJ_DESCR_PRIM_NAMED(struct test_dup, "same", second,
+				  JSON_TOK_NUMBER),
+};
+
+JSON_OBJ_KEY_TABLE_DEFINE(test_table, test_descr, 16);
+JSON_OBJ_KEY_TABLE_DEFINE(many_table, many_descr, 64);
+JSON_OBJ_KEY_TABLE_DEFINE(dup_table, dup_descr, 4);
+JSON_OBJ_KEY_TABLE_DEFINE(small_table, test_descr, 4);
+
+ZTEST(lib_json_test, test_json_key_table_decoding)
+{
+	struct test_struct ts;
+	char encoded[] = "{\"some_int\":42,"
+		"\"key_not_in_descr\":123456,"
+		"\"some_nested_struct\":{\"nested_int\":-1234,"
+		"\"nested_bool\":true,\"nested_string\":\"nested\"},"
+		"\"another_b!@l\":true,"
+		"\"some_int\":43,"
+		"\"some_string\":\"zephyr\"}";
+	uint32_t decoded[JSON_OBJ_DECODED_LEN(ARRAY_SIZE(test_descr))];
+	int ret;
+
+	ret = json_obj_key_table_init(&test_table);
+	zassert_equal(ret, 0, "Key table not built");
+
+	ret = json_obj_parse_table(encoded, sizeof(encoded) - 1, &test_table,
+				   &ts, decoded);
+	zassert_equal(ret, 4, "Not all fields decoded correctly");
+	zassert_equal(decoded[0], BIT(0) | BIT(1) | BIT(3) | BIT(5),
+		      "Wrong fields decoded");
+	zassert_true(!strcmp(ts.some_string, "zephyr"),
+		     "String not decoded correctly");
+	zassert_equal(ts.some_int, 42, "First occurrence not decoded");
+	zassert_equal(ts.some_nested_struct.nested_int, -1234,
+		      "Nested integer not decoded correctly");
+	zassert_true(!strcmp(ts.some_nested_struct.nested_string, "nested"),
+		     "Nested string not decoded correctly");
+	zassert_true(ts.another_bxxl,
+		     "Named boolean (special chars) not decoded correctly");
+}
+
+ZTEST(lib_json_test, test_json_key_table_many_fields)
+{
+	struct test_many tm;
+	char encoded[512];
+	uint32_t decoded[JSON_OBJ_DECODED_LEN(ARRAY_SIZE(many_descr))];
+	int *fields = &tm.f00;
+	size_t len;
+	int ret;
+	int i;
+
+	ret = json_obj_key_table_init(&many_table);
+	zassert_equal(ret, 0, "Key table not built");
+
+	/* Fields in reverse order */
+	len = snprintk(encoded, sizeof(encoded), "{");
+	for (i = ARRAY_SIZE(many_descr) - 1; i >= 0; i--) {
+		len += snprintk(&encoded[len], sizeof(encoded) - len,
+				"\"f%02d\":%d%s", i, i * 10, (i > 0) ? "," : "}");
+	}
+	zassert_true(len < sizeof(encoded), "Encoded object too long");
+
+	ret = json_obj_parse_table(encoded, len, &many_table, &tm, decoded);
+	zassert_equal(ret, ARRAY_SIZE(many_descr),
+		      "Not all fields decoded correctly");
+	zassert_equal(decoded[0], UINT32_MAX, "Wrong fields decoded");
+	zassert_equal(decoded[1], BIT_MASK(ARRAY_SIZE(many_descr) - 32),
+		      "Wrong fields decoded");
+	for (i = 0; i < ARRAY_SIZE(many_descr); i++) {
+		zassert_equal(fields[i], i * 10, "Field %d not decoded", i);
+	}
+}
+
+ZTEST(lib_json_test, test_json_key_table_invalid)
+{
+	int ret;
+
+	ret = json_obj_key_table_init(&small_table);
+	zassert_equal(ret, -EINVAL, "Table smaller than the descriptor");
+
+	ret = json_obj_key_table_init(&dup_table);
+	zassert_equal(ret, -ENOSPC, "Table built for duplicate names");
+}
+
+ZTEST(lib_json_test, test_json_long_string)
+{
+	struct test_struct ts;
+	char expected[64];
+	char encoded[96];
+	size_t len;
+	int ret;
+	int i;
+
+	/* Move an escaped quote across the words of the string */
+	for (i = 0; i < 40; i++) {
+		snprintk(expected, sizeof(expected), "%.*s\\\"%.*s", i,
+			 "0123456789012345678901234567890123456789", 40 - i,
+			 "abcdefghijabcdefghijabcdefghijabcdefghij");
+		len = snprintk(encoded, sizeof(encoded),
+			       "{\"some_string\":\"%s\"}", expected);
+
+		ret = json_obj_parse(encoded, len, test_descr,
+				     ARRAY_SIZE(test_descr), &ts);
+		zassert_equal(ret, BIT(0), "String %d not decoded", i);
+		zassert_true(!strcmp(ts.some_string, expected),
+			     "String %d not decoded correctly", i);
+	}
+
+	/* The end of the data in the middle of a word */
+	len = snprintk(encoded, sizeof(encoded),
+		       "{\"some_string\":\"%s", expected);
+	ret = json_obj_parse(encoded, len, test_descr, ARRAY_SIZE(test_descr),
+			     &ts);
+	zassert_equal(ret, -EINVAL, "Decoding has to fail");
+}
+
 ZTEST(lib_json_test, test_json_escape)
 {
 	char buf[42];
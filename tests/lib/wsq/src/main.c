@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/wsq.h>
+
+#define NUM_ITEMS 256
+
+K_WSQ_DEFINE(wq, 1024);
+
+struct test_work {
+	struct k_wsq_work work;
+	atomic_t count;
+	volatile bool block;
+};
+
+static struct test_work items[NUM_ITEMS];
+static struct test_work blockers[CONFIG_MP_MAX_NUM_CPUS];
+static struct k_wsq_work_sync sync;
+
+static K_SEM_DEFINE(started, 0, K_SEM_MAX_LIMIT);
+static K_SEM_DEFINE(release, 0, K_SEM_MAX_LIMIT);
+
+static void test_handler(struct k_wsq_work *work)
+{
+	struct test_work *tw = CONTAINER_OF(work, struct test_work, work);
+
+	atomic_inc(&tw->count);
+
+	if (tw->block) {
+		k_sem_give(&started);
+		(void)k_sem_take(&release, K_FOREVER);
+	}
+}
+
+static void test_work_init(struct test_work *tw, bool block)
+{
+	k_wsq_work_init(&tw->work, test_handler);
+	atomic_set(&tw->count, 0);
+	tw->block = block;
+}
+
+ZTEST(wsq, test_submit_flush)
+{
+	struct test_work *tw = &items[0];
+
+	test_work_init(tw, false);
+
+	zassert_equal(k_wsq_submit(&wq, &tw->work), 1, "not queued");
+	zassert_true(k_wsq_flush(&tw->work, &sync), "flush did not wait");
+	zassert_equal(atomic_get(&tw->count), 1, "handler did not run once");
+
+	zassert_false(k_wsq_flush(&tw->work, &sync), "flush of idle item waited");
+}
+
+ZTEST(wsq, test_resubmit_running)
+{
+	struct test_work *tw = &items[0];
+
+	test_work_init(tw, true);
+
+	zassert_equal(k_wsq_submit(&wq, &tw->work), 1, "not queued");
+	zassert_ok(k_sem_take(&started, K_FOREVER));
+
+	zassert_equal(k_wsq_submit(&wq, &tw->work), 2, "not queued again");
+	zassert_equal(k_wsq_submit(&wq, &tw->work), 0, "not already queued");
+
+	tw->block = false;
+	k_sem_give(&release);
+
+	zassert_true(k_wsq_flush(&tw->work, &sync), "flush did not wait");
+	zassert_equal(atomic_get(&tw->count), 2, "handler did not run twice");
+}
+
+ZTEST(wsq, test_cancel_queued)
+{
+	unsigned int num_cpus = arch_num_cpus();
+	struct test_work *tw = &items[0];
+
+	/* Keep every worker busy so that the item stays queued */
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		test_work_init(&blockers[i], true);
+		zassert_equal(k_wsq_submit(&wq, &blockers[i].work), 1,
+			      "blocker not queued");
+		zassert_ok(k_sem_take(&started, K_FOREVER));
+	}
+
+	test_work_init(tw, false);
+	zassert_equal(k_wsq_submit(&wq, &tw->work), 1, "not queued");
+	zassert_equal(k_wsq_cancel(&tw->work), 0, "not idle after cancel");
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		blockers[i].block = false;
+		k_sem_give(&release);
+	}
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		(void)k_wsq_flush(&blockers[i].work, &sync);
+	}
+
+	zassert_false(k_wsq_flush(&tw->work, &sync), "canceled item queued");
+	zassert_equal(atomic_get(&tw->count), 0, "canceled item ran");
+}
+
+ZTEST(wsq, test_cancel_running)
+{
+	struct test_work *tw = &items[0];
+
+	test_work_init(tw, true);
+
+	zassert_equal(k_wsq_submit(&wq, &tw->work), 1, "not queued");
+	zassert_ok(k_sem_take(&started, K_FOREVER));
+
+	zassert_equal(k_wsq_cancel(&tw->work), K_WORK_RUNNING, "not running");
+
+	/* Cancel drops the resubmission but not the running handler */
+	zassert_equal(k_wsq_submit(&wq, &tw->work), 2, "not queued again");
+	zassert_equal(k_wsq_cancel(&tw->work), K_WORK_RUNNING, "not running");
+
+	tw->block = false;
+	k_sem_give(&release);
+
+	zassert_true(k_wsq_flush(&tw->work, &sync), "flush did not wait");
+	zassert_equal(atomic_get(&tw->count), 1, "handler did not run once");
+
+	zassert_false(k_wsq_cancel_sync(&tw->work, &sync), "idle item pending");
+}
+
+ZTEST(wsq, test_many_items)
+{
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		test_work_init(&items[i], false);
+	}
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(k_wsq_submit(&wq, &items[i].work), 1,
+			      "item %d not queued", i);
+	}
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		(void)k_wsq_flush(&items[i].work, &sync);
+	}
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(atomic_get(&items[i].count), 1,
+			      "item %d ran %d times", i,
+			      (int)atomic_get(&items[i].count));
+	}
+}
+
+static void *wsq_setup(void)
+{
+	k_wsq_start(&wq, K_PRIO_PREEMPT(1));
+
+	return NULL;
+}
+
+ZTEST_SUITE(wsq, NULL, wsq_setup, NULL, NULL, NULL);
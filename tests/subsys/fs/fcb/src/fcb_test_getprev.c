@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "fcb_test.h"
+
+#define TEST_ENTRIES 400
+
+static uint16_t test_entry_len(int i)
+{
+	return i % 128;
+}
+
+static int test_count_walk_cb(struct fcb_entry_ctx *entry_ctx, void *arg)
+{
+	(*(int *)arg)++;
+	return 0;
+}
+
+ZTEST(fcb_test_with_4sectors_set, test_fcb_getprev)
+{
+	struct fcb *fcb;
+	struct fcb_entry loc;
+	uint8_t test_data[128];
+	int walk_cnt;
+	int rc;
+	int i;
+
+	fcb = &test_fcb;
+
+	/* Nothing in an empty fcb */
+	loc.fe_sector = NULL;
+	rc = fcb_getprev(fcb, &loc);
+	zassert_true(rc == -ENOTSUP, "fcb_getprev found an element");
+
+	for (i = 0; i < TEST_ENTRIES; i++) {
+		uint16_t len = test_entry_len(i);
+
+		for (int j = 0; j < len; j++) {
+			test_data[j] = fcb_test_append_data(len, j);
+		}
+		rc = fcb_append(fcb, len, &loc);
+		zassert_true(rc == 0, "fcb_append call failure");
+		rc = flash_area_write(fcb->fap, FCB_ENTRY_FA_DATA_OFF(loc),
+				      test_data, len);
+		zassert_true(rc == 0, "flash_area_write call failure");
+		rc = fcb_append_finish(fcb, &loc);
+		zassert_true(rc == 0, "fcb_append_finish call failure");
+	}
+	zassert_true(fcb->f_active.fe_sector != fcb->f_oldest,
+		     "elements should span several sectors");
+
+	/* From the newest element to the oldest */
+	loc.fe_sector = NULL;
+	for (i = TEST_ENTRIES - 1; i >= 0; i--) {
+		rc = fcb_getprev(fcb, &loc);
+		zassert_true(rc == 0, "fcb_getprev call failure");
+		zassert_equal(loc.fe_data_len, test_entry_len(i),
+			      "element %d out of order", i);
+		rc = flash_area_read(fcb->fap, FCB_ENTRY_FA_DATA_OFF(loc),
+				     test_data, loc.fe_data_len);
+		zassert_true(rc == 0, "read call failure");
+		for (int j = 0; j < loc.fe_data_len; j++) {
+			zassert_true(test_data[j] ==
+				     fcb_test_append_data(loc.fe_data_len, j),
+				     "fcb_getprev data misrepresentation");
+		}
+	}
+	rc = fcb_getprev(fcb, &loc);
+	zassert_true(rc == -ENOTSUP, "fcb_getprev went past the oldest");
+
+	/* Elements of the erased sector are not found */
+	rc = fcb_rotate(fcb);
+	zassert_true(rc == 0, "fcb_rotate call failure");
+
+	walk_cnt = 0;
+	rc = fcb_walk(fcb, NULL, test_count_walk_cb, &walk_cnt);
+	zassert_true(rc == 0, "fcb_walk call failure");
+
+	i = 0;
+	loc.fe_sector = NULL;
+	while (fcb_getprev(fcb, &loc) == 0) {
+		i++;
+	}
+	zassert_equal(i, walk_cnt, "fcb_getprev and fcb_walk counts differ");
+}
@@ -45,6 +45,13 @@ struct flash_sector test_fcb_sector[] = {
 	}
 };
 
+#ifdef CONFIG_FCB_INDEX
+/* Small enough for the elements past the index to be read from flash */
+#define TEST_FCB_INDEX_SIZE 8
+
+static struct fcb_index_entry
+	test_fcb_index[ARRAY_SIZE(test_fcb_sector) * TEST_FCB_INDEX_SIZE];
+#endif
 
 void test_fcb_wipe(void)
 {
@@ -119,6 +126,10 @@ void fcb_tc_pretest(int sectors)
 	fcb->f_erase_value = fcb_test_erase_value;
 	fcb->f_sector_cnt = sectors;
 	fcb->f_sectors = test_fcb_sector; /* XXX */
+#ifdef CONFIG_FCB_INDEX
+	fcb->f_index = test_fcb_index;
+	fcb->f_index_size = TEST_FCB_INDEX_SIZE;
+#endif
 
 	rc = 0;
 	rc = fcb_init(TEST_FCB_FLASH_AREA_ID, fcb);
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/fs/fs_rtio.h>
+#include <zephyr/fs/littlefs.h>
+#include <zephyr/rtio/rtio_executor_simple.h>
+#include <zephyr/storage/flash_map.h>
+
+#define MNT_POINT  "/lfs"
+#define TEST_FILE  MNT_POINT "/log.bin"
+#define BATCH_SIZE 64
+#define N_WRITES   10
+#define WRITE_LEN  20
+
+FS_LITTLEFS_DECLARE_DEFAULT_CONFIG(lfs_data);
+static struct fs_mount_t lfs_mnt = {
+	.type = FS_LITTLEFS,
+	.fs_data = &lfs_data,
+	.storage_dev = (void *)FIXED_PARTITION_ID(scratch_partition),
+	.mnt_point = MNT_POINT,
+};
+
+FS_RTIO_FILE_DEFINE(batched_file, 16, BATCH_SIZE);
+FS_RTIO_FILE_DEFINE(direct_file, 16, 0);
+
+RTIO_EXECUTOR_SIMPLE_DEFINE(simple_exec);
+RTIO_DEFINE(r, (struct rtio_executor *)&simple_exec, 16, 16);
+
+static uint8_t data[N_WRITES * WRITE_LEN];
+static uint8_t read_buf[sizeof(data)];
+
+/* Submit the writes of the data then a sync, and check their completions */
+static void write_data(const struct rtio_iodev *iodev)
+{
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+	int rc;
+
+	for (uintptr_t i = 0; i < N_WRITES; i++) {
+		sqe = rtio_sqe_acquire(&r);
+		zassert_not_null(sqe, "no submission");
+		rtio_sqe_prep_write(sqe, iodev, RTIO_PRIO_NORM,
+				    &data[i * WRITE_LEN], WRITE_LEN,
+				    (void *)i);
+	}
+	sqe = rtio_sqe_acquire(&r);
+	zassert_not_null(sqe, "no submission");
+	fs_rtio_sqe_prep_sync(sqe, iodev, (void *)N_WRITES);
+
+	rc = fs_rtio_submit(&r, N_WRITES + 1);
+	zassert_ok(rc, "submit failed");
+
+	for (uintptr_t i = 0; i <= N_WRITES; i++) {
+		cqe = rtio_cqe_consume(&r);
+		zassert_not_null(cqe, "no completion");
+		zassert_equal((uintptr_t)cqe->userdata, i,
+			      "completions out of order");
+		zassert_equal(cqe->result, (i < N_WRITES) ? WRITE_LEN : 0,
+			      "request %u failed %d", (unsigned int)i,
+			      cqe->result);
+		rtio_cqe_release_all(&r);
+	}
+}
+
+static void check_file(void)
+{
+	struct fs_file_t file;
+	ssize_t rc;
+
+	fs_file_t_init(&file);
+	zassert_ok(fs_open(&file, TEST_FILE, FS_O_READ), "open failed");
+	rc = fs_read(&file, read_buf, sizeof(read_buf));
+	(void)fs_close(&file);
+
+	zassert_equal(rc, sizeof(data), "wrong file size %d", (int)rc);
+	zassert_mem_equal(read_buf, data, sizeof(data), "wrong file data");
+}
+
+static void test_write(const struct rtio_iodev *iodev)
+{
+	zassert_ok(fs_rtio_open(iodev, TEST_FILE, FS_O_CREATE | FS_O_WRITE),
+		   "open failed");
+	zassert_equal(fs_rtio_open(iodev, TEST_FILE, FS_O_READ), -EBUSY,
+		      "device opened twice");
+
+	write_data(iodev);
+	check_file();
+
+	zassert_ok(fs_rtio_close(iodev), "close failed");
+}
+
+ZTEST(fs_rtio, test_write_batched)
+{
+	test_write(&batched_file);
+}
+
+ZTEST(fs_rtio, test_write_direct)
+{
+	test_write(&direct_file);
+}
+
+ZTEST(fs_rtio, test_write_close)
+{
+	struct fs_dirent entry;
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+
+	zassert_ok(fs_rtio_open(&batched_file, TEST_FILE,
+				FS_O_CREATE | FS_O_WRITE), "open failed");
+
+	/* A batched write completes before it reaches the file */
+	sqe = rtio_sqe_acquire(&r);
+	rtio_sqe_prep_write(sqe, &batched_file, RTIO_PRIO_NORM, data,
+			    WRITE_LEN, NULL);
+	zassert_ok(fs_rtio_submit(&r, 1), "submit failed");
+	cqe = rtio_cqe_consume(&r);
+	zassert_not_null(cqe, "no completion");
+	zassert_equal(cqe->result, WRITE_LEN, "write failed %d", cqe->result);
+	rtio_cqe_release_all(&r);
+
+	/* Closing writes the batch */
+	zassert_ok(fs_rtio_close(&batched_file), "close failed");
+
+	zassert_ok(fs_stat(TEST_FILE, &entry), "stat failed");
+	zassert_equal(entry.size, WRITE_LEN, "batch not written");
+}
+
+ZTEST(fs_rtio, test_read)
+{
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+
+	zassert_ok(fs_rtio_open(&batched_file, TEST_FILE,
+				FS_O_CREATE | FS_O_WRITE), "open failed");
+	write_data(&batched_file);
+	zassert_ok(fs_rtio_close(&batched_file), "close failed");
+
+	zassert_ok(fs_rtio_open(&batched_file, TEST_FILE, FS_O_READ),
+		   "open failed");
+
+	memset(read_buf, 0, sizeof(read_buf));
+	sqe = rtio_sqe_acquire(&r);
+	rtio_sqe_prep_read(sqe, &batched_file, RTIO_PRIO_NORM, read_buf,
+			   sizeof(read_buf), NULL);
+	zassert_ok(fs_rtio_submit(&r, 1), "submit failed");
+
+	cqe = rtio_cqe_consume(&r);
+	zassert_not_null(cqe, "no completion");
+	zassert_equal(cqe->result, sizeof(data), "read failed %d",
+		      cqe->result);
+	rtio_cqe_release_all(&r);
+	zassert_mem_equal(read_buf, data, sizeof(data), "wrong data read");
+
+	zassert_ok(fs_rtio_close(&batched_file), "close failed");
+}
+
+ZTEST(fs_rtio, test_not_open)
+{
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+
+	sqe = rtio_sqe_acquire(&r);
+	rtio_sqe_prep_write(sqe, &direct_file, RTIO_PRIO_NORM, data,
+			    WRITE_LEN, NULL);
+	zassert_ok(fs_rtio_submit(&r, 1), "submit failed");
+
+	cqe = rtio_cqe_consume(&r);
+	zassert_not_null(cqe, "no completion");
+	zassert_equal(cqe->result, -EBADF, "write to closed file accepted");
+	rtio_cqe_release_all(&r);
+
+	zassert_equal(fs_rtio_close(&direct_file), -EBADF,
+		      "closed file closed");
+}
+
+static void *fs_rtio_setup(void)
+{
+	for (size_t i = 0; i < sizeof(data); i++) {
+		data[i] = (uint8_t)(i * 3);
+	}
+
+	zassert_ok(fs_mount(&lfs_mnt), "mount failed");
+
+	return NULL;
+}
+
+static void fs_rtio_before(void *fixture)
+{
+	(void)fs_unlink(TEST_FILE);
+}
+
+static void fs_rtio_teardown(void *fixture)
+{
+	(void)fs_unmount(&lfs_mnt);
+}
+
+ZTEST_SUITE(fs_rtio, NULL, fs_rtio_setup, fs_rtio_before, NULL,
+	    fs_rtio_teardown);
@@ -869,3 +869,164 @@ ZTEST_F(nvs, test_nvs_cache_gc)
 	zassert_equal(num, 2, "invalid cache content after gc");
 #endif
 }
+
+#define WALK_MAX_ENTRIES 64
+
+struct walk_result {
+	size_t count;
+	struct nvs_entry entries[WALK_MAX_ENTRIES];
+};
+
+static int walk_collect(struct nvs_fs *fs, const struct nvs_entry *entry,
+			void *param)
+{
+	struct walk_result *result = param;
+
+	zassert_true(result->count < WALK_MAX_ENTRIES, "too many entries");
+	result->entries[result->count++] = *entry;
+
+	return 0;
+}
+
+static int walk_stop(struct nvs_fs *fs, const struct nvs_entry *entry,
+		     void *param)
+{
+	size_t *count = param;
+
+	++*count;
+
+	return 42;
+}
+
+/*
+ * Test that nvs_walk() visits every entry from the newest to the oldest one,
+ * deleted entries included, and that nvs_entry_read() reads their data.
+ */
+ZTEST_F(nvs, test_nvs_walk)
+{
+	static const struct {
+		uint16_t id;
+		const char *data;
+	} writes[] = {
+		{ 1, "first" },
+		{ 2, "second" },
+		{ 1, "third" },
+	};
+	struct walk_result result = { 0 };
+	char rd_buf[8];
+	size_t count = 0;
+	ssize_t len;
+	int err;
+
+	fixture->fs.sector_count = 3;
+
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0,  "nvs_mount call failure: %d", err);
+
+	for (size_t i = 0; i < ARRAY_SIZE(writes); i++) {
+		len = nvs_write(&fixture->fs, writes[i].id, writes[i].data,
+				strlen(writes[i].data));
+		zassert_true(len == strlen(writes[i].data),
+			     "nvs_write failed: %d", len);
+	}
+
+	err = nvs_delete(&fixture->fs, 2);
+	zassert_true(err == 0,  "nvs_delete call failure: %d", err);
+
+	err = nvs_walk(&fixture->fs, walk_collect, &result);
+	zassert_true(err == 0,  "nvs_walk call failure: %d", err);
+	zassert_equal(result.count, ARRAY_SIZE(writes) + 1,
+		      "unexpected number of entries: %u", result.count);
+
+	/* The deletion is the newest entry */
+	zassert_equal(result.entries[0].id, 2, "unexpected id");
+	zassert_equal(result.entries[0].len, 0, "deleted entry with data");
+	len = nvs_entry_read(&fixture->fs, &result.entries[0], rd_buf,
+			     sizeof(rd_buf));
+	zassert_true(len == -ENOENT, "nvs_entry_read on deleted entry: %d", len);
+
+	for (size_t i = 0; i < ARRAY_SIZE(writes); i++) {
+		const struct nvs_entry *entry = &result.entries[i + 1];
+		size_t w = ARRAY_SIZE(writes) - 1 - i;
+
+		zassert_equal(entry->id, writes[w].id, "unexpected id");
+
+		memset(rd_buf, 0, sizeof(rd_buf));
+		len = nvs_entry_read(&fixture->fs, entry, rd_buf,
+				     sizeof(rd_buf));
+		zassert_true(len == strlen(writes[w].data),
+			     "nvs_entry_read failed: %d", len);
+		zassert_mem_equal(rd_buf, writes[w].data, len,
+				  "unexpected entry data");
+	}
+
+	/* Short reads return the full length */
+	len = nvs_entry_read(&fixture->fs, &result.entries[1], rd_buf, 2);
+	zassert_true(len == strlen("third"), "nvs_entry_read failed: %d", len);
+
+	/* A callback returning non-zero stops the walk */
+	err = nvs_walk(&fixture->fs, walk_stop, &count);
+	zassert_equal(err, 42, "walk not stopped: %d", err);
+	zassert_equal(count, 1, "walk visited %u entries after stopping", count);
+}
+
+/*
+ * Test that nvs_walk() does not report the ate written once garbage
+ * collection is done, and still finds the current version of each id.
+ */
+ZTEST_F(nvs, test_nvs_walk_gc)
+{
+	struct walk_result result = { 0 };
+	uint8_t buf[32];
+	bool seen[10] = { false };
+	ssize_t len;
+	int err;
+
+	const uint16_t max_id = 10;
+	/* 25th write will trigger GC. */
+	const uint16_t max_writes = 26;
+
+	fixture->fs.sector_count = 2;
+
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0,  "nvs_mount call failure: %d", err);
+
+	for (uint16_t i = 0; i < max_writes; i++) {
+		memset(buf, i, sizeof(buf));
+
+		len = nvs_write(&fixture->fs, i % max_id, buf, sizeof(buf));
+		zassert_true(len == sizeof(buf), "nvs_write failed: %d", len);
+	}
+
+	err = nvs_walk(&fixture->fs, walk_collect, &result);
+	zassert_true(err == 0,  "nvs_walk call failure: %d", err);
+
+	for (size_t i = 0; i < result.count; i++) {
+		const struct nvs_entry *entry = &result.entries[i];
+		uint8_t rd_buf[32];
+		uint8_t last;
+
+		zassert_true(entry->id < max_id, "unexpected id 0x%x",
+			     entry->id);
+
+		/* Only the first visit of an id is its current version */
+		if (seen[entry->id]) {
+			continue;
+		}
+		seen[entry->id] = true;
+
+		len = nvs_entry_read(&fixture->fs, entry, rd_buf,
+				     sizeof(rd_buf));
+		zassert_true(len == sizeof(rd_buf),
+			     "nvs_entry_read failed: %d", len);
+
+		last = entry->id + max_id * ((max_writes - 1 - entry->id) / max_id);
+		memset(buf, last, sizeof(buf));
+		zassert_mem_equal(rd_buf, buf, sizeof(rd_buf),
+				  "not the current version of id %u", entry->id);
+	}
+
+	for (uint16_t id = 0; id < max_id; id++) {
+		zassert_true(seen[id], "id %u not visited", id);
+	}
+}
@@ -76,6 +76,39 @@ ZTEST(test_log_output, test_raw)
 	zassert_equal(strcmp(exp_str, mock_buffer), 0);
 }
 
+ZTEST(test_log_output, test_raw_newlines)
+{
+	char package[256];
+	static const char *exp_str = "line one\r\n\r\nline 3\r\n";
+	int err;
+
+	err = cbprintf_package(package, sizeof(package), 0, "line %s\n\nline %d\n",
+			       "one", 3);
+	zassert_true(err > 0);
+
+	log_output_process(&log_output, 0, NULL, SNAME, LOG_LEVEL_INTERNAL_RAW_STRING,
+			   package, NULL, 0, 0);
+
+	mock_buffer[mock_len] = '\0';
+	zassert_equal(strcmp(exp_str, mock_buffer), 0);
+}
+
+ZTEST(test_log_output, test_long_message)
+{
+	char package[256];
+	static const char *exp_str = SNAME ": a message longer than the output buffer 12345\r\n";
+	int err;
+
+	err = cbprintf_package(package, sizeof(package), 0,
+			       "a message longer than the output buffer %d", 12345);
+	zassert_true(err > 0);
+
+	log_output_process(&log_output, 0, NULL, SNAME, LOG_LEVEL_INF, package, NULL, 0, 0);
+
+	mock_buffer[mock_len] = '\0';
+	zassert_equal(strcmp(exp_str, mock_buffer), 0);
+}
+
 ZTEST(test_log_output, test_no_flags_dname)
 {
 	char package[256];
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdio.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/settings/settings.h>
+
+#include "settings_priv.h"
+
+/* The settings NVS back-end is wrapped by a store counting the values
+ * written to it. What the back-end holds is read by loading it directly,
+ * which gives the values found after a power loss.
+ */
+static struct settings_store *backend;
+static unsigned int backend_saves;
+static bool backend_fail;
+
+static int proxy_save(struct settings_store *cs, const char *name,
+		      const char *value, size_t val_len)
+{
+	backend_saves++;
+
+	if (backend_fail) {
+		return -EIO;
+	}
+
+	return backend->cs_itf->csi_save(backend, name, value, val_len);
+}
+
+static const struct settings_store_itf proxy_itf = {
+	.csi_save = proxy_save,
+};
+
+static struct settings_store proxy_store = {
+	.cs_itf = &proxy_itf,
+};
+
+struct stored_value {
+	bool found;
+	uint32_t value;
+};
+
+static int stored_value_cb(const char *key, size_t len,
+			   settings_read_cb read_cb, void *cb_arg,
+			   void *param)
+{
+	struct stored_value *stored = param;
+
+	if (read_cb(cb_arg, &stored->value, sizeof(stored->value)) ==
+	    sizeof(stored->value)) {
+		stored->found = true;
+	}
+
+	return 0;
+}
+
+static struct stored_value backend_value(const char *name)
+{
+	struct stored_value stored = { 0 };
+	const struct settings_load_arg arg = {
+		.subtree = name,
+		.cb = stored_value_cb,
+		.param = &stored,
+	};
+
+	(void)backend->cs_itf->csi_load(backend, &arg);
+
+	return stored;
+}
+
+static void *settings_write_back_setup(void)
+{
+	zassert_ok(settings_subsys_init(), "settings init failed");
+	backend = settings_save_dst;
+	zassert_not_null(backend, "no settings back-end");
+
+	return NULL;
+}
+
+static void settings_write_back_before(void *fixture)
+{
+	settings_dst_register(&proxy_store);
+	backend_saves = 0;
+	backend_fail = false;
+}
+
+static void settings_write_back_after(void *fixture)
+{
+	(void)settings_save_flush();
+	settings_dst_register(backend);
+}
+
+ZTEST(settings_write_back, test_write_back_coalesce)
+{
+	struct settings_save_stats before, after;
+	struct stored_value stored;
+
+	settings_save_stats_get(&before);
+
+	for (uint32_t i = 0; i < 10; i++) {
+		zassert_ok(settings_save_one("wb/a", &i, sizeof(i)),
+			   "save failed");
+	}
+	zassert_equal(backend_saves, 0, "value written before flush");
+
+	zassert_ok(settings_save_flush(), "flush failed");
+	zassert_equal(backend_saves, 1, "writes not coalesced");
+
+	stored = backend_value("wb/a");
+	zassert_true(stored.found && (stored.value == 9),
+		     "latest value not stored");
+
+	settings_save_stats_get(&after);
+	zassert_equal(after.saves - before.saves, 10, "wrong save count");
+	zassert_equal(after.writes - before.writes, 1, "wrong write count");
+}
+
+ZTEST(settings_write_back, test_write_back_power_loss)
+{
+	struct stored_value stored = { 0 };
+	uint32_t value = 1;
+
+	zassert_ok(settings_save_one("wb/b", &value, sizeof(value)),
+		   "save failed");
+	zassert_ok(settings_save_flush(), "flush failed");
+
+	value = 2;
+	zassert_ok(settings_save_one("wb/b", &value, sizeof(value)),
+		   "save failed");
+
+	/* Power lost now: the back-end holds the flushed value */
+	stored = backend_value("wb/b");
+	zassert_true(stored.found && (stored.value == 1),
+		     "unflushed value in storage");
+
+	/* Loading writes the cache back first */
+	stored.found = false;
+	zassert_ok(settings_load_subtree_direct("wb/b", stored_value_cb,
+						&stored), "load failed");
+	zassert_true(stored.found && (stored.value == 2),
+		     "cached value not loaded");
+
+	stored = backend_value("wb/b");
+	zassert_true(stored.found && (stored.value == 2),
+		     "cached value not stored by load");
+}
+
+ZTEST(settings_write_back, test_write_back_deadline)
+{
+	uint32_t value = 3;
+
+	zassert_ok(settings_save_one("wb/c", &value, sizeof(value)),
+		   "save failed");
+	zassert_equal(backend_saves, 0, "value written before deadline");
+
+	k_sleep(K_MSEC(CONFIG_SETTINGS_WRITE_BACK_DELAY_MS + 100));
+
+	zassert_equal(backend_saves, 1, "value not written at deadline");
+}
+
+ZTEST(settings_write_back, test_write_back_full)
+{
+	char name[16];
+
+	for (uint32_t i = 0; i <= CONFIG_SETTINGS_WRITE_BACK_ENTRIES; i++) {
+		snprintf(name, sizeof(name), "wb/full/%u", i);
+		zassert_ok(settings_save_one(name, &i, sizeof(i)),
+			   "save failed");
+	}
+	zassert_equal(backend_saves, CONFIG_SETTINGS_WRITE_BACK_ENTRIES,
+		      "full cache not flushed");
+
+	zassert_ok(settings_save_flush(), "flush failed");
+	zassert_equal(backend_saves, CONFIG_SETTINGS_WRITE_BACK_ENTRIES + 1,
+		      "last value not flushed");
+}
+
+ZTEST(settings_write_back, test_write_back_delete)
+{
+	struct stored_value stored;
+	uint32_t value = 4;
+
+	zassert_ok(settings_save_one("wb/d", &value, sizeof(value)),
+		   "save failed");
+	zassert_ok(settings_save_flush(), "flush failed");
+
+	value = 5;
+	zassert_ok(settings_save_one("wb/d", &value, sizeof(value)),
+		   "save failed");
+	zassert_ok(settings_delete("wb/d"), "delete failed");
+	zassert_ok(settings_save_flush(), "flush failed");
+	zassert_equal(backend_saves, 2, "delete not coalesced");
+
+	stored = backend_value("wb/d");
+	zassert_false(stored.found, "deleted value in storage");
+}
+
+ZTEST(settings_write_back, test_write_back_large_value)
+{
+	static uint8_t large[CONFIG_SETTINGS_WRITE_BACK_VALUE_MAX + 1];
+	uint32_t value = 6;
+
+	zassert_ok(settings_save_one("wb/e", &value, sizeof(value)),
+		   "save failed");
+	zassert_ok(settings_save_one("wb/large", large, sizeof(large)),
+		   "save failed");
+
+	/* Pending values are written before the large one */
+	zassert_equal(backend_saves, 2, "large value not written through");
+}
+
+ZTEST(settings_write_back, test_write_back_retry)
+{
+	struct stored_value stored;
+	uint32_t value = 7;
+
+	backend_fail = true;
+	zassert_ok(settings_save_one("wb/f", &value, sizeof(value)),
+		   "save failed");
+
+	k_sleep(K_MSEC(CONFIG_SETTINGS_WRITE_BACK_DELAY_MS +
+		       CONFIG_SETTINGS_WRITE_BACK_DELAY_MS / 2));
+	zassert_equal(backend_saves, 1, "value not written at deadline");
+
+	/* First retry after the flush delay */
+	k_sleep(K_MSEC(CONFIG_SETTINGS_WRITE_BACK_DELAY_MS));
+	zassert_equal(backend_saves, 2, "failed write-back not retried");
+
+	/* The next retry backs off to twice the delay */
+	backend_fail = false;
+	k_sleep(K_MSEC(CONFIG_SETTINGS_WRITE_BACK_DELAY_MS));
+	zassert_equal(backend_saves, 2, "retry did not back off");
+
+	k_sleep(K_MSEC(CONFIG_SETTINGS_WRITE_BACK_DELAY_MS));
+	zassert_equal(backend_saves, 3, "failed write-back not retried");
+
+	stored = backend_value("wb/f");
+	zassert_true(stored.found && (stored.value == 7),
+		     "retried value not stored");
+}
+
+ZTEST_SUITE(settings_write_back, NULL, settings_write_back_setup,
+	    settings_write_back_before, settings_write_back_after, NULL);
@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2022 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/sys/crc.h>
+
+#include <zephyr/storage/stream_flash.h>
+
+#define BUF_LEN 512
+#define NUM_PAGES 4
+#define MAX_PAGE_SIZE 0x1000
+#define FLASH_BASE (128*1024)
+
+/* Latencies injected in the flash simulator operations */
+#define ERASE_LATENCY_MS 4
+#define WRITE_LATENCY_MS 2
+
+static const struct device *const sim_dev =
+	DEVICE_DT_GET(DT_CHOSEN(zephyr_flash_controller));
+
+static struct stream_flash_ctx ctx;
+static uint8_t buf[BUF_LEN];
+static uint8_t buf2[BUF_LEN];
+static uint8_t data[MAX_PAGE_SIZE * NUM_PAGES];
+static uint8_t read_buf[MAX_PAGE_SIZE * NUM_PAGES];
+static size_t data_len;
+static size_t page_size;
+static int write_error;
+static unsigned int erases;
+
+static int slow_read(const struct device *dev, off_t offset, void *data,
+		     size_t len)
+{
+	return flash_read(sim_dev, offset, data, len);
+}
+
+static int slow_write(const struct device *dev, off_t offset,
+		      const void *data, size_t len)
+{
+	k_sleep(K_MSEC(WRITE_LATENCY_MS));
+
+	if (write_error) {
+		return write_error;
+	}
+
+	return flash_write(sim_dev, offset, data, len);
+}
+
+static int slow_erase(const struct device *dev, off_t offset, size_t size)
+{
+	k_sleep(K_MSEC(ERASE_LATENCY_MS));
+	erases++;
+
+	return flash_erase(sim_dev, offset, size);
+}
+
+static const struct flash_parameters *slow_get_parameters(const struct device *dev)
+{
+	return flash_get_parameters(sim_dev);
+}
+
+static void slow_page_layout(const struct device *dev,
+			     const struct flash_pages_layout **layout,
+			     size_t *layout_size)
+{
+	const struct flash_driver_api *api = sim_dev->api;
+
+	api->page_layout(sim_dev, layout, layout_size);
+}
+
+static const struct flash_driver_api slow_api = {
+	.read = slow_read,
+	.write = slow_write,
+	.erase = slow_erase,
+	.get_parameters = slow_get_parameters,
+	.page_layout = slow_page_layout,
+};
+
+DEVICE_DEFINE(slow_flash, "slow_flash", NULL, NULL, NULL, NULL, POST_KERNEL,
+	      CONFIG_KERNEL_INIT_PRIORITY_DEVICE, &slow_api);
+
+static int write_stream(size_t chunk, k_timeout_t receive_time)
+{
+	int rc;
+
+	for (size_t off = 0; off < data_len; off += chunk) {
+		k_sleep(receive_time);
+
+		rc = stream_flash_buffered_write(&ctx, &data[off],
+						 MIN(chunk, data_len - off),
+						 off + chunk >= data_len);
+		if (rc != 0) {
+			return rc;
+		}
+	}
+
+	return 0;
+}
+
+ZTEST(lib_stream_flash_pipeline, test_pipeline_write)
+{
+	struct stream_flash_stats stats;
+	uint32_t crc;
+	int rc;
+
+	/* Chunks not aligned to the buffer length */
+	rc = write_stream(100, K_NO_WAIT);
+	zassert_equal(rc, 0, "write failed %d", rc);
+	zassert_equal(stream_flash_bytes_written(&ctx), data_len,
+		      "flush did not wait for the data to be written");
+
+	rc = flash_read(sim_dev, FLASH_BASE, read_buf, data_len);
+	zassert_equal(rc, 0, "read failed");
+	zassert_mem_equal(read_buf, data, data_len, "wrong data in flash");
+
+	stream_flash_stats_get(&ctx, &stats);
+	zassert_equal(stats.buffers, data_len / BUF_LEN, "wrong buffer count");
+	zassert_equal(stats.bytes, data_len, "wrong byte count");
+	zassert_equal(stats.erases, NUM_PAGES, "wrong erase count");
+	zassert_equal(erases, NUM_PAGES, "pages erased more than once");
+
+	rc = stream_flash_crc32(&ctx, &crc);
+	zassert_equal(rc, 0, "crc failed");
+	zassert_equal(crc, crc32_ieee(data, data_len), "wrong crc");
+}
+
+ZTEST(lib_stream_flash_pipeline, test_pipeline_unaligned_flush)
+{
+	size_t len = BUF_LEN + 16;
+	size_t full = (page_size - len) / BUF_LEN;
+	int rc;
+
+	/* Misalign the buffers with the pages */
+	rc = stream_flash_buffered_write(&ctx, data, len, true);
+	zassert_equal(rc, 0, "write failed %d", rc);
+
+	/* The last full buffer is followed by an erase ahead of the next
+	 * page, which the partial buffer flushed then does not reach. The
+	 * page it ends in, holding data, must not be erased again.
+	 */
+	rc = stream_flash_buffered_write(&ctx, &data[len],
+					 full * BUF_LEN + 100, true);
+	zassert_equal(rc, 0, "write failed %d", rc);
+	len += full * BUF_LEN + 100;
+
+	rc = flash_read(sim_dev, FLASH_BASE, read_buf, len);
+	zassert_equal(rc, 0, "read failed");
+	zassert_mem_equal(read_buf, data, len, "wrong data in flash");
+}
+
+ZTEST(lib_stream_flash_pipeline, test_pipeline_overlap)
+{
+	struct stream_flash_stats stats;
+	int rc;
+
+	/* Receiving a buffer takes as long as programming it */
+	rc = write_stream(BUF_LEN, K_MSEC(WRITE_LATENCY_MS));
+	zassert_equal(rc, 0, "write failed %d", rc);
+
+	stream_flash_stats_get(&ctx, &stats);
+	zassert_true(stats.flash_us >=
+		     stats.buffers * WRITE_LATENCY_MS * USEC_PER_MSEC,
+		     "latency not injected");
+	zassert_true(stats.wait_us < stats.flash_us / 2,
+		     "flash operations not overlapped: waited %u us of %u us",
+		     stats.wait_us, stats.flash_us);
+}
+
+ZTEST(lib_stream_flash_pipeline, test_pipeline_error)
+{
+	int rc;
+
+	write_error = -EIO;
+
+	/* The error of the work queue is returned by the next write */
+	rc = stream_flash_buffered_write(&ctx, data, BUF_LEN, false);
+	zassert_equal(rc, 0, "first buffer should be submitted");
+	rc = stream_flash_buffered_write(&ctx, data, BUF_LEN, false);
+	zassert_equal(rc, -EIO, "error not reported");
+	rc = stream_flash_buffered_write(&ctx, data, 0, true);
+	zassert_equal(rc, -EIO, "error not sticky");
+	zassert_equal(stream_flash_bytes_written(&ctx), 0,
+		      "failed buffer counted as written");
+}
+
+ZTEST(lib_stream_flash_pipeline, test_pipeline_accessors)
+{
+	struct stream_flash_stats stats;
+	off_t last_page = FLASH_BASE + (NUM_PAGES - 1) * page_size;
+	int rc;
+
+	/* Submitted, the work queue programs it in the background */
+	rc = stream_flash_buffered_write(&ctx, data, BUF_LEN, false);
+	zassert_equal(rc, 0, "write failed %d", rc);
+	rc = stream_flash_buffered_write(&ctx, data, BUF_LEN, false);
+	zassert_equal(rc, 0, "write failed %d", rc);
+
+	/* Only the buffer waited for by the second write is counted */
+	zassert_equal(stream_flash_bytes_written(&ctx), BUF_LEN,
+		      "buffer being programmed counted as written");
+
+	/* Erasing waits for the work queue, including its erase ahead */
+	rc = stream_flash_erase_page(&ctx, last_page);
+	zassert_equal(rc, 0, "erase failed %d", rc);
+	zassert_equal(stream_flash_bytes_written(&ctx), 2 * BUF_LEN,
+		      "erase did not wait for the buffer being programmed");
+
+	stream_flash_stats_get(&ctx, &stats);
+	zassert_equal(stats.buffers, 2, "wrong buffer count");
+	zassert_equal(stats.bytes, 2 * BUF_LEN, "wrong byte count");
+}
+
+ZTEST(lib_stream_flash_pipeline, test_pipeline_available)
+{
+	int rc;
+
+	rc = stream_flash_init(&ctx, DEVICE_GET(slow_flash), buf, BUF_LEN,
+			       FLASH_BASE, 2 * BUF_LEN, NULL);
+	zassert_equal(rc, 0, "init failed");
+	rc = stream_flash_pipeline_init(&ctx, buf2);
+	zassert_equal(rc, 0, "pipeline init failed");
+
+	/* Bytes being programmed count as used */
+	rc = stream_flash_buffered_write(&ctx, data, BUF_LEN, false);
+	zassert_equal(rc, 0, "write failed %d", rc);
+	rc = stream_flash_buffered_write(&ctx, data, BUF_LEN + 1, false);
+	zassert_equal(rc, -ENOMEM, "write past the area accepted");
+	rc = stream_flash_buffered_write(&ctx, data, BUF_LEN, true);
+	zassert_equal(rc, 0, "write failed %d", rc);
+}
+
+static void lib_stream_flash_pipeline_before(void *fixture)
+{
+	const struct flash_pages_layout *layout;
+	const struct flash_driver_api *api = sim_dev->api;
+	size_t layout_size;
+	int rc;
+
+	zassume_true(device_is_ready(sim_dev), "Device is not ready");
+
+	api->page_layout(sim_dev, &layout, &layout_size);
+	zassume_true(layout->pages_size <= MAX_PAGE_SIZE, "page size too large");
+	zassume_true(layout->pages_size > BUF_LEN, "page size too small");
+
+	page_size = layout->pages_size;
+	data_len = NUM_PAGES * page_size;
+	for (size_t i = 0; i < data_len; i++) {
+		data[i] = (uint8_t)(i * 7);
+	}
+
+	for (int i = 0; i < NUM_PAGES; i++) {
+		rc = flash_erase(sim_dev, FLASH_BASE + i * page_size,
+				 page_size);
+		zassert_equal(rc, 0, "erase failed");
+	}
+
+	/* Writing the first page fails unless stream flash erases it */
+	rc = flash_write(sim_dev, FLASH_BASE, data, BUF_LEN);
+	zassert_equal(rc, 0, "write failed");
+
+	write_error = 0;
+	erases = 0;
+
+	rc = stream_flash_init(&ctx, DEVICE_GET(slow_flash), buf, BUF_LEN,
+			       FLASH_BASE, data_len, NULL);
+	zassert_equal(rc, 0, "init failed");
+	rc = stream_flash_pipeline_init(&ctx, buf2);
+	zassert_equal(rc, 0, "pipeline init failed");
+}
+
+ZTEST_SUITE(lib_stream_flash_pipeline, NULL, NULL,
+	    lib_stream_flash_pipeline_before, NULL, NULL);
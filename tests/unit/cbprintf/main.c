@@ -1334,6 +1334,66 @@ ZTEST(prf, test_cbpprintf)
 	zassert_equal(rc, -EINVAL);
 }
 
+static size_t span_calls;
+
+static int out_span(const char *sp, size_t len, void *dest)
+{
+	struct out_buffer *buf = dest;
+
+	if (len > buf->size - buf->idx) {
+		return EOF;
+	}
+
+	memcpy(&buf->buf[buf->idx], sp, len);
+	buf->idx += len;
+	++span_calls;
+
+	return 0;
+}
+
+static int span_prf(size_t size, const char *format, ...)
+{
+	va_list ap;
+	int rv;
+
+	reset_out();
+	outbuf.size = size;
+	span_calls = 0;
+	va_start(ap, format);
+	rv = cbvprintf_span(out, out_span, &outbuf, format, ap);
+	va_end(ap);
+	outbuf_null_terminate(&outbuf);
+
+	return rv;
+}
+
+ZTEST(prf, test_cbvprintf_span)
+{
+	static const char exp[] = "sensor -12: temp    23.05 C, state running|ab  |%";
+	int rc;
+
+	if (USE_LIBC) {
+		TC_PRINT("not enabled\n");
+		return;
+	}
+
+	rc = span_prf(ARRAY_SIZE(buf), "sensor %d: temp %5d.%02u C, state %s|%-4s|%%",
+		      -12, 23, 5U, "running", "ab");
+	zassert_equal(strcmp(buf, exp), 0, "got %s", buf);
+	if (IS_ENABLED(CONFIG_CBPRINTF_NANO)) {
+		zassert_equal(span_calls, 0);
+		return;
+	}
+
+	zassert_equal(rc, sizeof(exp) - 1);
+	/* Literal runs and converted values are emitted at once */
+	zassert_true(span_calls < (sizeof(exp) - 1) / 2, "%zu spans", span_calls);
+
+	/* Errors of the span callback are returned */
+	rc = span_prf(4, "literal run longer than the buffer");
+	zassert_equal(rc, EOF, "rc %d", rc);
+}
+
 ZTEST(prf, test_nop)
 {
 }